@@ -20,11 +20,22 @@ void PluginMain(PA_long32 selector, PA_PluginParameters params){
 		PA_long32 pProcNum = selector;
 		sLONG_PTR *pResult = (sLONG_PTR *)params->fResult;
 		PackagePtr pParams = (PackagePtr)params->fParameters;
+		stage_time_t start = profile_begin(NULL);
 
         switch(pProcNum)
         {
                 // --- Imebra
                 
+            case kInitPlugin :
+            case kServerInitPlugin :
+                OnStartup();
+                break;
+                
+            case kDeinitPlugin :
+            case kServerDeinitPlugin :
+                OnExit();
+                break;
+                
             case 1 :
                 Imebra_Get_images(params);
                 break;
@@ -33,10 +44,64 @@ void PluginMain(PA_long32 selector, PA_PluginParameters params){
                 Imebra_Apply_filters(params);
                 break;
 
+            case 3 :
+                Imebra_Probe(params);
+                break;
+
+            case 4 :
+                Imebra_Batch(params);
+                break;
+
+            case 5 :
+                Imebra_Start_job(params);
+                break;
+
+            case 6 :
+                Imebra_Poll_job(params);
+                break;
+
+            case 7 :
+                Imebra_Cancel_job(params);
+                break;
+
+            case 8 :
+                Imebra_Collect_job(params);
+                break;
+
+            case 9 :
+                Imebra_Cache(params);
+                break;
+
+            case 10 :
+                Imebra_Open(params);
+                break;
+
+            case 11 :
+                Imebra_Render(params);
+                break;
+
+            case 12 :
+                Imebra_Close(params);
+                break;
+
+            case 13 :
+                Imebra_Get_statistics(params);
+                break;
+
+            case 14 :
+                Imebra_Trace(params);
+                break;
+
+            case 15 :
+                Imebra_Memory_pool(params);
+                break;
+
             default :
                 CommandDispatcher(pProcNum, pResult, pParams);
                 break;
         }
+        
+        statistics_add_command(pProcNum, start);
 
 	}
 	catch(...)
@@ -74,6 +139,104 @@ void json_wconv(const wchar_t *value, CUTF16String *u16){
 #endif
 }
 
+#pragma mark -
+
+/* keys are converted once at startup; the table is read-only afterwards */
+
+static std::map<const wchar_t *, PA_Unistring, ob_key_less_t> ob_keys;
+static std::atomic<bool> ob_keys_ready(false);
+
+void OnStartup(){
+    
+    if(ob_keys_ready.load(std::memory_order_acquire))
+        return;
+    
+    static const wchar_t *keys[] = {
+        L"accessionNumber", L"acquired", L"alpha", L"angle", L"binary",
+        L"binaryLimit", L"bitmap", L"bitsAllocated", L"bitsStored", L"blue",
+        L"bounds", L"brightness", L"budget", L"bulkDataURI", L"bytes", L"bytesIn",
+        L"bytesOut", L"cache", L"cached", L"calls", L"cancelled", L"center",
+        L"channels", L"clear", L"colors", L"colorspace", L"command", L"commands",
+        L"compression", L"contrast", L"count", L"decode", L"depth", L"div",
+        L"downsample", L"dstH", L"dstW", L"dstX", L"dstY", L"elapsed", L"enabled",
+        L"encode", L"entries", L"error", L"events", L"evictions", L"fg", L"filter",
+        L"filters", L"flush", L"format", L"frame", L"frames", L"framesDone",
+        L"freed", L"green", L"group", L"height", L"highBit", L"histogram", L"hits",
+        L"id", L"image", L"images", L"index", L"items", L"itemsLoaded", L"json",
+        L"length", L"level", L"load", L"lut", L"matrix", L"maxHeight",
+        L"maxSizeBufferLoad", L"maxWidth", L"misses", L"modality", L"mode", L"ms",
+        L"objects", L"offset", L"order", L"output", L"path", L"patientID",
+        L"photometricInterpretation", L"pixelDataOffset", L"pixelRepresentation",
+        L"planar", L"planarConfiguration", L"plus", L"profile", L"quality",
+        L"radius", L"ratio", L"raw", L"red", L"released", L"rescale",
+        L"rescaleIntercept", L"rescaleSlope", L"reset", L"results",
+        L"samplesPerPixel", L"seriesInstanceUID", L"shared", L"sharedBudget",
+        L"sharedBytes", L"sigma", L"signed", L"size", L"sopClassUID",
+        L"sopInstanceUID", L"srcH", L"srcW", L"srcX", L"srcY", L"stages", L"start",
+        L"state", L"stride", L"studyInstanceUID", L"sub", L"tagList", L"tags",
+        L"thread", L"threadBudget", L"threadBytes", L"threads", L"timeout",
+        L"transferSyntax", L"type", L"unitSize", L"value", L"voi", L"weight",
+        L"width"
+    };
+    
+    for(size_t i = 0; i < sizeof(keys) / sizeof(keys[0]); ++i)
+    {
+        CUTF16String ukey;
+        json_wconv(keys[i], &ukey);
+        ob_keys[keys[i]] = PA_CreateUnistring((PA_Unichar *)ukey.c_str());
+    }
+    
+    ob_keys_ready.store(true, std::memory_order_release);
+}
+
+void OnExit(){
+    
+    cancel_jobs();
+    close_sessions();
+    work_threads_stop();
+    
+    if(!ob_keys_ready.exchange(false))
+        return;
+    
+    for(std::map<const wchar_t *, PA_Unistring, ob_key_less_t>::iterator it = ob_keys.begin(); it != ob_keys.end(); ++it)
+    {
+        PA_DisposeUnistring(&it->second);
+    }
+    
+    ob_keys.clear();
+}
+
+/* returns true if key is a copy of a cached key, which must not be disposed */
+
+bool ob_key(const wchar_t *_key, PA_Unistring *key){
+    
+    if(ob_keys_ready.load(std::memory_order_acquire))
+    {
+        std::map<const wchar_t *, PA_Unistring, ob_key_less_t>::const_iterator it = ob_keys.find(_key);
+        if(it != ob_keys.end())
+        {
+            *key = it->second;
+            return true;
+        }
+    }
+    
+    CUTF16String ukey;
+    json_wconv(_key, &ukey);
+    *key = PA_CreateUnistring((PA_Unichar *)ukey.c_str());
+    
+    return false;
+}
+
+void ob_key_release(PA_Unistring *key, bool cached){
+    
+    if(!cached)
+    {
+        PA_DisposeUnistring(key);
+    }
+}
+
+#pragma mark -
+
 void ob_set_p(PA_ObjectRef obj, const wchar_t *_key, PA_Picture value){
     
     if(obj)
@@ -81,14 +244,13 @@ void ob_set_p(PA_ObjectRef obj, const wchar_t *_key, PA_Picture value){
         if(value)
         {
             PA_Variable v = PA_CreateVariable(eVK_Picture);
-            CUTF16String ukey;
-            json_wconv(_key, &ukey);
-            PA_Unistring key = PA_CreateUnistring((PA_Unichar *)ukey.c_str());
+            PA_Unistring key;
+            bool cached = ob_key(_key, &key);
             
             PA_SetPictureVariable(&v, value);
             PA_SetObjectProperty(obj, &key, v);
             
-            PA_DisposeUnistring(&key);
+            ob_key_release(&key, cached);
             PA_ClearVariable(&v);
         }
     }
@@ -101,20 +263,18 @@ void ob_set_s(PA_ObjectRef obj, const wchar_t *_key, const char *_value){
         if(_value)
         {
             PA_Variable v = PA_CreateVariable(eVK_Unistring);
-            CUTF16String ukey;
-            
-            json_wconv(_key, &ukey);
+            PA_Unistring key;
+            bool cached = ob_key(_key, &key);
             
             CUTF8String u8 = CUTF8String((const uint8_t *)_value);
             C_TEXT t;t.setUTF8String(&u8);
             
-            PA_Unistring key = PA_CreateUnistring((PA_Unichar *)ukey.c_str());
             PA_Unistring value = PA_CreateUnistring((PA_Unichar *)t.getUTF16StringPtr());
             
             PA_SetStringVariable(&v, &value);
             PA_SetObjectProperty(obj, &key, v);
             
-            PA_DisposeUnistring(&key);
+            ob_key_release(&key, cached);
             PA_ClearVariable(&v);
         }
     }
@@ -127,18 +287,17 @@ void ob_set_a(PA_ObjectRef obj, const wchar_t *_key, const wchar_t *_value){
         if(_value)
         {
             PA_Variable v = PA_CreateVariable(eVK_Unistring);
-            CUTF16String ukey;
             CUTF16String uvalue;
-            json_wconv(_key, &ukey);
             json_wconv(_value, &uvalue);
             
-            PA_Unistring key = PA_CreateUnistring((PA_Unichar *)ukey.c_str());
+            PA_Unistring key;
+            bool cached = ob_key(_key, &key);
             PA_Unistring value = PA_CreateUnistring((PA_Unichar *)uvalue.c_str());
             
             PA_SetStringVariable(&v, &value);
             PA_SetObjectProperty(obj, &key, v);
             
-            PA_DisposeUnistring(&key);
+            ob_key_release(&key, cached);
             PA_ClearVariable(&v);
         }
     }
@@ -151,32 +310,104 @@ void ob_set_c(PA_ObjectRef obj, const wchar_t *_key, PA_CollectionRef value){
         if(value)
         {
             PA_Variable v = PA_CreateVariable(eVK_Collection);
-            CUTF16String ukey;
-            json_wconv(_key, &ukey);
-            PA_Unistring key = PA_CreateUnistring((PA_Unichar *)ukey.c_str());
+            PA_Unistring key;
+            bool cached = ob_key(_key, &key);
             
             PA_SetCollectionVariable(&v, value);
             PA_SetObjectProperty(obj, &key, v);
             
-            PA_DisposeUnistring(&key);
+            ob_key_release(&key, cached);
+            PA_ClearVariable(&v);
+        }
+    }
+}
+
+void ob_set_o(PA_ObjectRef obj, const wchar_t *_key, PA_ObjectRef value){
+    
+    if(obj)
+    {
+        if(value)
+        {
+            PA_Variable v = PA_CreateVariable(eVK_Object);
+            PA_Unistring key;
+            bool cached = ob_key(_key, &key);
+            
+            PA_SetObjectVariable(&v, value);
+            PA_SetObjectProperty(obj, &key, v);
+            
+            ob_key_release(&key, cached);
             PA_ClearVariable(&v);
         }
     }
 }
 
+void ob_set_x(PA_ObjectRef obj, const wchar_t *_key, const void *bytes, size_t len){
+    
+    if(obj)
+    {
+        PA_Variable v = PA_CreateVariable(eVK_Blob);
+        PA_Unistring key;
+        bool cached = ob_key(_key, &key);
+        
+        PA_SetBlobVariable(&v, (void *)bytes, len);
+        PA_SetObjectProperty(obj, &key, v);
+        
+        ob_key_release(&key, cached);
+        PA_ClearVariable(&v);
+    }
+}
+
 void ob_set_i(PA_ObjectRef obj, const wchar_t *_key, PA_long32 value){
     
     if(obj)
     {
         PA_Variable v = PA_CreateVariable(eVK_Longint);
-        CUTF16String ukey;
-        json_wconv(_key, &ukey);
-        PA_Unistring key = PA_CreateUnistring((PA_Unichar *)ukey.c_str());
+        PA_Unistring key;
+        bool cached = ob_key(_key, &key);
         
         PA_SetLongintVariable(&v, value);
         PA_SetObjectProperty(obj, &key, v);
         
-        PA_DisposeUnistring(&key);
+        ob_key_release(&key, cached);
+        PA_ClearVariable(&v);
+    }
+}
+
+void ob_set_n(PA_ObjectRef obj, const wchar_t *_key, double value){
+    
+    if(obj)
+    {
+        PA_Variable v = PA_CreateVariable(eVK_Real);
+        PA_Unistring key;
+        bool cached = ob_key(_key, &key);
+        
+        PA_SetRealVariable(&v, value);
+        PA_SetObjectProperty(obj, &key, v);
+        
+        ob_key_release(&key, cached);
+        PA_ClearVariable(&v);
+    }
+}
+
+/* several longint properties through one variable */
+
+void ob_set_i(PA_ObjectRef obj, const ob_long_t *values, size_t count){
+    
+    if(obj)
+    {
+        PA_Variable v = PA_CreateVariable(eVK_Longint);
+        
+        for(size_t i = 0; i < count; ++i)
+        {
+            PA_Unistring key;
+            bool cached = ob_key(values[i].key, &key);
+            
+            PA_SetLongintVariable(&v, values[i].value);
+            PA_SetObjectProperty(obj, &key, v);
+            
+            ob_key_release(&key, cached);
+        }
+        
         PA_ClearVariable(&v);
     }
 }
@@ -186,14 +417,13 @@ void ob_set_b(PA_ObjectRef obj, const wchar_t *_key, bool value){
     if(obj)
     {
         PA_Variable v = PA_CreateVariable(eVK_Boolean);
-        CUTF16String ukey;
-        json_wconv(_key, &ukey);
-        PA_Unistring key = PA_CreateUnistring((PA_Unichar *)ukey.c_str());
+        PA_Unistring key;
+        bool cached = ob_key(_key, &key);
         
         PA_SetBooleanVariable(&v, value);
         PA_SetObjectProperty(obj, &key, v);
         
-        PA_DisposeUnistring(&key);
+        ob_key_release(&key, cached);
         PA_ClearVariable(&v);
     }
 }
@@ -204,13 +434,12 @@ bool ob_is_defined(PA_ObjectRef obj, const wchar_t *_key){
     
     if(obj)
     {
-        CUTF16String ukey;
-        json_wconv(_key, &ukey);
-        PA_Unistring key = PA_CreateUnistring((PA_Unichar *)ukey.c_str());
+        PA_Unistring key;
+        bool cached = ob_key(_key, &key);
         
         is_defined = PA_HasObjectProperty(obj, &key);
         
-        PA_DisposeUnistring(&key);
+        ob_key_release(&key, cached);
     }
     return is_defined;
 }
@@ -221,9 +450,8 @@ bool ob_get_a(PA_ObjectRef obj, const wchar_t *_key, CUTF8String *value){
     
     if(obj)
     {
-        CUTF16String ukey;
-        json_wconv(_key, &ukey);
-        PA_Unistring key = PA_CreateUnistring((PA_Unichar *)ukey.c_str());
+        PA_Unistring key;
+        bool cached = ob_key(_key, &key);
         is_defined = PA_HasObjectProperty(obj, &key);
         
         if(is_defined)
@@ -238,7 +466,7 @@ bool ob_get_a(PA_ObjectRef obj, const wchar_t *_key, CUTF8String *value){
             }
         }
 
-        PA_DisposeUnistring(&key);
+        ob_key_release(&key, cached);
     }
     
     return is_defined;
@@ -250,9 +478,8 @@ bool ob_get_b(PA_ObjectRef obj, const wchar_t *_key){
     
     if(obj)
     {
-        CUTF16String ukey;
-        json_wconv(_key, &ukey);
-        PA_Unistring key = PA_CreateUnistring((PA_Unichar *)ukey.c_str());
+        PA_Unistring key;
+        bool cached = ob_key(_key, &key);
         
         if(PA_HasObjectProperty(obj, &key))
         {
@@ -263,7 +490,7 @@ bool ob_get_b(PA_ObjectRef obj, const wchar_t *_key){
             }
         }
         
-        PA_DisposeUnistring(&key);
+        ob_key_release(&key, cached);
     }
     
     return value;
@@ -275,9 +502,8 @@ double ob_get_n(PA_ObjectRef obj, const wchar_t *_key){
     
     if(obj)
     {
-        CUTF16String ukey;
-        json_wconv(_key, &ukey);
-        PA_Unistring key = PA_CreateUnistring((PA_Unichar *)ukey.c_str());
+        PA_Unistring key;
+        bool cached = ob_key(_key, &key);
         
         if(PA_HasObjectProperty(obj, &key))
         {
@@ -288,21 +514,43 @@ double ob_get_n(PA_ObjectRef obj, const wchar_t *_key){
             }
         }
         
-        PA_DisposeUnistring(&key);
+        ob_key_release(&key, cached);
     }
     
     return value;
 }
 
+PA_ObjectRef ob_get_o(PA_ObjectRef obj, const wchar_t *_key){
+    
+    PA_ObjectRef value = NULL;
+    
+    if(obj)
+    {
+        PA_Unistring key;
+        bool cached = ob_key(_key, &key);
+        
+        if(PA_HasObjectProperty(obj, &key))
+        {
+            PA_Variable v = PA_GetObjectProperty(obj, &key);
+            if(PA_GetVariableKind(v) == eVK_Object)
+            {
+                value = PA_GetObjectVariable(v);
+            }
+        }
+        
+        ob_key_release(&key, cached);
+    }
+    return value;
+}
+
 PA_CollectionRef ob_get_c(PA_ObjectRef obj, const wchar_t *_key){
     
     PA_CollectionRef value = NULL;
     
     if(obj)
     {
-        CUTF16String ukey;
-        json_wconv(_key, &ukey);
-        PA_Unistring key = PA_CreateUnistring((PA_Unichar *)ukey.c_str());
+        PA_Unistring key;
+        bool cached = ob_key(_key, &key);
         
         if(PA_HasObjectProperty(obj, &key))
         {
@@ -313,294 +561,901 @@ PA_CollectionRef ob_get_c(PA_ObjectRef obj, const wchar_t *_key){
             }
         }
         
-        PA_DisposeUnistring(&key);
+        ob_key_release(&key, cached);
     }
     return value;
 }
 
-#pragma mark -
+static const wchar_t *command_names[STATISTICS_COMMANDS] = {
+    NULL,
+    L"Imebra Get images", L"Imebra Apply filters", L"Imebra Probe", L"Imebra Batch",
+    L"Imebra Start job", L"Imebra Poll job", L"Imebra Cancel job", L"Imebra Collect job",
+    L"Imebra Cache", L"Imebra Open", L"Imebra Render", L"Imebra Close",
+    L"Imebra Get statistics", L"Imebra Trace", L"Imebra Memory pool"};
 
-void Imebra_Get_images(PA_PluginParameters params){
+static std::uint64_t statistics_read(std::atomic<std::uint64_t>& value, bool reset){
+    
+    return reset ? value.exchange(0, std::memory_order_relaxed) : value.load(std::memory_order_relaxed);
+}
+
+static void set_statistics_ratio(std::atomic<std::uint64_t>& hits, std::atomic<std::uint64_t>& misses, bool reset, PA_ObjectRef obj){
+    
+    double h = (double)statistics_read(hits, reset);
+    double m = (double)statistics_read(misses, reset);
+    
+    ob_set_n(obj, L"hits", h);
+    ob_set_n(obj, L"misses", m);
+    ob_set_n(obj, L"ratio", (h + m) > 0 ? h / (h + m) : 0);
+}
+
+static void set_statistics_stage(const stage_statistics_values_t& values, PA_ObjectRef obj){
+    
+    ob_set_n(obj, L"calls", (double)values.calls);
+    ob_set_n(obj, L"ms", (double)values.ns / 1000000.0);
+    ob_set_n(obj, L"bytes", (double)values.bytes);
+    
+    PA_CollectionRef colHistogram = PA_CreateCollection();
+    
+    for(size_t i = 0; i < STATISTICS_BUCKETS; ++i)
+    {
+        PA_Variable v = PA_CreateVariable(eVK_Real);
+        PA_SetRealVariable(&v, (double)values.buckets[i]);
+        PA_SetCollectionElement(colHistogram, i, v);
+        PA_ClearVariable(&v);
+    }
+    
+    ob_set_c(obj, L"histogram", colHistogram);
+}
+
+void Imebra_Get_statistics(PA_PluginParameters params){
     
     PA_ObjectRef returnValue = PA_CreateObject();
     
-    PA_Handle h = PA_GetBlobHandleParameter( params, 1 );
-    PA_ObjectRef options = PA_GetObjectParameter( params, 2 );
+    PA_ObjectRef options = PA_GetObjectParameter( params, 1 );
     
-    PA_CollectionRef colTags = NULL;
-    PA_CollectionRef colImages = PA_CreateCollection();
+    bool reset = ob_get_b(options, L"reset");
     
-    image_format_t image_format = get_image_format(options);
+    if(ob_is_defined(options, L"enabled"))
+    {
+        statistics.enabled = ob_get_b(options, L"enabled");
+    }
     
-    bool export_tags = ob_get_b(options, L"tags");
+    ob_set_b(returnValue, L"enabled", statistics.enabled);
     
-    if(export_tags)
+    /* histogram[n] counts the calls that took up to 2^n microseconds; the last one, any longer */
+    PA_CollectionRef colBounds = PA_CreateCollection();
+    
+    for(size_t i = 0; i < (STATISTICS_BUCKETS - 1); ++i)
     {
-        colTags = PA_CreateCollection();
+        PA_Variable v = PA_CreateVariable(eVK_Real);
+        PA_SetRealVariable(&v, (double)(1ULL << i));
+        PA_SetCollectionElement(colBounds, i, v);
+        PA_ClearVariable(&v);
     }
     
-    int images_count = (int)ob_get_n(options, L"count");/* default:-1 */
+    ob_set_c(returnValue, L"bounds", colBounds);
     
-    if(h)
+    PA_CollectionRef colCommands = PA_CreateCollection();
+    
+    for(size_t i = 1; i < STATISTICS_COMMANDS; ++i)
     {
-        PA_long32 size = PA_GetHandleSize(h);
+        if(!command_names[i])
+            continue;
         
-        imebra::ReadMemory mem((const char *)PA_LockHandle(h), size);
-        imebra::MemoryStreamInput input(mem);
-        imebra::StreamReader reader(input);
+        stage_statistics_values_t values;
+        statistics_collect(true, i, reset, &values);
         
-        std::unique_ptr<imebra::DataSet> data(imebra::CodecFactory::load(reader));
-
-        /* get tags */
-        if(export_tags)
-        {
-            imebra::tagsIds_t tags = data->getTags();
-            for (imebra::tagsIds_t::iterator it = tags.begin() ; it != tags.end(); ++it)
-            {
-                imebra::TagId t = *it;
-                
-                //tag properties
-                std::uint16_t tagId = t.getTagId();
-                std::uint16_t groupId = t.getGroupId();
-                std::uint32_t groupOrder = t.getGroupOrder();
-                
-                imebra::Tag *tag = data->getTag(t);
-                imebra::tagVR_t dataType = tag->getDataType();
-                std::wstring tagDataTypeName;
-                tagDataTypeName += ((int)dataType >> 8);
-                tagDataTypeName += ((int)dataType&0xFF);
-                
-                size_t bufferId = 0;
-                while (data->bufferExists(t, bufferId))
-                {
-                    PA_Variable vObj = PA_CreateVariable(eVK_Object);
-                    PA_ObjectRef objTag = PA_CreateObject();
-                    
-                    ob_set_a(objTag, L"type", tagDataTypeName.c_str());
-                    ob_set_a(objTag, L"value", data->getUnicodeString(t, bufferId, L"").c_str());
-                    
-                    ob_set_i(objTag, L"id", tagId);
-                    ob_set_i(objTag, L"group", groupId);
-                    ob_set_i(objTag, L"order", groupOrder);
-                    ob_set_i(objTag, L"index", bufferId);
-                    
-                    PA_SetObjectVariable(&vObj, objTag);
-                    PA_SetCollectionElement(colTags, PA_GetCollectionLength(colTags), vObj);
-                    
-                    PA_ClearVariable(&vObj);
-                    
-                    bufferId++;
-                }
-            }
-        }
-
-        /* get images */
-        size_t page = 0;
-        imebra::Image *image;
-
-        do
-        {
-            if((images_count < 0) || (images_count > page))
-            {
-                image = NULL;
-                try{
-                    image = data->getImageApplyModalityTransform(page);
-                }catch(...)
-                {
-                    break;
-                }
-                
-                if(image)
-                {
-                    page++;
-                    
-                    std::string colorSpace = imebra::ColorTransformsFactory::normalizeColorSpace(image->getColorSpace());
-                    std::uint32_t width = image->getWidth();
-                    std::uint32_t height = image->getHeight();
-                    
-                    PA_Variable vObj = PA_CreateVariable(eVK_Object);
-                    PA_ObjectRef objImage = PA_CreateObject();
-                    
-                    ob_set_i(objImage, L"width", width);
-                    ob_set_i(objImage, L"height", height);
-                    ob_set_s(objImage, L"colorspace", colorSpace.c_str());
-                    
-                    std::unique_ptr<imebra::ReadingDataHandlerNumeric> dataHandler(image->getReadingDataHandler());
-                    
-                    /* retrive image */
-                    imebra::TransformsChain chain;
-
-                    size_t requestedBufferSize = 0;
-                    bool gotBitmap = false;
-                    
-                    imebra::DrawBitmap draw(chain);
-                    
-                    if(imebra::ColorTransformsFactory::isMonochrome(image->getColorSpace()))
-                    {
-                        imebra::VOILUT voilutTransform;
-                        imebra::vois_t vois = data->getVOIs();
-                        std::list<std::shared_ptr<imebra::LUT> > luts;
-                        for(size_t scanLUTs(0); ; ++scanLUTs)
-                        {
-                            try
-                            {
-                                luts.push_back((std::shared_ptr<imebra::LUT>)data->getLUT(imebra::TagId(imebra::tagId_t::VOILUTSequence_0028_3010), scanLUTs));
-                            }
-                            catch(...)
-                            {
-                                break;
-                            }
-                        }
-                        if(!vois.empty())
-                        {
-                            voilutTransform.setCenterWidth(vois[0].center, vois[0].width);
-                        }
-                        else if(!luts.empty())
-                        {
-                            voilutTransform.setLUT(*(luts.front().get()));
-                        }
-                        else
-                        {
-                            voilutTransform.applyOptimalVOI(*image, 0, 0, width, height);
-                        }
-                        chain.addTransform(voilutTransform);
-                        imebra::DrawBitmap draw(chain);
-                        gotBitmap = true;
-                        
-                    }else
-                    {
-                        if(colorSpace != "RGB")
-                        {
-                            imebra::Transform *colorSpaceTransform = imebra::ColorTransformsFactory::getTransform(colorSpace, "RGB");
-                            chain.addTransform(*colorSpaceTransform);
-                            
-                            gotBitmap = true;
-                            
-                        }
-                    }
-                    
-                    std::vector<char> buffer;
-                    
-                    if(gotBitmap)
-                    {
-                        requestedBufferSize = draw.getBitmap(*image, imebra::drawBitmapType_t::drawBitmapRGBA, 4, 0, 0);
-                        buffer.resize(requestedBufferSize, char(0));
-                        
-                        try{
-                            draw.getBitmap(*image, imebra::drawBitmapType_t::drawBitmapRGBA, 4, (char *)&(buffer.at(0)), requestedBufferSize);
-                        }catch(...)
-                        {
-                            gotBitmap = 0;
-                        }
-                    }
-                    
-                    if(gotBitmap)
-                    {
-                        bitmap_file_header bfh;
-                        bitmap_image_header bih;
-                        
-                        int file_size = sizeof_bitmap_file_header + sizeof_bitmap_image_header + requestedBufferSize;
-                        int offset_bits = sizeof_bitmap_file_header + sizeof_bitmap_image_header;
-                        
-                        memcpy(&bfh.bitmap_type, "BM", 2);
-                        
-                        bfh.file_size       = file_size;
-                        bfh.reserved1       = 0;
-                        bfh.reserved2       = 0;
-                        bfh.offset_bits     = offset_bits;
-                        
-                        bih.size_header     = sizeof_bitmap_image_header;
-                        bih.width           = width;
-                        bih.height          = height;
-                        bih.planes          = 1;
-                        bih.bit_count       = 32;
-                        bih.compression     = 0;
-                        bih.image_size      = 0;
-                        bih.ppm_x           = 0;
-                        bih.ppm_y           = 0;
-                        bih.clr_used        = 0;
-                        bih.clr_important   = 0;
-                        
-                        std::vector<char> _buffer;
-                        _buffer.resize(
-                                       sizeof_bitmap_file_header
-                                       +sizeof_bitmap_image_header
-                                       +requestedBufferSize, char(0));
-                        
-                        memcpy(&(_buffer.at(0)), &bfh, sizeof_bitmap_file_header);
-                        memcpy(&(_buffer.at(sizeof_bitmap_file_header)), &bih, sizeof_bitmap_image_header);
-                        memcpy(&(_buffer.at(sizeof_bitmap_file_header+sizeof_bitmap_image_header)), &(buffer.at(0)), requestedBufferSize);
-                        
-
-                        switch (image_format) {
-                            case image_format_png:
-                            case image_format_jpg:
-                            case image_format_gif:
-                            case image_format_tiff:
-                            case image_format_wbmp:
-                            case image_format_webp:
-                            {
-                                gdImagePtr gd_in = gdImageCreateFromBmpPtr(_buffer.size(), (void *)&_buffer.at(0));
-                                if(gd_in)
-                                {
-                                    get_image(gd_in, objImage, options);
-                                    gdImageDestroy(gd_in);
-                                }
-                            }
-                                break;
-                            default:
-                            {
-                                if ((int)ob_get_n(options, L"quality") != 0)
-                                {
-                                    gdImagePtr gd_in = gdImageCreateFromBmpPtr(_buffer.size(), (void *)&_buffer.at(0));
-                                    if(gd_in)
-                                    {
-                                        get_image(gd_in, objImage, options);
-                                        gdImageDestroy(gd_in);
-                                    }
-                                }else
-                                {
-                                    PA_Picture picture = PA_CreatePicture((void *)&_buffer.at(0), _buffer.size());
-                                    ob_set_p(objImage, L"image", picture);
-                                    ob_set_a(objImage, L"format", L".bmp");
-                                    ob_set_i(objImage, L"size", _buffer.size());
-                                    ob_set_i(objImage, L"compression", 0);
-                                }
-                            }
-                                break;
-                        }
-                        
-                    }
-                    
-                    PA_SetObjectVariable(&vObj, objImage);
-                    PA_SetCollectionElement(colImages, PA_GetCollectionLength(colImages), vObj);
-                    PA_ClearVariable(&vObj);
-                }
-
-            }else{break;}
-
-        }while(image);
+        if(!values.calls)
+            continue;
         
-        PA_UnlockHandle(h);
+        PA_Variable vObj = PA_CreateVariable(eVK_Object);
+        PA_ObjectRef objCommand = PA_CreateObject();
+        
+        ob_set_a(objCommand, L"command", command_names[i]);
+        set_statistics_stage(values, objCommand);
+        
+        PA_SetObjectVariable(&vObj, objCommand);
+        PA_SetCollectionElement(colCommands, PA_GetCollectionLength(colCommands), vObj);
+        PA_ClearVariable(&vObj);
     }
-
-    if(export_tags)
+    
+    ob_set_c(returnValue, L"commands", colCommands);
+    
+    stage_statistics_values_t stages[stage_count];
+    
+    for(int i = 0; i < stage_count; ++i)
     {
-       ob_set_c(returnValue, L"tags", colTags);
+        statistics_collect(false, i, reset, &stages[i]);
     }
-
-    ob_set_c(returnValue, L"images", colImages);
     
-    PA_ReturnObject( params, returnValue );
-}
-
-void Imebra_Apply_filters(PA_PluginParameters params){
+    /* loaded from BLOBs, and returned in result objects */
+    ob_set_n(returnValue, L"bytesIn", (double)stages[stage_load].bytes);
+    ob_set_n(returnValue, L"bytesOut", (double)stages[stage_objects].bytes);
     
-    PA_ObjectRef returnValue = PA_CreateObject();
+    PA_ObjectRef objStages = PA_CreateObject();
     
-    PA_Handle h = PA_GetBlobHandleParameter( params, 1 );
-    PA_ObjectRef options = PA_GetObjectParameter( params, 2 );
-
+    for(int i = 0; i < stage_count; ++i)
+    {
+        PA_ObjectRef objStage = PA_CreateObject();
+        set_statistics_stage(stages[i], objStage);
+        ob_set_o(objStages, stage_names[i], objStage);
+    }
+    
+    ob_set_o(returnValue, L"stages", objStages);
+    
+    PA_CollectionRef colFrames = PA_CreateCollection();
+    
+    for(size_t i = 0; get_transfer_syntax(i); ++i)
+    {
+        std::uint64_t count = statistics_read(statistics.frames[i], reset);
+        
+        if(!count)
+            continue;
+        
+        PA_Variable vObj = PA_CreateVariable(eVK_Object);
+        PA_ObjectRef objFrames = PA_CreateObject();
+        
+        ob_set_s(objFrames, L"transferSyntax", get_transfer_syntax(i));
+        ob_set_n(objFrames, L"count", (double)count);
+        
+        PA_SetObjectVariable(&vObj, objFrames);
+        PA_SetCollectionElement(colFrames, PA_GetCollectionLength(colFrames), vObj);
+        PA_ClearVariable(&vObj);
+    }
+    
+    ob_set_c(returnValue, L"frames", colFrames);
+    
+    PA_ObjectRef objCache = PA_CreateObject();
+    PA_ObjectRef objFrameCache = PA_CreateObject();
+    PA_ObjectRef objResultCache = PA_CreateObject();
+    
+    set_statistics_ratio(statistics.frame_cache_hits, statistics.frame_cache_misses, reset, objFrameCache);
+    set_statistics_ratio(statistics.result_cache_hits, statistics.result_cache_misses, reset, objResultCache);
+    
+    ob_set_o(objCache, L"frames", objFrameCache);
+    ob_set_o(objCache, L"results", objResultCache);
+    ob_set_o(returnValue, L"cache", objCache);
+    
+    PA_ReturnObject( params, returnValue );
+}
+
+/* enabled:true starts a new trace, path writes the spans recorded since then */
+
+void Imebra_Trace(PA_PluginParameters params){
+    
+    PA_ObjectRef returnValue = PA_CreateObject();
+    
+    PA_ObjectRef options = PA_GetObjectParameter( params, 1 );
+    
+    if(ob_is_defined(options, L"enabled"))
+    {
+        bool enabled = ob_get_b(options, L"enabled");
+        
+        if((enabled) && (!trace_enabled))
+        {
+            trace_origin = trace_ns(std::chrono::steady_clock::now());
+        }
+        
+        trace_enabled = enabled;
+    }
+    
+    path_t path;
+    
+    if(get_path(options, path))
+    {
+#if VERSIONWIN
+        FILE *f = _wfopen(path.c_str(), L"wb");
+#else
+        FILE *f = fopen(path.c_str(), "wb");
+#endif
+        if(f)
+        {
+            std::uint64_t origin = trace_origin;
+            trace_origin = trace_ns(std::chrono::steady_clock::now());
+            
+            ob_set_n(returnValue, L"events", (double)trace_write(f, origin, command_names));
+            fclose(f);
+        }else
+        {
+            ob_set_s(returnValue, L"error", "failed to open file");
+        }
+    }
+    
+    ob_set_b(returnValue, L"enabled", trace_enabled);
+    
+    PA_ReturnObject( params, returnValue );
+}
+
+/*
+ threadBudget: bytes each thread keeps for itself, 0=no thread tier;
+ sharedBudget: bytes the threads pass on to each other, 0=no shared tier.
+ */
+
+void Imebra_Memory_pool(PA_PluginParameters params){
+    
+    PA_ObjectRef returnValue = PA_CreateObject();
+    
+    PA_ObjectRef options = PA_GetObjectParameter( params, 1 );
+    
+    bool flush = ob_get_b(options, L"flush");
+    bool reset = ob_get_b(options, L"reset");
+    
+    if(ob_is_defined(options, L"threadBudget"))
+    {
+        double budget = ob_get_n(options, L"threadBudget");
+        buffer_pool.thread_budget = budget > 0 ? (size_t)budget : 0;
+        //bytes per thread, 0=no thread tier
+        flush = true;
+    }
+    
+    if(ob_is_defined(options, L"sharedBudget"))
+    {
+        double budget = ob_get_n(options, L"sharedBudget");
+        buffer_pool.shared_budget = budget > 0 ? (size_t)budget : 0;
+        //bytes, 0=no shared tier
+    }
+    
+    /* blocks kept under a larger budget are not trimmed one by one */
+    if((flush) || (buffer_pool.shared_bytes > buffer_pool.shared_budget))
+    {
+        buffer_pool_flush();
+    }
+    
+    ob_set_n(returnValue, L"threadBudget", (double)buffer_pool.thread_budget);
+    ob_set_n(returnValue, L"sharedBudget", (double)buffer_pool.shared_budget);
+    ob_set_n(returnValue, L"threadBytes", (double)buffer_pool.thread_bytes);
+    ob_set_n(returnValue, L"sharedBytes", (double)buffer_pool.shared_bytes);
+    
+    /* acquired from the thread's own blocks, the shared tier, or malloc */
+    PA_ObjectRef objAcquired = PA_CreateObject();
+    ob_set_n(objAcquired, L"thread", (double)statistics_read(buffer_pool.thread_hits, reset));
+    ob_set_n(objAcquired, L"shared", (double)statistics_read(buffer_pool.shared_hits, reset));
+    ob_set_n(objAcquired, L"misses", (double)statistics_read(buffer_pool.misses, reset));
+    ob_set_o(returnValue, L"acquired", objAcquired);
+    
+    /* kept by the releasing thread, passed to the shared tier, or freed */
+    PA_ObjectRef objReleased = PA_CreateObject();
+    ob_set_n(objReleased, L"thread", (double)statistics_read(buffer_pool.thread_releases, reset));
+    ob_set_n(objReleased, L"shared", (double)statistics_read(buffer_pool.shared_releases, reset));
+    ob_set_n(objReleased, L"freed", (double)statistics_read(buffer_pool.frees, reset));
+    ob_set_o(returnValue, L"released", objReleased);
+    
+    PA_ReturnObject( params, returnValue );
+}
+
+#pragma mark -
+
+/* options.path: HFS or POSIX on mac, native on windows */
+
+bool get_path(PA_ObjectRef options, path_t& path){
+    
+    CUTF8String u8;
+    ob_get_a(options, L"path", &u8);
+    
+    return get_path(u8, path);
+}
+
+bool get_path(CUTF8String& u8, path_t& path){
+    
+    if(!u8.length())
+        return false;
+    
+    C_TEXT t;
+    t.setUTF8String(&u8);
+    
+#if VERSIONWIN
+    path = std::wstring((const wchar_t *)t.getUTF16StringPtr(), t.getUTF16Length());
+#else
+    CUTF8String posix(u8);
+    if(posix[0] != '/')
+    {
+        t.copyPath(&posix);
+    }
+    path = std::string((const char *)posix.c_str());
+#endif
+    
+    return path.length();
+}
+
+imebra::DataSet *load_dataset(PA_Handle h, PA_ObjectRef options, size_t maxSizeBufferLoad){
+    
+    imebra::DataSet *data = NULL;
+    
+    path_t path;
+    
+    try
+    {
+        if(get_path(options, path))
+        {
+            data = load_dataset(path, maxSizeBufferLoad);
+            
+        }else if(h)
+        {
+            PA_long32 size = PA_GetHandleSize(h);
+            
+            /* ReadMemory takes a copy, the handle can be released right away */
+            imebra::ReadMemory mem((const char *)PA_LockHandle(h), size);
+            PA_UnlockHandle(h);
+            
+            data = load_dataset(mem);
+        }
+    }
+    catch(...)
+    {
+        data = NULL;
+    }
+    
+    return data;
+}
+
+#pragma mark -
+
+void get_request_options(PA_ObjectRef options, request_options_t *request){
+    
+    get_image_options(options, &request->image_options);
+    
+    request->export_tags = ob_get_b(options, L"tags") || ob_is_defined(options, L"tagList");
+    request->use_tag_list = ob_is_defined(options, L"tagList");
+    
+    if(request->export_tags)
+    {
+        get_tag_options(options, &request->tag_options);
+        get_tag_list(options, request->tag_list);
+    }
+    
+    /* json:true or "text" returns DICOM JSON as text, json:"blob" as BLOB */
+    request->json_output = json_none;
+    
+    if(ob_is_defined(options, L"json"))
+    {
+        CUTF8String json;
+        ob_get_a(options, L"json", &json);
+        
+        if(json == (const uint8_t *)"blob")
+        {
+            request->json_output = json_blob;
+        }else if((json == (const uint8_t *)"text") || (ob_get_b(options, L"json")))
+        {
+            request->json_output = json_text;
+        }
+        
+        CUTF8String bulkDataURI;
+        ob_get_a(options, L"bulkDataURI", &bulkDataURI);
+        request->bulk_uri = std::string((const char *)bulkDataURI.c_str());
+    }
+    
+    get_frame_selection(options, &request->frame_selection);
+    
+    request->max_size_buffer_load = FILE_BUFFER_LOAD;
+    
+    if(ob_is_defined(options, L"maxSizeBufferLoad"))
+    {
+        int n = (int)ob_get_n(options, L"maxSizeBufferLoad");
+        request->max_size_buffer_load = n > 0 ? n : std::numeric_limits<size_t>::max();
+        //0=load everything
+    }
+    
+    request->tag_options.max_size_buffer_load = request->max_size_buffer_load;
+    
+    request->cache = true;
+    
+    if(ob_is_defined(options, L"cache"))
+    {
+        request->cache = ob_get_b(options, L"cache");
+        //false=bypass the frame cache
+    }
+    
+    request->threads = 1;/* default:1, 0=one per core */
+    
+    if(ob_is_defined(options, L"threads"))
+    {
+        int n = (int)ob_get_n(options, L"threads");
+        request->threads = n > 0 ? n : std::thread::hardware_concurrency();
+    }
+    
+    request->profile = ob_get_b(options, L"profile");
+}
+
+void set_result(dataset_result_t& result, const request_options_t& request, PA_ObjectRef objResult){
+    
+    imebra::DataSet *data = result.data.get();
+    
+    profile_t *profile = request.profile ? &result.profile : NULL;
+    stage_time_t start = profile_begin(profile);
+    
+    size_t bytes = result.json.length();
+    for(std::vector<render_frame_t>::const_iterator it = result.frames.begin(); it != result.frames.end(); ++it)
+    {
+        bytes += it->image.size + it->raw.size;
+    }
+    
+    /* get tags */
+    if(request.export_tags)
+    {
+        PA_CollectionRef colTags = PA_CreateCollection();
+        const path_t *source = result.path.length() ? &result.path : NULL;
+        
+        if(request.use_tag_list)
+        {
+            /* only the requested elements */
+            get_tags(data, request.tag_list, request.tag_options, source, colTags);
+        }else
+        {
+            get_tags(data, request.tag_options, source, colTags);
+        }
+        
+        ob_set_c(objResult, L"tags", colTags);
+    }
+    
+    /* get json */
+    if(request.json_output == json_blob)
+    {
+        ob_set_x(objResult, L"json", result.json.data(), result.json.length());
+    }else if(request.json_output == json_text)
+    {
+        ob_set_s(objResult, L"json", result.json.c_str());
+    }
+    
+    /* get images */
+    PA_CollectionRef colImages = PA_CreateCollection();
+    
+    set_images(result.frames, result.windowing, request.image_options, colImages);
+    
+    ob_set_c(objResult, L"images", colImages);
+    
+    profile_end(profile, stage_objects, start, bytes);
+    
+    if(profile)
+    {
+        set_profile(result, objResult);
+    }
+}
+
+void set_image_object(render_frame_t& frame, const windowing_t& windowing, const image_options_t& image_options, PA_ObjectRef objImage){
+    
+    ob_long_t values[] = {
+        {L"frame", (PA_long32)frame.frame},
+        {L"width", (PA_long32)frame.width},
+        {L"height", (PA_long32)frame.height}};
+    ob_set_i(objImage, values, sizeof(values) / sizeof(values[0]));
+    ob_set_s(objImage, L"colorspace", frame.colorSpace.c_str());
+    
+    if(image_options.output == output_raw)
+    {
+        set_raw(frame, windowing, image_options.rescale, objImage);
+        
+        /* release imebra's buffer as soon as it has been copied */
+        frame.raw.handler.reset();
+        frame.raw.image.reset();
+        
+    }else if(frame.image.size)
+    {
+        set_image(frame.image, objImage);
+    }
+}
+
+/* objects are created on the calling process, in the requested order */
+
+void set_images(std::vector<render_frame_t>& frames, const windowing_t& windowing, const image_options_t& image_options, PA_CollectionRef colImages){
+    
+    for(std::vector<render_frame_t>::iterator it = frames.begin(); it != frames.end(); ++it)
+    {
+        if(!it->decoded)
+            continue;
+        
+        PA_Variable vObj = PA_CreateVariable(eVK_Object);
+        PA_ObjectRef objImage = PA_CreateObject();
+        
+        set_image_object(*it, windowing, image_options, objImage);
+        
+        PA_SetObjectVariable(&vObj, objImage);
+        PA_SetCollectionElement(colImages, PA_GetCollectionLength(colImages), vObj);
+        PA_ClearVariable(&vObj);
+    }
+}
+
+#pragma mark -
+
+void Imebra_Get_images(PA_PluginParameters params){
+    
+    PA_ObjectRef returnValue = PA_CreateObject();
+    
+    PA_Handle h = PA_GetBlobHandleParameter( params, 1 );
+    PA_ObjectRef options = PA_GetObjectParameter( params, 2 );
+    
+    request_options_t request;
+    get_request_options(options, &request);
+    
+    batch_item_t item;
+    
+    if((!get_path(options, item.path)) && (h))
+    {
+        PA_long32 size = PA_GetHandleSize(h);
+        item.memory.reset(new imebra::ReadMemory((const char *)PA_LockHandle(h), size));
+        PA_UnlockHandle(h);
+    }
+    
+    dataset_result_t result;
+    
+    if((process_item(item, request, &result)) && ((result.data) || (result.cached)))
+    {
+        set_result(result, request, returnValue);
+    }else
+    {
+        ob_set_c(returnValue, L"images", PA_CreateCollection());
+    }
+    
+    PA_ReturnObject( params, returnValue );
+}
+
+void Imebra_Batch(PA_PluginParameters params){
+    
+    PA_ObjectRef returnValue = PA_CreateObject();
+    
+    PA_ObjectRef options = PA_GetObjectParameter( params, 1 );
+    
+    request_options_t request;
+    get_request_options(options, &request);
+    
+    if(!ob_is_defined(options, L"threads"))
+    {
+        request.threads = std::thread::hardware_concurrency();/* default:one per core */
+    }
+    
+    std::vector<batch_item_t> items;
+    get_batch_items(options, items);
+    
+    std::vector<dataset_result_t> results(items.size());
+    
+    run_batch(items, results, request, NULL);
+    
+    PA_CollectionRef colResults = PA_CreateCollection();
+    
+    set_batch_results(results, request, colResults);
+    
+    ob_set_c(returnValue, L"results", colResults);
+    
+    PA_ReturnObject( params, returnValue );
+}
+
+#pragma mark -
+
+void Imebra_Start_job(PA_PluginParameters params){
+    
+    PA_Handle h = PA_GetBlobHandleParameter( params, 1 );
+    PA_ObjectRef options = PA_GetObjectParameter( params, 2 );
+    
+    std::shared_ptr<job_t> job(new job_t);
+    
+    get_request_options(options, &job->request);
+    
+    /* options.items as in Imebra Batch, or the BLOB/path as in Imebra Get images */
+    if(ob_is_defined(options, L"items"))
+    {
+        if(!ob_is_defined(options, L"threads"))
+        {
+            job->request.threads = std::thread::hardware_concurrency();
+        }
+        get_batch_items(options, job->items);
+    }else
+    {
+        batch_item_t item;
+        
+        if((!get_path(options, item.path)) && (h))
+        {
+            PA_long32 size = PA_GetHandleSize(h);
+            item.memory.reset(new imebra::ReadMemory((const char *)PA_LockHandle(h), size));
+            PA_UnlockHandle(h);
+        }
+        
+        job->items.push_back(item);
+    }
+    
+    PA_ReturnLong( params, start_job(job) );
+}
+
+void Imebra_Poll_job(PA_PluginParameters params){
+    
+    PA_ObjectRef returnValue = PA_CreateObject();
+    
+    PA_long32 id = PA_GetLongParameter( params, 1 );
+    
+    std::shared_ptr<job_t> job = get_job(id);
+    
+    if(job)
+    {
+        const wchar_t *state = L"running";
+        
+        if(job->done)
+        {
+            state = job->progress.cancel ? L"cancelled" : L"done";
+        }
+        
+        ob_set_a(returnValue, L"state", state);
+        
+        ob_long_t values[] = {
+            {L"id", id},
+            {L"items", (PA_long32)job->items.size()},
+            {L"itemsLoaded", (PA_long32)job->progress.items_loaded},
+            {L"frames", (PA_long32)job->progress.frames_total},
+            {L"framesDone", (PA_long32)job->progress.frames_done}};
+        ob_set_i(returnValue, values, sizeof(values) / sizeof(values[0]));
+        ob_set_n(returnValue, L"bytes", (double)job->progress.bytes);
+    }else
+    {
+        ob_set_a(returnValue, L"state", L"unknown");
+    }
+    
+    PA_ReturnObject( params, returnValue );
+}
+
+void Imebra_Cancel_job(PA_PluginParameters params){
+    
+    PA_long32 id = PA_GetLongParameter( params, 1 );
+    
+    std::shared_ptr<job_t> job = get_job(id);
+    
+    if(job)
+    {
+        job->progress.cancel = true;
+    }
+}
+
+/* waits for the job to finish, returns its results and forgets it */
+
+void Imebra_Collect_job(PA_PluginParameters params){
+    
+    PA_ObjectRef returnValue = PA_CreateObject();
+    
+    PA_long32 id = PA_GetLongParameter( params, 1 );
+    
+    std::shared_ptr<job_t> job = collect_job(id);
+    
+    if(job)
+    {
+        PA_CollectionRef colResults = PA_CreateCollection();
+        
+        set_batch_results(job->results, job->request, colResults);
+        
+        ob_set_c(returnValue, L"results", colResults);
+        ob_set_b(returnValue, L"cancelled", job->progress.cancel);
+    }
+    
+    PA_ReturnObject( params, returnValue );
+}
+
+void set_batch_results(std::vector<dataset_result_t>& results, const request_options_t& request, PA_CollectionRef colResults){
+    
+    for(size_t i = 0; i < results.size(); ++i)
+    {
+        PA_Variable vObj = PA_CreateVariable(eVK_Object);
+        PA_ObjectRef objResult = PA_CreateObject();
+        
+        ob_set_i(objResult, L"index", i);
+        
+        if(results[i].error.empty())
+        {
+            set_result(results[i], request, objResult);
+        }else
+        {
+            ob_set_s(objResult, L"error", results[i].error.c_str());
+        }
+        
+        /* datasets are released as soon as their objects are built */
+        results[i].data.reset();
+        
+        PA_SetObjectVariable(&vObj, objResult);
+        PA_SetCollectionElement(colResults, PA_GetCollectionLength(colResults), vObj);
+        PA_ClearVariable(&vObj);
+    }
+}
+
+#pragma mark -
+
+/* timeout: seconds idle before the handle is released, even if no other command is called; 0=never */
+
+void Imebra_Open(PA_PluginParameters params){
+    
+    PA_Handle h = PA_GetBlobHandleParameter( params, 1 );
+    PA_ObjectRef options = PA_GetObjectParameter( params, 2 );
+    
+    std::string key;
+    path_t path;
+    
+    if(get_path(options, path))
+    {
+        get_cache_key(path, key);
+    }else if(h)
+    {
+        get_cache_key((const char *)PA_LockHandle(h), PA_GetHandleSize(h), key);
+        PA_UnlockHandle(h);
+    }
+    
+    int timeout = SESSION_TIMEOUT;
+    
+    if(ob_is_defined(options, L"timeout"))
+    {
+        timeout = std::max(0, (int)ob_get_n(options, L"timeout"));
+        //seconds, 0=never
+    }
+    
+    PA_long32 id = open_session(key, timeout, [&](session_t *session) -> bool {
+        
+        size_t maxSizeBufferLoad = FILE_BUFFER_LOAD;
+        
+        if(ob_is_defined(options, L"maxSizeBufferLoad"))
+        {
+            int n = (int)ob_get_n(options, L"maxSizeBufferLoad");
+            maxSizeBufferLoad = n > 0 ? n : std::numeric_limits<size_t>::max();
+        }
+        
+        stage_time_t start = profile_begin(NULL);
+        session->data.reset(load_dataset(h, options, maxSizeBufferLoad));
+        profile_end(NULL, stage_load, start, h ? PA_GetHandleSize(h) : 0);
+        
+        if(!session->data)
+            return false;
+        
+        session->frames_count = session->data->getUnsignedLong(imebra::TagId(imebra::tagId_t::NumberOfFrames_0028_0008), 0, 1);
+        get_windowing(session->data.get(), &session->windowing);
+        
+        return true;
+    });
+    
+    PA_ReturnLong( params, id );
+}
+
+/* frame, then center+width, voi or lut to override the window of the dataset */
+
+void Imebra_Render(PA_PluginParameters params){
+    
+    PA_ObjectRef returnValue = PA_CreateObject();
+    
+    PA_long32 id = PA_GetLongParameter( params, 1 );
+    PA_ObjectRef options = PA_GetObjectParameter( params, 2 );
+    
+    std::shared_ptr<session_t> session = get_session(id);
+    
+    if(session)
+    {
+        image_options_t image_options;
+        get_image_options(options, &image_options);
+        
+        size_t page = 0;
+        
+        if(ob_is_defined(options, L"frame"))
+        {
+            page = (size_t)std::max(0, (int)ob_get_n(options, L"frame"));
+        }
+        
+        if(page < session->frames_count)
+        {
+            windowing_t windowing = session->windowing;
+            
+            if((ob_is_defined(options, L"center")) && (ob_is_defined(options, L"width")))
+            {
+                imebra::VOIDescription voi;
+                voi.center = ob_get_n(options, L"center");
+                voi.width = ob_get_n(options, L"width");
+                
+                windowing.vois.assign(1, voi);
+                windowing.luts.clear();
+                windowing.table_ready = false;
+                
+            }else if(ob_is_defined(options, L"voi"))
+            {
+                size_t voi = (size_t)std::max(0, (int)ob_get_n(options, L"voi"));
+                if(voi < windowing.vois.size())
+                {
+                    windowing.vois.assign(1, session->windowing.vois[voi]);
+                    windowing.luts.clear();
+                    windowing.table_ready = false;
+                }
+            }else if(ob_is_defined(options, L"lut"))
+            {
+                size_t lut = (size_t)std::max(0, (int)ob_get_n(options, L"lut"));
+                if(lut < windowing.luts.size())
+                {
+                    std::list<std::shared_ptr<imebra::LUT> >::const_iterator selected = session->windowing.luts.begin();
+                    std::advance(selected, lut);
+                    windowing.vois.clear();
+                    windowing.luts.assign(1, *selected);
+                    windowing.table_ready = false;
+                }
+            }
+            
+            render_frame_t frame;
+            frame.frame = page;
+            frame.decoded = false;
+            frame.image.size = 0;
+            frame.raw.size = 0;
+            frame.source_modality = get_frame_modality(image_options, windowing);
+            
+            /* decoded without a lock and kept in the frame cache, within its budget, under the key of the input */
+            render_frame(session->data.get(), page, windowing, image_options, session->key, &frame);
+            
+            if(frame.decoded)
+            {
+                stage_time_t start = profile_begin(NULL);
+                set_image_object(frame, windowing, image_options, returnValue);
+                profile_end(NULL, stage_objects, start, frame.image.size + frame.raw.size);
+            }
+        }
+    }
+    
+    PA_ReturnObject( params, returnValue );
+}
+
+void Imebra_Close(PA_PluginParameters params){
+    
+    PA_long32 id = PA_GetLongParameter( params, 1 );
+    
+    close_session(id);
+}
+
+void Imebra_Probe(PA_PluginParameters params){
+    
+    PA_ObjectRef returnValue = PA_CreateObject();
+    
+    PA_Handle h = PA_GetBlobHandleParameter( params, 1 );
+    PA_ObjectRef options = PA_GetObjectParameter( params, 2 );
+    
+    path_t path;
+    
+    if(get_path(options, path))
+    {
+        /* elements past the first PROBE_BUFFER_LOAD bytes stay on disk */
+        try
+        {
+            std::unique_ptr<imebra::DataSet> data(imebra::CodecFactory::load(path, PROBE_BUFFER_LOAD));
+            
+            get_probe(data.get(), returnValue);
+        }
+        catch(...)
+        {
+            
+        }
+    }else if(h)
+    {
+        PA_long32 size = PA_GetHandleSize(h);
+        const char *p = (const char *)PA_LockHandle(h);
+        
+        /* only the elements before the pixel data are copied and parsed */
+        size_t header_size = find_pixel_data_offset((const unsigned char *)p, size);
+        
+        try
+        {
+            imebra::ReadMemory mem(p, header_size);
+            imebra::MemoryStreamInput input(mem);
+            imebra::StreamReader reader(input);
+            
+            std::unique_ptr<imebra::DataSet> data(imebra::CodecFactory::load(reader, PROBE_BUFFER_LOAD));
+            
+            get_probe(data.get(), returnValue);
+            
+            if(header_size < (size_t)size)
+            {
+                ob_set_i(returnValue, L"pixelDataOffset", header_size);
+            }
+        }
+        catch(...)
+        {
+            
+        }
+        
+        PA_UnlockHandle(h);
+    }
+    
+    PA_ReturnObject( params, returnValue );
+}
+
+void Imebra_Apply_filters(PA_PluginParameters params){
+    
+    PA_ObjectRef returnValue = PA_CreateObject();
+    
+    PA_Handle h = PA_GetBlobHandleParameter( params, 1 );
+    PA_ObjectRef options = PA_GetObjectParameter( params, 2 );
+
     PA_CollectionRef colImages = PA_CreateCollection();
     PA_CollectionRef colAppliedFilters = PA_CreateCollection();
     
@@ -611,86 +1466,610 @@ void Imebra_Apply_filters(PA_PluginParameters params){
         PA_long32 size = PA_GetHandleSize(h);
         void *p = PA_LockHandle(h);
         
-        gdImagePtr gd_in = NULL;
-        
         PA_Variable vObj0 = PA_CreateVariable(eVK_Object);
         PA_Variable vObj1 = PA_CreateVariable(eVK_Object);
         PA_ObjectRef objImage0 = PA_CreateObject();
         PA_ObjectRef objImage1 = PA_CreateObject();
         
-        switch (image_format) {
-            case image_format_png:
-                gd_in = gdImageCreateFromPngPtr(size, p);
-                break;
-            case image_format_jpg:
-                gd_in = gdImageCreateFromJpegPtr(size, p);
-                break;
-            case image_format_gif:
-                gd_in = gdImageCreateFromGifPtr(size, p);
-                break;
-            case image_format_tiff:
-                gd_in = gdImageCreateFromTiffPtr(size, p);
-                break;
-            case image_format_wbmp:
-                gd_in = gdImageCreateFromWBMPPtr(size, p);
-                break;
-            case image_format_webp:
-                gd_in = gdImageCreateFromWebpPtr(size, p);
-                break;
-            default:
-                gd_in = gdImageCreateFromBmpPtr(size, p);
+        gdImagePtr gd_in = decode_image(image_format, p, size);
+        
+        if(gd_in)
+        {
+            PA_CollectionRef colFilters = ob_get_c(options, L"filters");
+            
+            if(colFilters)
+            {
+                PA_long32 len = PA_GetCollectionLength(colFilters);
+                
+                if(len < 2)
+                {
+                    get_image(gd_in, objImage0, options);//return original image in #0
+                    
+                    if(len == 1)
+                    {
+                        apply_filter(&gd_in, colFilters, 0, colAppliedFilters);
+                    }
+                }else
+                {
+                    //more than 2 filters
+                    for(PA_long32 i = 0; i < (len - 1); ++i)
+                    {
+                        apply_filter(&gd_in, colFilters, i, colAppliedFilters);
+                    }
+                    get_image(gd_in, objImage0, options);//return 1 before last filter in #0
+                    
+                    apply_filter(&gd_in, colFilters, len - 1, colAppliedFilters);
+                }
+
+                get_image(gd_in, objImage1, options);
+                
+                PA_SetObjectVariable(&vObj0, objImage0);
+                PA_SetCollectionElement(colImages, 0, vObj0);
+                PA_ClearVariable(&vObj0);
+                
+                PA_SetObjectVariable(&vObj1, objImage1);
+                PA_SetCollectionElement(colImages, 1, vObj1);
+                PA_ClearVariable(&vObj1);
+                
+            }
+            gdImageDestroy(gd_in);
+        }
+        
+        PA_UnlockHandle(h);
+    }
+
+    ob_set_c(returnValue, L"images", colImages);
+    ob_set_c(returnValue, L"filters", colAppliedFilters);
+    
+    PA_ReturnObject( params, returnValue );
+}
+
+#pragma mark -
+
+void get_tag_options(PA_ObjectRef options, tag_options_t *tag_options){
+    
+    tag_options->binary = binary_length;
+    tag_options->limit = 64;
+    tag_options->vr_binary.clear();
+    
+    CUTF8String binary;
+    if(ob_get_a(options, L"binary", &binary))
+    {
+        tag_options->binary = get_binary_policy(binary, binary_length);
+    }
+    
+    /* per VR: {OB:"blob"; OW:"skip"} */
+    PA_ObjectRef objBinary = ob_get_o(options, L"binary");
+    if(objBinary)
+    {
+        static const imebra::tagVR_t bulk_vrs[] = {
+            imebra::tagVR_t::OB, imebra::tagVR_t::OD, imebra::tagVR_t::OF,
+            imebra::tagVR_t::OL, imebra::tagVR_t::OW, imebra::tagVR_t::UN};
+        
+        for(size_t i = 0; i < sizeof(bulk_vrs) / sizeof(bulk_vrs[0]); ++i)
+        {
+            wchar_t vr[3] = {(wchar_t)((int)bulk_vrs[i] >> 8), (wchar_t)((int)bulk_vrs[i] & 0xFF), 0};
+            CUTF8String value;
+            if(ob_get_a(objBinary, vr, &value))
+            {
+                tag_options->vr_binary[bulk_vrs[i]] = get_binary_policy(value, tag_options->binary);
+            }
+        }
+    }
+    
+    if(ob_is_defined(options, L"binaryLimit"))
+    {
+        tag_options->limit = std::max(0, (int)ob_get_n(options, L"binaryLimit"));
+        //bytes returned by hex and base64
+    }
+}
+
+binary_policy_t get_binary_policy(CUTF8String& value, binary_policy_t default_policy){
+    
+    if(value == (const uint8_t *)"skip")   return binary_skip;
+    if(value == (const uint8_t *)"length") return binary_length;
+    if(value == (const uint8_t *)"hex")    return binary_hex;
+    if(value == (const uint8_t *)"base64") return binary_base64;
+    if(value == (const uint8_t *)"blob")   return binary_blob;
+    
+    return default_policy;
+}
+
+bool get_tag(imebra::DataSet *data, const imebra::TagId& t, size_t bufferId, const tag_options_t& tag_options, const path_t *source, PA_ObjectRef objTag){
+    
+    imebra::Tag *tag = data->getTag(t);
+    std::unique_ptr<imebra::Tag> _tag(tag);
+    
+    imebra::tagVR_t dataType = tag->getDataType();
+    std::wstring tagDataTypeName;
+    tagDataTypeName += ((int)dataType >> 8);
+    tagDataTypeName += ((int)dataType&0xFF);
+    
+    if(is_bulk_vr(dataType))
+    {
+        /* never stringify bulk data; getBufferSize doesn't load the buffer */
+        binary_policy_t policy = tag_options.binary;
+        std::map<imebra::tagVR_t, binary_policy_t>::const_iterator it = tag_options.vr_binary.find(dataType);
+        if(it != tag_options.vr_binary.end())
+        {
+            policy = it->second;
+        }
+        
+        if(policy == binary_skip)
+            return false;
+        
+        size_t length = tag->getBufferSize(bufferId);
+        
+        ob_set_i(objTag, L"length", length);
+        
+        if(policy == binary_blob)
+        {
+            std::unique_ptr<imebra::ReadingDataHandlerNumeric> raw(tag->getReadingDataHandlerRaw(bufferId));
+            size_t size = 0;
+            const char *bytes = raw->data(&size);
+            ob_set_x(objTag, L"value", bytes, size);
+        }else if(policy != binary_length)
+        {
+            /* hex and base64 return the first bytes only; a value still in the file is not loaded */
+            std::string prefix;
+            
+            bool read = (source)
+            && (length > tag_options.max_size_buffer_load)
+            && (length > tag_options.limit)
+            && (t.getGroupOrder() == 0)
+            && (read_element_prefix(*source, ((std::uint32_t)t.getGroupId() << 16) | t.getTagId(), bufferId, tag_options.limit, prefix));
+            
+            if(!read)
+            {
+                std::unique_ptr<imebra::ReadingDataHandlerNumeric> raw(tag->getReadingDataHandlerRaw(bufferId));
+                size_t size = 0;
+                const char *bytes = raw->data(&size);
+                prefix.assign(bytes, std::min(size, tag_options.limit));
+            }
+            
+            std::string value;
+            
+            if(policy == binary_hex)
+            {
+                bytes_to_hex((const unsigned char *)prefix.data(), prefix.length(), value);
+            }else
+            {
+                bytes_to_base64((const unsigned char *)prefix.data(), prefix.length(), value);
+            }
+            
+            ob_set_s(objTag, L"value", value.c_str());
+        }
+    }else
+    {
+        ob_set_a(objTag, L"value", data->getUnicodeString(t, bufferId, L"").c_str());
+    }
+    
+    ob_set_a(objTag, L"type", tagDataTypeName.c_str());
+    
+    ob_long_t values[] = {
+        {L"id", t.getTagId()},
+        {L"group", t.getGroupId()},
+        {L"order", (PA_long32)t.getGroupOrder()},
+        {L"index", (PA_long32)bufferId}};
+    ob_set_i(objTag, values, sizeof(values) / sizeof(values[0]));
+    
+    return true;
+}
+
+void get_tags(imebra::DataSet *data, const tag_options_t& tag_options, const path_t *source, PA_CollectionRef colTags){
+    
+    imebra::tagsIds_t tags = data->getTags();
+    for (imebra::tagsIds_t::iterator it = tags.begin() ; it != tags.end(); ++it)
+    {
+        imebra::TagId t = *it;
+        
+        size_t bufferId = 0;
+        while (data->bufferExists(t, bufferId))
+        {
+            PA_ObjectRef objTag = PA_CreateObject();
+            
+            if(get_tag(data, t, bufferId, tag_options, source, objTag))
+            {
+                PA_Variable vObj = PA_CreateVariable(eVK_Object);
+                PA_SetObjectVariable(&vObj, objTag);
+                PA_SetCollectionElement(colTags, PA_GetCollectionLength(colTags), vObj);
+                PA_ClearVariable(&vObj);
+            }else
+            {
+                PA_DisposeObject(objTag);
+            }
+            
+            bufferId++;
+        }
+    }
+}
+
+#pragma mark -
+
+void get_tag_list(PA_ObjectRef options, std::vector<tag_list_entry_t>& tag_list){
+    
+    tag_list.clear();
+    
+    PA_CollectionRef tagList = ob_get_c(options, L"tagList");
+    if(tagList)
+    {
+        PA_long32 len = PA_GetCollectionLength(tagList);
+        for(PA_long32 i = 0; i < len; ++i)
+        {
+            PA_Variable v = PA_GetCollectionElement(tagList, i);
+            if(PA_GetVariableKind(v) == eVK_Unistring)
+            {
+                PA_Unistring uvalue = PA_GetStringVariable(v);
+                C_TEXT t;
+                t.setUTF16String(&uvalue);
+                CUTF8String path;
+                t.copyUTF8String(&path);
+                
+                tag_list_entry_t entry;
+                entry.path = std::string((const char *)path.c_str());
+                if(get_tag_path(entry.path, &entry.tag_path))
+                {
+                    tag_list.push_back(entry);
+                }
+            }
+        }
+    }
+}
+
+void get_tags_path(imebra::DataSet *data,
+                   const tag_path_t& tag_path,
+                   size_t pos,
+                   const std::string& path,/* resolved so far, e.g. Seq[0]. */
+                   const tag_options_t& tag_options,
+                   const path_t *source,/* top level only */
+                   PA_CollectionRef colTags){
+    
+    const tag_path_segment_t& segment = tag_path[pos];
+    imebra::TagId t(segment.group, segment.element);
+    
+    if((pos + 1) == tag_path.size())
+    {
+        /* on the last segment [n] selects one value, e.g. one fragment of encapsulated pixel data */
+        std::string tag_name = path + segment.name;
+        
+        if(segment.item != -1)
+        {
+            char index[32];
+            snprintf(index, sizeof(index), "[%lu]", (unsigned long)segment.item);
+            tag_name += index;
+        }
+        
+        size_t bufferId = segment.item == -1 ? 0 : segment.item;
+        while (data->bufferExists(t, bufferId))
+        {
+            PA_ObjectRef objTag = PA_CreateObject();
+            
+            if(get_tag(data, t, bufferId, tag_options, source, objTag))
+            {
+                ob_set_s(objTag, L"path", tag_name.c_str());
+                
+                PA_Variable vObj = PA_CreateVariable(eVK_Object);
+                PA_SetObjectVariable(&vObj, objTag);
+                PA_SetCollectionElement(colTags, PA_GetCollectionLength(colTags), vObj);
+                PA_ClearVariable(&vObj);
+            }else
+            {
+                PA_DisposeObject(objTag);
+            }
+            
+            if(segment.item != -1)
                 break;
+            
+            bufferId++;
+        }
+        return;
+    }
+    
+    std::unique_ptr<imebra::Tag> tag;
+    
+    try
+    {
+        tag.reset(data->getTag(t));
+    }catch(...)
+    {
+        return;
+    }
+    
+    size_t itemId = segment.item == -1 ? 0 : segment.item;
+    
+    while(tag->sequenceItemExists(itemId))
+    {
+        std::unique_ptr<imebra::DataSet> item(tag->getSequenceItem(itemId));
+        
+        char index[32];
+        snprintf(index, sizeof(index), "[%lu].", (unsigned long)itemId);
+        
+        get_tags_path(item.get(), tag_path, pos + 1, path + segment.name + index, tag_options, NULL, colTags);
+        
+        if(segment.item != -1)
+            break;
+        
+        itemId++;
+    }
+}
+
+void get_tags(imebra::DataSet *data, const std::vector<tag_list_entry_t>& tag_list, const tag_options_t& tag_options, const path_t *source, PA_CollectionRef colTags){
+    
+    for(std::vector<tag_list_entry_t>::const_iterator it = tag_list.begin(); it != tag_list.end(); ++it)
+    {
+        get_tags_path(data, it->tag_path, 0, std::string(), tag_options, source, colTags);
+    }
+}
+
+void Imebra_Cache(PA_PluginParameters params){
+    
+    PA_ObjectRef returnValue = PA_CreateObject();
+    
+    PA_ObjectRef options = PA_GetObjectParameter( params, 1 );
+    
+    bool clear = ob_get_b(options, L"clear");
+    bool reset = ob_get_b(options, L"reset");
+    
+    if(ob_is_defined(options, L"budget"))
+    {
+        double budget = ob_get_n(options, L"budget");
+        frame_cache.budget = budget > 0 ? (size_t)budget : 0;
+        //bytes, 0=disabled
+    }
+    
+    size_t budget = frame_cache.budget;
+    size_t bytes = 0, entries = 0, hits = 0, misses = 0, evictions = 0;
+    
+    frame_cache_trim(clear ? 0 : budget);
+    
+    /* one shard at a time; requests keep running on the others */
+    for(size_t i = 0; i < FRAME_CACHE_SHARDS; ++i)
+    {
+        frame_cache_shard_t *shard = &frame_cache.shards[i];
+        
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        
+        if((clear) || (!budget))
+        {
+            shard->infos.clear();
+        }
+        
+        if(reset)
+        {
+            shard->hits = 0;
+            shard->misses = 0;
+            shard->evictions = 0;
+        }
+        
+        bytes += shard->bytes;
+        entries += shard->lru.size();
+        hits += shard->hits;
+        misses += shard->misses;
+        evictions += shard->evictions;
+    }
+    
+    ob_set_n(returnValue, L"budget", (double)budget);
+    ob_set_n(returnValue, L"bytes", (double)bytes);
+    ob_set_n(returnValue, L"entries", (double)entries);
+    ob_set_n(returnValue, L"hits", (double)hits);
+    ob_set_n(returnValue, L"misses", (double)misses);
+    ob_set_n(returnValue, L"evictions", (double)evictions);
+    
+    PA_ReturnObject( params, returnValue );
+}
+
+void set_raw(const render_frame_t& frame, const windowing_t& windowing, bool rescale, PA_ObjectRef objImage){
+    
+    static const char *depths[] = {"U8", "S8", "U16", "S16", "U32", "S32"};
+    
+    const raw_frame_t& raw = frame.raw;
+    
+    ob_set_x(objImage, L"raw", raw.samples, raw.size);
+    
+    ob_set_s(objImage, L"depth", depths[(int)raw.depth]);
+    ob_set_b(objImage, L"signed", ((int)raw.depth & 1) != 0);
+    
+    ob_long_t values[] = {
+        {L"unitSize", (PA_long32)raw.unit_size},
+        {L"channels", (PA_long32)raw.channels},
+        {L"highBit", (PA_long32)raw.high_bit},
+        {L"bitsStored", (PA_long32)raw.high_bit + 1}};
+    ob_set_i(objImage, values, sizeof(values) / sizeof(values[0]));
+    
+    /* imebra always returns interleaved, native byte order samples */
+    ob_set_b(objImage, L"planar", false);
+    ob_set_b(objImage, L"rescale", rescale);
+    ob_set_n(objImage, L"rescaleSlope", windowing.slope);
+    ob_set_n(objImage, L"rescaleIntercept", windowing.intercept);
+}
+
+static void set_profile_stages(const profile_t& profile, PA_ObjectRef objProfile){
+    
+    for(int i = 0; i < stage_count; ++i)
+    {
+        if(!profile.calls[i])
+            continue;
+        
+        PA_ObjectRef objStage = PA_CreateObject();
+        ob_set_i(objStage, L"calls", profile.calls[i]);
+        ob_set_n(objStage, L"ms", profile.ms[i]);
+        ob_set_n(objStage, L"bytes", (double)profile.bytes[i]);
+        ob_set_o(objProfile, stage_names[i], objStage);
+    }
+}
+
+/* stages of the call, frame stages summed, then each frame on its own */
+
+void set_profile(dataset_result_t& result, PA_ObjectRef objResult){
+    
+    PA_ObjectRef objProfile = PA_CreateObject();
+    
+    profile_t total = result.profile;
+    
+    PA_CollectionRef colFrames = PA_CreateCollection();
+    
+    for(std::vector<render_frame_t>::const_iterator it = result.frames.begin(); it != result.frames.end(); ++it)
+    {
+        const profile_t *profile = it->profile.get();
+        
+        if(!profile)
+            continue;
+        
+        for(int i = 0; i < stage_count; ++i)
+        {
+            total.calls[i] += profile->calls[i];
+            total.ms[i] += profile->ms[i];
+            total.bytes[i] += profile->bytes[i];
         }
         
-        if(gd_in)
+        PA_Variable vObj = PA_CreateVariable(eVK_Object);
+        PA_ObjectRef objFrame = PA_CreateObject();
+        
+        ob_set_i(objFrame, L"frame", (PA_long32)it->frame);
+        set_profile_stages(*profile, objFrame);
+        
+        PA_SetObjectVariable(&vObj, objFrame);
+        PA_SetCollectionElement(colFrames, PA_GetCollectionLength(colFrames), vObj);
+        PA_ClearVariable(&vObj);
+    }
+    
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - result.started;
+    
+    ob_set_n(objProfile, L"elapsed", elapsed.count());
+    ob_set_b(objProfile, L"cached", result.cached);
+    set_profile_stages(total, objProfile);
+    ob_set_c(objProfile, L"frames", colFrames);
+    
+    ob_set_o(objResult, L"profile", objProfile);
+}
+
+#pragma mark -
+
+/* items: paths (text) or BLOBs; BLOBs are copied here because workers can't call 4D */
+
+void get_batch_items(PA_ObjectRef options, std::vector<batch_item_t>& items){
+    
+    PA_CollectionRef colItems = ob_get_c(options, L"items");
+    
+    if(colItems)
+    {
+        PA_long32 len = PA_GetCollectionLength(colItems);
+        
+        for(PA_long32 i = 0; i < len; ++i)
         {
-            PA_CollectionRef colFilters = ob_get_c(options, L"filters");
+            batch_item_t item;
             
-            if(colFilters)
-            {
-                PA_long32 len = PA_GetCollectionLength(colFilters);
-                
-                if(len < 2)
+            PA_Variable v = PA_GetCollectionElement(colItems, i);
+            
+            switch (PA_GetVariableKind(v)) {
+                case eVK_Unistring:
                 {
-                    get_image(gd_in, objImage0, options);//return original image in #0
-                    
-                    if(len == 1)
-                    {
-                        apply_filter(&gd_in, colFilters, 0, colAppliedFilters);
-                    }
-                }else
+                    PA_Unistring uvalue = PA_GetStringVariable(v);
+                    C_TEXT t;
+                    t.setUTF16String(&uvalue);
+                    CUTF8String u8;
+                    t.copyUTF8String(&u8);
+                    get_path(u8, item.path);
+                }
+                    break;
+                case eVK_Blob:
                 {
-                    //more than 2 filters
-                    for(PA_long32 i = 0; i < (len - 1); ++i)
+                    PA_Handle h = PA_GetBlobHandleVariable(v);
+                    if(h)
                     {
-                        apply_filter(&gd_in, colFilters, i, colAppliedFilters);
+                        PA_long32 size = PA_GetHandleSize(h);
+                        item.memory.reset(new imebra::ReadMemory((const char *)PA_LockHandle(h), size));
+                        PA_UnlockHandle(h);
                     }
-                    get_image(gd_in, objImage0, options);//return 1 before last filter in #0
-                    
-                    apply_filter(&gd_in, colFilters, len - 1, colAppliedFilters);
                 }
+                    break;
+                default:
+                    break;
+            }
+            
+            items.push_back(item);
+        }
+    }
+}
 
-                get_image(gd_in, objImage1, options);
-                
-                PA_SetObjectVariable(&vObj0, objImage0);
-                PA_SetCollectionElement(colImages, 0, vObj0);
-                PA_ClearVariable(&vObj0);
-                
-                PA_SetObjectVariable(&vObj1, objImage1);
-                PA_SetCollectionElement(colImages, 1, vObj1);
-                PA_ClearVariable(&vObj1);
-                
+void get_frame_selection(PA_ObjectRef options, frame_selection_t *selection){
+    
+    PA_CollectionRef colFrames = ob_get_c(options, L"frames");
+    
+    selection->list = (colFrames != NULL);
+    selection->frames.clear();
+    
+    if(colFrames)
+    {
+        for(PA_long32 i = 0; i < PA_GetCollectionLength(colFrames); ++i)
+        {
+            PA_Variable v = PA_GetCollectionElement(colFrames, i);
+            if(PA_GetVariableKind(v) == eVK_Real)
+            {
+                selection->frames.push_back(PA_GetRealVariable(v));
             }
-            gdImageDestroy(gd_in);
         }
-        
-        PA_UnlockHandle(h);
     }
+    
+    selection->count = -1;/* default:-1 */
+    selection->start = (int)ob_get_n(options, L"start");/* default:0 */
+    selection->stride = 1;/* default:1 */
+    
+    if(ob_is_defined(options, L"count"))
+    {
+        selection->count = (int)ob_get_n(options, L"count");
+    }
+    
+    if(ob_is_defined(options, L"stride"))
+    {
+        selection->stride = (int)ob_get_n(options, L"stride");
+    }
+    
+    if(selection->start < 0) selection->start = 0;
+    if(selection->stride < 1) selection->stride = 1;
+}
 
-    ob_set_c(returnValue, L"images", colImages);
-    ob_set_c(returnValue, L"filters", colAppliedFilters);
+static void ob_set_tag_a(PA_ObjectRef obj, const wchar_t *_key, imebra::DataSet *data, imebra::tagId_t tagId){
     
-    PA_ReturnObject( params, returnValue );
+    imebra::TagId t(tagId);
+    
+    if(data->bufferExists(t, 0))
+    {
+        ob_set_a(obj, _key, data->getUnicodeString(t, 0, L"").c_str());
+    }
+}
+
+static void ob_set_tag_i(PA_ObjectRef obj, const wchar_t *_key, imebra::DataSet *data, imebra::tagId_t tagId){
+    
+    imebra::TagId t(tagId);
+    
+    if(data->bufferExists(t, 0))
+    {
+        ob_set_i(obj, _key, data->getSignedLong(t, 0, 0));
+    }
+}
+
+void get_probe(imebra::DataSet *data, PA_ObjectRef objProbe){
+    
+    ob_set_tag_a(objProbe, L"transferSyntax", data, imebra::tagId_t::TransferSyntaxUID_0002_0010);
+    ob_set_tag_a(objProbe, L"sopClassUID", data, imebra::tagId_t::SOPClassUID_0008_0016);
+    ob_set_tag_a(objProbe, L"sopInstanceUID", data, imebra::tagId_t::SOPInstanceUID_0008_0018);
+    ob_set_tag_a(objProbe, L"studyInstanceUID", data, imebra::tagId_t::StudyInstanceUID_0020_000D);
+    ob_set_tag_a(objProbe, L"seriesInstanceUID", data, imebra::tagId_t::SeriesInstanceUID_0020_000E);
+    ob_set_tag_a(objProbe, L"modality", data, imebra::tagId_t::Modality_0008_0060);
+    ob_set_tag_a(objProbe, L"patientID", data, imebra::tagId_t::PatientID_0010_0020);
+    ob_set_tag_a(objProbe, L"accessionNumber", data, imebra::tagId_t::AccessionNumber_0008_0050);
+    ob_set_tag_a(objProbe, L"photometricInterpretation", data, imebra::tagId_t::PhotometricInterpretation_0028_0004);
+    
+    ob_set_tag_i(objProbe, L"width", data, imebra::tagId_t::Columns_0028_0011);
+    ob_set_tag_i(objProbe, L"height", data, imebra::tagId_t::Rows_0028_0010);
+    ob_set_i(objProbe, L"frames", data->getSignedLong(imebra::TagId(imebra::tagId_t::NumberOfFrames_0028_0008), 0, 1));
+    ob_set_tag_i(objProbe, L"samplesPerPixel", data, imebra::tagId_t::SamplesPerPixel_0028_0002);
+    ob_set_tag_i(objProbe, L"bitsAllocated", data, imebra::tagId_t::BitsAllocated_0028_0100);
+    ob_set_tag_i(objProbe, L"bitsStored", data, imebra::tagId_t::BitsStored_0028_0101);
+    ob_set_tag_i(objProbe, L"highBit", data, imebra::tagId_t::HighBit_0028_0102);
+    ob_set_tag_i(objProbe, L"pixelRepresentation", data, imebra::tagId_t::PixelRepresentation_0028_0103);
+    ob_set_tag_i(objProbe, L"planarConfiguration", data, imebra::tagId_t::PlanarConfiguration_0028_0006);
 }
 
 #pragma mark -
@@ -735,430 +2114,200 @@ image_format_t get_image_format(PA_ObjectRef options){
     return image_format;
 }
 
-void apply_filter(gdImagePtr *gd, PA_CollectionRef colFilters, PA_long32 i, PA_CollectionRef colAppliedFilters){
+void get_filter(PA_ObjectRef objFilter, filter_t *filter){
     
-    PA_Variable v = PA_GetCollectionElement(colFilters, i);
-    if(PA_GetVariableKind(v)== eVK_Object)
+    filter->weight     = ob_get_n(objFilter, L"weight");
+    filter->brightness = ob_get_n(objFilter, L"brightness");
+    filter->contrast   = ob_get_n(objFilter, L"contrast");
+    
+    filter->angle = ob_get_n(objFilter, L"angle");
+    filter->dst_w = ob_get_n(objFilter, L"dstW");
+    filter->dst_h = ob_get_n(objFilter, L"dstH");
+    filter->dst_x = ob_get_n(objFilter, L"dstX");
+    filter->dst_y = ob_get_n(objFilter, L"dstY");
+    filter->src_w = ob_get_n(objFilter, L"srcW");
+    filter->src_h = ob_get_n(objFilter, L"srcH");
+    filter->src_x = ob_get_n(objFilter, L"srcX");
+    filter->src_y = ob_get_n(objFilter, L"srcY");
+    
+    filter->sub  = ob_get_n(objFilter, L"sub");
+    filter->plus = ob_get_n(objFilter, L"plus");
+    filter->size = ob_get_n(objFilter, L"size");
+    filter->mode = ob_get_n(objFilter, L"mode");
+    
+    filter->radius = ob_get_n(objFilter, L"radius");
+    filter->sigma  = ob_get_n(objFilter, L"sigma");
+    
+    filter->red   = ob_get_n(objFilter, L"red");
+    filter->green = ob_get_n(objFilter, L"green");
+    filter->blue  = ob_get_n(objFilter, L"blue");
+    filter->alpha = ob_get_n(objFilter, L"alpha");
+    
+    filter->div    = ob_get_n(objFilter, L"div");
+    filter->offset = ob_get_n(objFilter, L"offset");
+    
+    filter->colors.clear();
+    
+    PA_CollectionRef _colors = ob_get_c(objFilter, L"colors");
+    
+    if(_colors)
     {
-        PA_ObjectRef objFilter = PA_GetObjectVariable(v);
-
-        CUTF8String filter;
-        if(ob_get_a(objFilter, L"filter", &filter))
+        for(PA_long32 c = 0; c < PA_GetCollectionLength(_colors); ++c)
         {
-            if(filter == (const uint8_t *)"selectiveBlur"){
-                
-                if(gdImageSelectiveBlur(*gd))
-                {
-                    PA_Variable vObj = PA_CreateVariable(eVK_Object);
-                    PA_SetObjectVariable(&vObj, PA_DuplicateObject(objFilter));
-                    PA_SetCollectionElement(colAppliedFilters, PA_GetCollectionLength(colAppliedFilters), vObj);
-                    PA_ClearVariable(&vObj);
-                }
-                goto apply_filter_exit;
-            }
-            if(filter == (const uint8_t *)"edgeDetectQuick"){
-                
-                if(gdImageEdgeDetectQuick(*gd))
-                {
-                    PA_Variable vObj = PA_CreateVariable(eVK_Object);
-                    PA_SetObjectVariable(&vObj, PA_DuplicateObject(objFilter));
-                    PA_SetCollectionElement(colAppliedFilters, PA_GetCollectionLength(colAppliedFilters), vObj);
-                    PA_ClearVariable(&vObj);
-                }
-                goto apply_filter_exit;
-            }
-            if(filter == (const uint8_t *)"emboss"){
-                
-                if(gdImageEmboss(*gd))
-                {
-                    PA_Variable vObj = PA_CreateVariable(eVK_Object);
-                    PA_SetObjectVariable(&vObj, PA_DuplicateObject(objFilter));
-                    PA_SetCollectionElement(colAppliedFilters, PA_GetCollectionLength(colAppliedFilters), vObj);
-                    PA_ClearVariable(&vObj);
-                }
-                goto apply_filter_exit;
-            }
-            if(filter == (const uint8_t *)"meanRemoval"){
-                
-                if(gdImageMeanRemoval(*gd))
-                {
-                    PA_Variable vObj = PA_CreateVariable(eVK_Object);
-                    PA_SetObjectVariable(&vObj, PA_DuplicateObject(objFilter));
-                    PA_SetCollectionElement(colAppliedFilters, PA_GetCollectionLength(colAppliedFilters), vObj);
-                    PA_ClearVariable(&vObj);
-                }
-                goto apply_filter_exit;
-            }
-            if(filter == (const uint8_t *)"grayScale"){
-                
-                if(gdImageGrayScale(*gd))
-                {
-                    PA_Variable vObj = PA_CreateVariable(eVK_Object);
-                    PA_SetObjectVariable(&vObj, PA_DuplicateObject(objFilter));
-                    PA_SetCollectionElement(colAppliedFilters, PA_GetCollectionLength(colAppliedFilters), vObj);
-                    PA_ClearVariable(&vObj);
-                }
-                goto apply_filter_exit;
-            }
-            if(filter == (const uint8_t *)"negate"){
-                
-                if(gdImageNegate(*gd))
-                {
-                    PA_Variable vObj = PA_CreateVariable(eVK_Object);
-                    PA_SetObjectVariable(&vObj, PA_DuplicateObject(objFilter));
-                    PA_SetCollectionElement(colAppliedFilters, PA_GetCollectionLength(colAppliedFilters), vObj);
-                    PA_ClearVariable(&vObj);
-                }
-                goto apply_filter_exit;
-            }
-            if(filter == (const uint8_t *)"smooth"){
-                
-                double weight = ob_get_n(objFilter, L"weight");
-                if(gdImageSmooth(*gd, weight))
-                {
-                    PA_Variable vObj = PA_CreateVariable(eVK_Object);
-                    PA_SetObjectVariable(&vObj, PA_DuplicateObject(objFilter));
-                    PA_SetCollectionElement(colAppliedFilters, PA_GetCollectionLength(colAppliedFilters), vObj);
-                    PA_ClearVariable(&vObj);
-                }
-                goto apply_filter_exit;
-            }
-            if(filter == (const uint8_t *)"brightness"){
-                
-                double brightness = ob_get_n(objFilter, L"brightness");
-                if(gdImageBrightness(*gd, brightness))
-                {
-                    PA_Variable vObj = PA_CreateVariable(eVK_Object);
-                    PA_SetObjectVariable(&vObj, PA_DuplicateObject(objFilter));
-                    PA_SetCollectionElement(colAppliedFilters, PA_GetCollectionLength(colAppliedFilters), vObj);
-                    PA_ClearVariable(&vObj);
-                }
-                goto apply_filter_exit;
-            }
-            if(filter == (const uint8_t *)"contrast"){
-                
-                double contrast = ob_get_n(objFilter, L"contrast");
-                if(gdImageContrast(*gd, contrast))
-                {
-                    PA_Variable vObj = PA_CreateVariable(eVK_Object);
-                    PA_SetObjectVariable(&vObj, PA_DuplicateObject(objFilter));
-                    PA_SetCollectionElement(colAppliedFilters, PA_GetCollectionLength(colAppliedFilters), vObj);
-                    PA_ClearVariable(&vObj);
-                }
-                goto apply_filter_exit;
-            }
-            if(filter == (const uint8_t *)"rotate"){
-                
-                int angle = ob_get_n(objFilter, L"angle");
-                int dstW = ob_get_n(objFilter, L"dstW");/* dstW */
-                int dstH = ob_get_n(objFilter, L"dstH");/* dstH */
-                int dstX = ob_get_n(objFilter, L"dstX");/* dstX */
-                int dstY = ob_get_n(objFilter, L"dstY");/* dstY */
-
-                int srcW = ob_get_n(objFilter, L"srcW");/* srcW */
-                int srcH = ob_get_n(objFilter, L"srcH");/* srcH */
-                int srcX = ob_get_n(objFilter, L"srcX");/* srcX */
-                int srcY = ob_get_n(objFilter, L"srcY");/* srcY */
-                
-                gdImagePtr _gd = gdImageCreateTrueColor(dstW, dstH);
-                
-                if(_gd)
-                {
-                    /* make background transparent */
-                    gdImageAlphaBlending(_gd, 0);
-                    gdImageFill(_gd, 0, 0, gdImageColorAllocateAlpha(_gd, 0, 0, 0, 255));
-                    gdImageSaveAlpha(_gd, 1);
-                    
-                    gdImageCopyRotated(_gd, *gd,
-                                       dstX,
-                                       dstY,
-                                       srcX,
-                                       srcY,
-                                       srcW, 
-                                       srcH,
-                                       angle);
-                    
-                    gdImageDestroy(*gd);
-                    
-                    *gd = _gd;
-                    
-                    PA_Variable vObj = PA_CreateVariable(eVK_Object);
-                    PA_SetObjectVariable(&vObj, PA_DuplicateObject(objFilter));
-                    PA_SetCollectionElement(colAppliedFilters, PA_GetCollectionLength(colAppliedFilters), vObj);
-                    PA_ClearVariable(&vObj);
-                }
-                goto apply_filter_exit;
-            }
-            if(filter == (const uint8_t *)"scatter"){
-                
-                int sub = ob_get_n(objFilter, L"sub");
-                int plus = ob_get_n(objFilter, L"plus");
-                if(gdImageScatter(*gd, sub, plus))
-                {
-                    PA_Variable vObj = PA_CreateVariable(eVK_Object);
-                    PA_SetObjectVariable(&vObj, PA_DuplicateObject(objFilter));
-                    PA_SetCollectionElement(colAppliedFilters, PA_GetCollectionLength(colAppliedFilters), vObj);
-                    PA_ClearVariable(&vObj);
-                }
-                goto apply_filter_exit;
-            }
-            if(filter == (const uint8_t *)"pixelate"){
-                
-                int block_size = ob_get_n(objFilter, L"size");
-                int mode = ob_get_n(objFilter, L"mode");
-                if(gdImagePixelate(*gd, block_size, mode))
-                {
-                    PA_Variable vObj = PA_CreateVariable(eVK_Object);
-                    PA_SetObjectVariable(&vObj, PA_DuplicateObject(objFilter));
-                    PA_SetCollectionElement(colAppliedFilters, PA_GetCollectionLength(colAppliedFilters), vObj);
-                    PA_ClearVariable(&vObj);
-                }
-                goto apply_filter_exit;
-            }
-            if(filter == (const uint8_t *)"gaussianBlur"){
-                
-                int radius = ob_get_n(objFilter, L"radius");
-                double sigma = ob_get_n(objFilter, L"sigma");
-                
-                gdImagePtr _gd = gdImageCopyGaussianBlurred(*gd, radius, sigma);
-
-                if(_gd)
-                {
-                    gdImageDestroy(*gd);
-                    
-                    *gd = _gd;
-                    
-                    PA_Variable vObj = PA_CreateVariable(eVK_Object);
-                    PA_SetObjectVariable(&vObj, PA_DuplicateObject(objFilter));
-                    PA_SetCollectionElement(colAppliedFilters, PA_GetCollectionLength(colAppliedFilters), vObj);
-                    PA_ClearVariable(&vObj);
-                }
-                goto apply_filter_exit;
-            }
-            if(filter == (const uint8_t *)"color"){
-                
-                int red = ob_get_n(objFilter, L"red");
-                int green = ob_get_n(objFilter, L"green");
-                int blue = ob_get_n(objFilter, L"blue");
-                int alpha = ob_get_n(objFilter, L"alpha");
-                
-                if(gdImageColor(*gd, red, green, blue, alpha))
-                {
-                    PA_Variable vObj = PA_CreateVariable(eVK_Object);
-                    PA_SetObjectVariable(&vObj, PA_DuplicateObject(objFilter));
-                    PA_SetCollectionElement(colAppliedFilters, PA_GetCollectionLength(colAppliedFilters), vObj);
-                    PA_ClearVariable(&vObj);
-                }
-                goto apply_filter_exit;
-            }
-            if(filter == (const uint8_t *)"scatterColor"){
-                
-                int sub = ob_get_n(objFilter, L"sub");
-                int plus = ob_get_n(objFilter, L"plus");
-                std::vector<int>colors;
-                
-                PA_CollectionRef _colors = ob_get_c(objFilter, L"colors");
-
-                if(_colors)
-                {
-                    for(PA_long32 c = 0; c < PA_GetCollectionLength(_colors); ++c)
-                    {
-                        PA_Variable e = PA_GetCollectionElement(_colors, c);
-                        if(PA_GetVariableKind(e) == eVK_Real)
-                        {
-                            colors.push_back((int)PA_GetRealVariable(e));
-                        }
-                    }
-                }
-
-                if(gdImageScatterColor(*gd, sub, plus, &colors[0], colors.size()))
-                {
-                    PA_Variable vObj = PA_CreateVariable(eVK_Object);
-                    PA_SetObjectVariable(&vObj, PA_DuplicateObject(objFilter));
-                    PA_SetCollectionElement(colAppliedFilters, PA_GetCollectionLength(colAppliedFilters), vObj);
-                    PA_ClearVariable(&vObj);
-                }
-                goto apply_filter_exit;
+            PA_Variable e = PA_GetCollectionElement(_colors, c);
+            if(PA_GetVariableKind(e) == eVK_Real)
+            {
+                filter->colors.push_back((int)PA_GetRealVariable(e));
             }
-            if(filter == (const uint8_t *)"convolution"){
-                
-                double div = ob_get_n(objFilter, L"div");
-                double offset = ob_get_n(objFilter, L"offset");
-
-                float filter[3][3] = {
-                    { 0.0, 0.0, 0.0},
-                    { 0.0, 0.0, 0.0},
-                    { 0.0, 0.0, 0.0}
-                };
-                
-                PA_CollectionRef _filter = ob_get_c(objFilter, L"matrix");
-                
-                if(_filter)
+        }
+    }
+    
+    memset(filter->matrix, 0, sizeof(filter->matrix));
+    
+    PA_CollectionRef _filter = ob_get_c(objFilter, L"matrix");
+    
+    if(_filter)
+    {
+        if(PA_GetCollectionLength(_filter) == 3)
+        {
+            for(PA_long32 y = 0; y < 3; ++y)
+            {
+                PA_Variable r = PA_GetCollectionElement(_filter, y);
+                if(PA_GetVariableKind(r) == eVK_Collection)
                 {
-                    if(PA_GetCollectionLength(_filter) == 3)
+                    PA_CollectionRef c = PA_GetCollectionVariable(r);
+                    if(PA_GetCollectionLength(c) == 3)
                     {
-                        for(PA_long32 y = 0; y < 3; ++y)
+                        for(PA_long32 x = 0; x < 3; ++x)
                         {
-                            PA_Variable r = PA_GetCollectionElement(_filter, y);
-                            if(PA_GetVariableKind(r) == eVK_Collection)
+                            PA_Variable e = PA_GetCollectionElement(c, x);
+                            if(PA_GetVariableKind(e) == eVK_Real)
                             {
-                                PA_CollectionRef c = PA_GetCollectionVariable(r);
-                                if(PA_GetCollectionLength(c) == 3)
-                                {
-                                    for(PA_long32 x = 0; x < 3; ++x)
-                                    {
-                                        PA_Variable e = PA_GetCollectionElement(c, x);
-                                        if(PA_GetVariableKind(e) == eVK_Real)
-                                        {
-                                            filter[y][x] = PA_GetRealVariable(e);
-                                        }
-                                    }
-                                }
+                                filter->matrix[y][x] = PA_GetRealVariable(e);
                             }
                         }
                     }
                 }
-                
-                if(gdImageConvolution(*gd, filter, div, offset))
-                {
-                    PA_Variable vObj = PA_CreateVariable(eVK_Object);
-                    PA_SetObjectVariable(&vObj, PA_DuplicateObject(objFilter));
-                    PA_SetCollectionElement(colAppliedFilters, PA_GetCollectionLength(colAppliedFilters), vObj);
-                    PA_ClearVariable(&vObj);
-                }
-                goto apply_filter_exit;
             }
         }
     }
+}
+
+void apply_filter(gdImagePtr *gd, PA_CollectionRef colFilters, PA_long32 i, PA_CollectionRef colAppliedFilters){
     
-    apply_filter_exit:
+    PA_Variable v = PA_GetCollectionElement(colFilters, i);
+    if(PA_GetVariableKind(v)== eVK_Object)
+    {
+        PA_ObjectRef objFilter = PA_GetObjectVariable(v);
+        
+        CUTF8String name;
+        if(ob_get_a(objFilter, L"filter", &name))
+        {
+            filter_t filter;
+            filter.filter = std::string((const char *)name.c_str(), name.length());
+            get_filter(objFilter, &filter);
+            
+            if(apply_filter(gd, filter))
+            {
+                PA_Variable vObj = PA_CreateVariable(eVK_Object);
+                PA_SetObjectVariable(&vObj, PA_DuplicateObject(objFilter));
+                PA_SetCollectionElement(colAppliedFilters, PA_GetCollectionLength(colAppliedFilters), vObj);
+                PA_ClearVariable(&vObj);
+            }
+        }
+    }
     
     PA_ClearVariable(&v);
 }
 
-void get_image(gdImagePtr gd, PA_ObjectRef objImage, PA_ObjectRef options){
+void get_image_options(PA_ObjectRef options, image_options_t *image_options){
     
-    int jpeg_quality    =  0;
-    int png_level       = -1;
-    int wbmp_fg         = -1;
-    int webp_quality    = -1;
-    int bmp_compression =  0;
+    image_options->jpeg_quality    =  0;
+    image_options->png_level       = -1;
+    image_options->wbmp_fg         = -1;
+    image_options->webp_quality    = -1;
+    image_options->bmp_compression =  0;
     
     if(ob_is_defined(options, L"quality"))
     {
-        jpeg_quality = (int)ob_get_n(options, L"quality");
+        image_options->jpeg_quality = (int)ob_get_n(options, L"quality");
         //Compression quality: 0-95, 0=default
         
-        webp_quality = jpeg_quality;
+        image_options->webp_quality = image_options->jpeg_quality;
         //-1=default, 0-100        
     }
 
     if(ob_is_defined(options, L"compression"))
     {
-        bmp_compression = (int)ob_get_n(options, L"compression") != 0;
+        image_options->bmp_compression = (int)ob_get_n(options, L"compression") != 0;
         //whether to apply RLE or not
     }
     
     if(ob_is_defined(options, L"level"))
     {
-        png_level = (int)ob_get_n(options, L"level");
+        image_options->png_level = (int)ob_get_n(options, L"level");
         //compression level: 0=none, 1-9=level, -1=default
     }
     
     if(ob_is_defined(options, L"fg"))
     {
-        wbmp_fg = (int)ob_get_n(options, L"fg");
+        image_options->wbmp_fg = (int)ob_get_n(options, L"fg");
     }
     
-    image_format_t image_format = get_image_format(options);
+    image_options->max_width = 0;
+    image_options->max_height = 0;
     
-    if(gd)
+    if(ob_is_defined(options, L"maxWidth"))
     {
-        int len = 0;
-        void *bytes = NULL;
-        switch (image_format) {
-            case image_format_png:
-                bytes = gdImagePngPtrEx(gd, &len, png_level);
-                if(bytes)
-                {
-                    PA_Picture picture = PA_CreatePicture((void *)bytes, len);
-                    ob_set_p(objImage, L"image", picture);
-                    ob_set_a(objImage, L"format", L".png");
-                    ob_set_i(objImage, L"size", len);
-                    ob_set_i(objImage, L"level", png_level);
-                    gdFree(bytes);
-                }
-                break;
-            case image_format_jpg:
-                bytes = gdImageJpegPtr(gd, &len, jpeg_quality);
-                if(bytes)
-                {
-                    PA_Picture picture = PA_CreatePicture((void *)bytes, len);
-                    ob_set_p(objImage, L"image", picture);
-                    ob_set_a(objImage, L"format", L".jpeg");
-                    ob_set_i(objImage, L"size", len);
-                    ob_set_i(objImage, L"quality", jpeg_quality);
-                    gdFree(bytes);
-                }
-                break;
-            case image_format_gif:
-                bytes = gdImageGifPtr(gd, &len);
-                if(bytes)
-                {
-                    PA_Picture picture = PA_CreatePicture((void *)bytes, len);
-                    ob_set_p(objImage, L"image", picture);
-                    ob_set_a(objImage, L"format", L".gif");
-                    ob_set_i(objImage, L"size", len);
-                    gdFree(bytes);
-                }
-                break;
-            case image_format_tiff:
-                bytes = gdImageTiffPtr(gd, &len);
-                if(bytes)
-                {
-                    PA_Picture picture = PA_CreatePicture((void *)bytes, len);
-                    ob_set_p(objImage, L"image", picture);
-                    ob_set_a(objImage, L"format", L".tiff");
-                    ob_set_i(objImage, L"size", len);
-                    gdFree(bytes);
-                }
-                break;
-            case image_format_wbmp:
-                bytes = gdImageWBMPPtr(gd, &len, wbmp_fg);
-                if(bytes)
-                {
-                    PA_Picture picture = PA_CreatePicture((void *)bytes, len);
-                    ob_set_p(objImage, L"image", picture);
-                    ob_set_a(objImage, L"format", L".wbmp");
-                    ob_set_i(objImage, L"size", len);
-                    ob_set_i(objImage, L"fg", wbmp_fg);
-                    gdFree(bytes);
-                }
-                break;
-            case image_format_webp:
-                bytes = gdImageWebpPtrEx(gd, &len, webp_quality);
-                if(bytes)
-                {
-                    PA_Picture picture = PA_CreatePicture((void *)bytes, len);
-                    ob_set_p(objImage, L"image", picture);
-                    ob_set_a(objImage, L"format", L".webp");
-                    ob_set_i(objImage, L"size", len);
-                    ob_set_i(objImage, L"quality", webp_quality);
-                    gdFree(bytes);
-                }
-                break;
-            default:
-                bytes = gdImageBmpPtr(gd, &len, bmp_compression);
-                if(bytes)
-                {
-                    PA_Picture picture = PA_CreatePicture((void *)bytes, len);
-                    ob_set_p(objImage, L"image", picture);
-                    ob_set_a(objImage, L"format", L".bmp");
-                    ob_set_i(objImage, L"size", len);
-                    ob_set_i(objImage, L"compression", bmp_compression);
-                    gdFree(bytes);
-                }
-                break;
+        image_options->max_width = std::max(0, (int)ob_get_n(options, L"maxWidth"));
+        //0=no limit
+    }
+    
+    if(ob_is_defined(options, L"maxHeight"))
+    {
+        image_options->max_height = std::max(0, (int)ob_get_n(options, L"maxHeight"));
+        //0=no limit
+    }
+    
+    image_options->format = get_image_format(options);
+    
+    image_options->output = output_image;
+    image_options->rescale = false;
+    
+    CUTF8String output;
+    if(ob_get_a(options, L"output", &output))
+    {
+        if(output == (const uint8_t *)"raw")
+        {
+            image_options->output = output_raw;
+            image_options->rescale = ob_get_b(options, L"rescale");
+            //false=stored values, true=after the modality transform
+        }
+    }
+}
+
+void set_image(const encoded_image_t& encoded, PA_ObjectRef objImage){
+    
+    if(encoded.bytes)
+    {
+        PA_Picture picture = PA_CreatePicture(encoded.bytes.get(), encoded.size);
+        ob_set_p(objImage, L"image", picture);
+        ob_set_a(objImage, L"format", encoded.format);
+        ob_set_i(objImage, L"size", encoded.size);
+        if(encoded.param)
+        {
+            ob_set_i(objImage, encoded.param, encoded.value);
         }
     }
 }
+
+void get_image(gdImagePtr gd, PA_ObjectRef objImage, PA_ObjectRef options){
+    
+    image_options_t image_options;
+    get_image_options(options, &image_options);
+    
+    encoded_image_t encoded;
+    encode_image(gd, image_options, &encoded);
+    
+    set_image(encoded, objImage);
+}
@@ -9,56 +9,81 @@
  # --------------------------------------------------------------------------------*/
 
 #include "iconv.h"
-#include <imebra/imebra.h>
-#include <list>
+#include "core/imebra_core.h"
 
-#include "gd.h"
-
 #define INCHES_PER_METER (100.0/2.54)
-
+
+#define PROBE_BUFFER_LOAD 256
+#define SESSION_TIMEOUT 600
+
 // --- Imebra
 void Imebra_Get_images(PA_PluginParameters params);
-void Imebra_Apply_filters(PA_PluginParameters params);
+void Imebra_Apply_filters(PA_PluginParameters params);
+void Imebra_Probe(PA_PluginParameters params);
+void Imebra_Batch(PA_PluginParameters params);
+void Imebra_Start_job(PA_PluginParameters params);
+void Imebra_Poll_job(PA_PluginParameters params);
+void Imebra_Cancel_job(PA_PluginParameters params);
+void Imebra_Collect_job(PA_PluginParameters params);
+void Imebra_Cache(PA_PluginParameters params);
+void Imebra_Open(PA_PluginParameters params);
+void Imebra_Render(PA_PluginParameters params);
+void Imebra_Close(PA_PluginParameters params);
+void Imebra_Get_statistics(PA_PluginParameters params);
+void Imebra_Trace(PA_PluginParameters params);
+void Imebra_Memory_pool(PA_PluginParameters params);
+
+bool get_path(PA_ObjectRef options, path_t& path);
+bool get_path(CUTF8String& u8, path_t& path);
+imebra::DataSet *load_dataset(PA_Handle h, PA_ObjectRef options, size_t maxSizeBufferLoad);
+
+void OnStartup();
+void OnExit();
+
+typedef struct
+{
+    bool operator()(const wchar_t *a, const wchar_t *b) const
+    {
+        return wcscmp(a, b) < 0;
+    }
+}ob_key_less_t;
 
-typedef enum image_formats
+typedef struct
 {
-    image_format_bmp  = 0,
-    image_format_png  = 1,
-    image_format_jpg  = 2,
-    image_format_gif  = 3,
-    image_format_wbmp = 4,
-    image_format_webp = 5,
-    image_format_tiff = 6
-}image_format_t;
+    const wchar_t *key;
+    PA_long32 value;
+}ob_long_t;
+
+bool ob_key(const wchar_t *_key, PA_Unistring *key);
+void ob_key_release(PA_Unistring *key, bool cached);
+void ob_set_i(PA_ObjectRef obj, const ob_long_t *values, size_t count);
+
+void get_tag_options(PA_ObjectRef options, tag_options_t *tag_options);
+binary_policy_t get_binary_policy(CUTF8String& value, binary_policy_t default_policy);
+bool get_tag(imebra::DataSet *data, const imebra::TagId& t, size_t bufferId, const tag_options_t& tag_options, const path_t *source, PA_ObjectRef objTag);
+void get_tags(imebra::DataSet *data, const tag_options_t& tag_options, const path_t *source, PA_CollectionRef colTags);
+void get_tags(imebra::DataSet *data, const std::vector<tag_list_entry_t>& tag_list, const tag_options_t& tag_options, const path_t *source, PA_CollectionRef colTags);
+void get_tags_path(imebra::DataSet *data, const tag_path_t& tag_path, size_t pos, const std::string& path, const tag_options_t& tag_options, const path_t *source, PA_CollectionRef colTags);
+void get_tag_list(PA_ObjectRef options, std::vector<tag_list_entry_t>& tag_list);
+
+void get_request_options(PA_ObjectRef options, request_options_t *request);
+void set_result(dataset_result_t& result, const request_options_t& request, PA_ObjectRef objResult);
+void set_image_object(render_frame_t& frame, const windowing_t& windowing, const image_options_t& image_options, PA_ObjectRef objImage);
+void set_images(std::vector<render_frame_t>& frames, const windowing_t& windowing, const image_options_t& image_options, PA_CollectionRef colImages);
+
+void get_batch_items(PA_ObjectRef options, std::vector<batch_item_t>& items);
+void set_batch_results(std::vector<dataset_result_t>& results, const request_options_t& request, PA_CollectionRef colResults);
+
+void get_probe(imebra::DataSet *data, PA_ObjectRef objProbe);
 
 image_format_t get_image_format(PA_ObjectRef options);
+void get_image_options(PA_ObjectRef options, image_options_t *image_options);
 void apply_filter(gdImagePtr *gd, PA_CollectionRef colFilters, PA_long32 i, PA_CollectionRef colAppliedFilters);
+void get_filter(PA_ObjectRef objFilter, filter_t *filter);
 void get_image(gdImagePtr gd, PA_ObjectRef objImage, PA_ObjectRef options);
+void set_image(const encoded_image_t& encoded, PA_ObjectRef objImage);
 
-#pragma pack(1)  // ensure structure is packed
-struct bitmap_file_header {
-    unsigned char   bitmap_type[2];     // 2 bytes
-    int             file_size;          // 4 bytes
-    short           reserved1;          // 2 bytes
-    short           reserved2;          // 2 bytes
-    unsigned int    offset_bits;        // 4 bytes
-} bfh;
-// bitmap image header (40 bytes)
-struct bitmap_image_header {
-    unsigned int    size_header;        // 4 bytes
-    unsigned int    width;              // 4 bytes
-    unsigned int    height;             // 4 bytes
-    short int       planes;             // 2 bytes
-    short int       bit_count;          // 2 bytes
-    unsigned int    compression;        // 4 bytes
-    unsigned int    image_size;         // 4 bytes
-    unsigned int    ppm_x;              // 4 bytes
-    unsigned int    ppm_y;              // 4 bytes
-    unsigned int    clr_used;           // 4 bytes
-    unsigned int    clr_important;      // 4 bytes
-} bih;
-#pragma pack(0)  // restore normal structure packing rules
-
-#define sizeof_bitmap_file_header 14
-#define sizeof_bitmap_image_header 40
+void get_frame_selection(PA_ObjectRef options, frame_selection_t *selection);
+void set_raw(const render_frame_t& frame, const windowing_t& windowing, bool rescale, PA_ObjectRef objImage);
 
+void set_profile(dataset_result_t& result, PA_ObjectRef objResult);
@@ -0,0 +1,4096 @@
+/* --------------------------------------------------------------------------------
+ #
+ #	imebra_core.cpp
+ #	decode, window, render and encode; no dependency on the 4D plugin API
+ #	Project : Imebra
+ #
+ # --------------------------------------------------------------------------------*/
+
+#include "imebra_core.h"
+#include "tag_keywords.h"
+
+#pragma mark -
+
+/*
+ process-wide counters; relaxed atomics only, nothing on the hot path takes a lock.
+ a reset clears each counter as it is read, so no call is counted twice or lost.
+ */
+
+statistics_t statistics = {{true}, {}, {}, {}, {}, {}, {}};
+std::atomic<bool> trace_enabled(false);
+
+const wchar_t *stage_names[stage_count] = {
+    L"load", L"json", L"decode", L"modality", L"downsample",
+    L"voi", L"bitmap", L"encode", L"objects", L"wait"};
+
+/* the last entry stands for any other transfer syntax */
+
+static const char *transfer_syntaxes[] = {
+    "1.2.840.10008.1.2",
+    "1.2.840.10008.1.2.1",
+    "1.2.840.10008.1.2.1.99",
+    "1.2.840.10008.1.2.2",
+    "1.2.840.10008.1.2.5",
+    "1.2.840.10008.1.2.4.50",
+    "1.2.840.10008.1.2.4.51",
+    "1.2.840.10008.1.2.4.57",
+    "1.2.840.10008.1.2.4.70",
+    "1.2.840.10008.1.2.4.80",
+    "1.2.840.10008.1.2.4.81",
+    "1.2.840.10008.1.2.4.90",
+    "1.2.840.10008.1.2.4.91",
+    "other"};
+
+/* NULL past the end of the table */
+
+const char *get_transfer_syntax(size_t index){
+    
+    if(index < (sizeof(transfer_syntaxes) / sizeof(transfer_syntaxes[0])))
+        return transfer_syntaxes[index];
+    
+    return NULL;
+}
+
+size_t get_transfer_syntax_index(const std::string& transferSyntax){
+    
+    size_t count = sizeof(transfer_syntaxes) / sizeof(transfer_syntaxes[0]);
+    
+    for(size_t i = 0; i < count - 1; ++i)
+    {
+        if(transferSyntax == transfer_syntaxes[i])
+            return i;
+    }
+    
+    return count - 1;
+}
+
+void statistics_add(stage_statistics_t *stage, std::uint64_t ns, size_t bytes){
+    
+    std::uint64_t us = ns / 1000;
+    
+    size_t bucket = 0;
+    while((bucket < (STATISTICS_BUCKETS - 1)) && ((1ULL << bucket) < us))
+    {
+        bucket++;
+    }
+    
+    stage->calls.fetch_add(1, std::memory_order_relaxed);
+    stage->ns.fetch_add(ns, std::memory_order_relaxed);
+    stage->bytes.fetch_add(bytes, std::memory_order_relaxed);
+    stage->buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+/* assigned round-robin on the first call of each thread */
+
+static std::atomic<size_t> statistics_next_shard(0);
+
+statistics_shard_t *get_statistics_shard(){
+    
+    static thread_local size_t shard = statistics_next_shard.fetch_add(1, std::memory_order_relaxed) % STATISTICS_SHARDS;
+    
+    return &statistics.shards[shard];
+}
+
+/* the sum of every shard; a reset clears each counter as it is read */
+
+void statistics_collect(bool command, size_t index, bool reset, stage_statistics_values_t *values){
+    
+    memset(values, 0, sizeof(stage_statistics_values_t));
+    
+    for(size_t i = 0; i < STATISTICS_SHARDS; ++i)
+    {
+        stage_statistics_t& stage = command ? statistics.shards[i].commands[index] : statistics.shards[i].stages[index];
+        
+        values->calls += reset ? stage.calls.exchange(0, std::memory_order_relaxed) : stage.calls.load(std::memory_order_relaxed);
+        values->ns += reset ? stage.ns.exchange(0, std::memory_order_relaxed) : stage.ns.load(std::memory_order_relaxed);
+        values->bytes += reset ? stage.bytes.exchange(0, std::memory_order_relaxed) : stage.bytes.load(std::memory_order_relaxed);
+        
+        for(size_t j = 0; j < STATISTICS_BUCKETS; ++j)
+        {
+            values->buckets[j] += reset ? stage.buckets[j].exchange(0, std::memory_order_relaxed) : stage.buckets[j].load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void statistics_add_command(int command, const stage_time_t& start){
+    
+    if((command <= 0) || (command >= STATISTICS_COMMANDS) || (start == stage_time_t()))
+        return;
+    
+    std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+    
+    if(statistics.enabled.load(std::memory_order_relaxed))
+    {
+        statistics_add(&get_statistics_shard()->commands[command], std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(), 0);
+    }
+    
+    if(trace_enabled.load(std::memory_order_relaxed))
+    {
+        trace_add(TRACE_KIND_COMMAND + command, start, elapsed, 0);
+    }
+}
+
+#pragma mark -
+
+/*
+ spans go to a ring buffer owned by the thread that records them, no lock and no allocation;
+ a thread takes a buffer once, and returns it when it exits so that short-lived workers reuse them.
+ the flush copies each buffer and keeps only the events that were not overwritten meanwhile.
+ */
+
+static std::vector<std::unique_ptr<trace_buffer_t> > trace_buffers;
+static std::mutex trace_buffers_mutex;
+static std::atomic<std::uint32_t> trace_next_tid(1);
+std::atomic<std::uint64_t> trace_origin(0);
+
+static trace_buffer_t *trace_acquire(){
+    
+    std::lock_guard<std::mutex> lock(trace_buffers_mutex);
+    
+    for(std::vector<std::unique_ptr<trace_buffer_t> >::iterator it = trace_buffers.begin(); it != trace_buffers.end(); ++it)
+    {
+        bool in_use = false;
+        if((*it)->in_use.compare_exchange_strong(in_use, true))
+            return it->get();
+    }
+    
+    trace_buffer_t *buffer = new trace_buffer_t();
+    buffer->in_use = true;
+    trace_buffers.push_back(std::unique_ptr<trace_buffer_t>(buffer));
+    
+    return buffer;
+}
+
+trace_thread_t::~trace_thread_t(){
+    
+    if(buffer)
+    {
+        buffer->in_use = false;
+    }
+}
+
+std::uint64_t trace_ns(const stage_time_t& t){
+    
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
+}
+
+void trace_add(std::uint32_t kind, const stage_time_t& start, std::chrono::steady_clock::duration duration, size_t bytes){
+    
+    static thread_local trace_thread_t thread = {NULL, 0};
+    
+    if(!thread.buffer)
+    {
+        thread.buffer = trace_acquire();
+        thread.tid = trace_next_tid++;
+    }
+    
+    trace_buffer_t *buffer = thread.buffer;
+    
+    std::uint64_t head = buffer->head.load(std::memory_order_relaxed);
+    trace_event_t& e = buffer->events[head % TRACE_BUFFER_EVENTS];
+    
+    buffer->writing.store(head + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    
+    e.start.store(trace_ns(start), std::memory_order_relaxed);
+    e.duration.store(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count(), std::memory_order_relaxed);
+    e.info.store(((std::uint64_t)(kind & 0xFF) << 56)
+                 | ((std::uint64_t)(thread.tid & 0xFFFFFF) << 32)
+                 | std::min((std::uint64_t)bytes, (std::uint64_t)0xFFFFFFFF), std::memory_order_relaxed);
+    
+    buffer->head.store(head + 1, std::memory_order_release);
+}
+
+static void trace_append_name(std::uint32_t kind, const wchar_t *const *command_names, std::string& json){
+    
+    const wchar_t *name = NULL;
+    
+    if(kind >= TRACE_KIND_COMMAND)
+    {
+        if((kind - TRACE_KIND_COMMAND) < STATISTICS_COMMANDS)
+        {
+            name = command_names[kind - TRACE_KIND_COMMAND];
+        }
+    }else if(kind < stage_count)
+    {
+        name = stage_names[kind];
+    }
+    
+    /* the names are ASCII */
+    for(; (name) && (*name); ++name)
+    {
+        json += (char)*name;
+    }
+}
+
+/* Chrome trace event format, complete events ("X") in microseconds */
+
+size_t trace_write(FILE *f, std::uint64_t origin, const wchar_t *const *command_names){
+    
+    size_t count = 0;
+    
+    std::string json;
+    json.reserve(JSON_BUFFER_RESERVE);
+    json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    
+    std::vector<std::uint64_t> copy(TRACE_BUFFER_EVENTS * 3);
+    
+    std::lock_guard<std::mutex> lock(trace_buffers_mutex);
+    
+    for(std::vector<std::unique_ptr<trace_buffer_t> >::iterator it = trace_buffers.begin(); it != trace_buffers.end(); ++it)
+    {
+        trace_buffer_t *buffer = it->get();
+        
+        std::uint64_t head = buffer->head.load(std::memory_order_acquire);
+        std::uint64_t first = head > TRACE_BUFFER_EVENTS ? head - TRACE_BUFFER_EVENTS : 0;
+        
+        for(std::uint64_t i = first; i < head; ++i)
+        {
+            trace_event_t& e = buffer->events[i % TRACE_BUFFER_EVENTS];
+            copy[(i - first) * 3 + 0] = e.start.load(std::memory_order_relaxed);
+            copy[(i - first) * 3 + 1] = e.duration.load(std::memory_order_relaxed);
+            copy[(i - first) * 3 + 2] = e.info.load(std::memory_order_relaxed);
+        }
+        
+        std::atomic_thread_fence(std::memory_order_acquire);
+        
+        /* slots the owner has started to write again since the copy are dropped */
+        std::uint64_t writing = buffer->writing.load(std::memory_order_relaxed);
+        
+        if(writing > (first + TRACE_BUFFER_EVENTS))
+        {
+            first = writing - TRACE_BUFFER_EVENTS;
+        }
+        
+        std::uint64_t copied = head > TRACE_BUFFER_EVENTS ? head - TRACE_BUFFER_EVENTS : 0;
+        
+        for(std::uint64_t i = first; i < head; ++i)
+        {
+            std::uint64_t start = copy[(i - copied) * 3 + 0];
+            std::uint64_t duration = copy[(i - copied) * 3 + 1];
+            std::uint64_t info = copy[(i - copied) * 3 + 2];
+            
+            if(start < origin)
+                continue;
+            
+            if(count)
+            {
+                json += ",";
+            }
+            
+            char buf[160];
+            
+            json += "{\"name\":\"";
+            trace_append_name((std::uint32_t)(info >> 56), command_names, json);
+            snprintf(buf, sizeof(buf), "\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"bytes\":%llu}}",
+                     (info >> 56) >= TRACE_KIND_COMMAND ? "command" : "stage",
+                     (unsigned int)((info >> 32) & 0xFFFFFF),
+                     start / 1000.0,
+                     duration / 1000.0,
+                     (unsigned long long)(info & 0xFFFFFFFF));
+            json += buf;
+            
+            count++;
+            
+            if(json.length() > JSON_BUFFER_RESERVE)
+            {
+                fwrite(json.data(), 1, json.length(), f);
+                json.clear();
+            }
+        }
+    }
+    
+    json += "]}";
+    fwrite(json.data(), 1, json.length(), f);
+    
+    return count;
+}
+
+/*
+ a file is read through FileStreamInput; elements larger than maxSizeBufferLoad
+ are not loaded until they are used, so pixel data is paged in per frame
+ and never passes through the 4D heap.
+ */
+
+imebra::DataSet *load_dataset(const path_t& path, size_t maxSizeBufferLoad){
+    
+    return imebra::CodecFactory::load(path, maxSizeBufferLoad);
+}
+
+imebra::DataSet *load_dataset(imebra::ReadMemory& mem){
+    
+    imebra::MemoryStreamInput input(mem);
+    imebra::StreamReader reader(input);
+    
+    return imebra::CodecFactory::load(reader);
+}
+
+/* everything that does not need the 4D API, so it can run on any thread */
+
+void prepare_result(dataset_result_t *result, const request_options_t& request){
+    
+    imebra::DataSet *data = result->data.get();
+    
+    if(request.json_output != json_none)
+    {
+        stage_time_t start = profile_begin(request.profile ? &result->profile : NULL);
+        
+        result->json.reserve(JSON_BUFFER_RESERVE);
+        get_json(data, request.bulk_uri, std::string(), result->json);
+        
+        profile_end(request.profile ? &result->profile : NULL, stage_json, start, result->json.length());
+    }
+    
+    size_t frames_count = data->getUnsignedLong(imebra::TagId(imebra::tagId_t::NumberOfFrames_0028_0008), 0, 1);
+    
+    std::vector<size_t> pages;
+    get_frame_list(request.frame_selection, frames_count, pages);
+    
+    result->frames.resize(pages.size());
+    
+    for(size_t i = 0; i < pages.size(); ++i)
+    {
+        result->frames[i].frame = pages[i];
+        result->frames[i].decoded = false;
+        result->frames[i].image.size = 0;
+        result->frames[i].raw.size = 0;
+        
+        if(request.profile)
+        {
+            result->frames[i].profile = std::make_shared<profile_t>();
+        }
+    }
+    
+    get_windowing(data, &result->windowing);
+    
+    if(result->cache_key.length())
+    {
+        frame_cache_put_info(result->cache_key, result->windowing, frames_count);
+    }
+}
+
+bool is_bulk_vr(imebra::tagVR_t vr){
+    
+    switch (vr) {
+        case imebra::tagVR_t::OB:
+        case imebra::tagVR_t::OD:
+        case imebra::tagVR_t::OF:
+        case imebra::tagVR_t::OL:
+        case imebra::tagVR_t::OW:
+        case imebra::tagVR_t::UN:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void bytes_to_hex(const unsigned char *bytes, size_t len, std::string& hex){
+    
+    static const char digits[] = "0123456789abcdef";
+    
+    hex.resize(len * 2);
+    
+    for(size_t i = 0; i < len; ++i)
+    {
+        hex[i * 2]     = digits[bytes[i] >> 4];
+        hex[i * 2 + 1] = digits[bytes[i] & 0x0F];
+    }
+}
+
+void bytes_to_base64(const unsigned char *bytes, size_t len, std::string& base64){
+    
+    static const char digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    
+    base64.clear();
+    base64.reserve(((len + 2) / 3) * 4);
+    
+    for(size_t i = 0; i < len; i += 3)
+    {
+        std::uint32_t n = (std::uint32_t)bytes[i] << 16;
+        if((i + 1) < len) n |= (std::uint32_t)bytes[i + 1] << 8;
+        if((i + 2) < len) n |= bytes[i + 2];
+        
+        base64 += digits[(n >> 18) & 0x3F];
+        base64 += digits[(n >> 12) & 0x3F];
+        base64 += (i + 1) < len ? digits[(n >> 6) & 0x3F] : '=';
+        base64 += (i + 2) < len ? digits[n & 0x3F] : '=';
+    }
+}
+
+#pragma mark -
+
+bool get_tag_keyword(const std::string& keyword, std::uint32_t *tag){
+    
+    std::string key(keyword);
+    std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+    
+    size_t lo = 0;
+    size_t hi = sizeof(tag_keywords) / sizeof(tag_keywords[0]);
+    
+    while(lo < hi)
+    {
+        size_t mid = (lo + hi) / 2;
+        int cmp = strcmp(key.c_str(), tag_keywords[mid].keyword);
+        if(cmp == 0)
+        {
+            *tag = tag_keywords[mid].tag;
+            return true;
+        }
+        if(cmp < 0)
+        {
+            hi = mid;
+        }else
+        {
+            lo = mid + 1;
+        }
+    }
+    
+    return false;
+}
+
+/* (gggg,eeee), gggg,eeee, ggggeeee or keyword, each optionally followed by [item] */
+
+bool get_tag_path_segment(const std::string& segment, tag_path_segment_t *path_segment){
+    
+    std::string tag(segment);
+    path_segment->item = -1;/* all items */
+    
+    size_t bracket = tag.find('[');
+    if(bracket != std::string::npos)
+    {
+        size_t end = tag.find(']', bracket);
+        if(end == std::string::npos)
+            return false;
+        
+        std::string item = tag.substr(bracket + 1, end - bracket - 1);
+        if((item.length()) && (item != "*"))
+        {
+            char *p = NULL;
+            long n = strtol(item.c_str(), &p, 10);
+            if((*p) || (n < 0))
+                return false;
+            path_segment->item = n;
+        }
+        tag = tag.substr(0, bracket);
+    }
+    
+    path_segment->name = tag;
+    
+    std::string hex;
+    for(size_t i = 0; i < tag.length(); ++i)
+    {
+        char c = tag[i];
+        if((c != '(') && (c != ')') && (c != ',') && (c != ' '))
+        {
+            hex += c;
+        }
+    }
+    
+    if((hex.length() == 8) && (hex.find_first_not_of("0123456789abcdefABCDEF") == std::string::npos))
+    {
+        std::uint32_t n = (std::uint32_t)strtoul(hex.c_str(), NULL, 16);
+        path_segment->group = (std::uint16_t)(n >> 16);
+        path_segment->element = (std::uint16_t)(n & 0xFFFF);
+        return true;
+    }
+    
+    std::uint32_t n = 0;
+    if(get_tag_keyword(tag, &n))
+    {
+        path_segment->group = (std::uint16_t)(n >> 16);
+        path_segment->element = (std::uint16_t)(n & 0xFFFF);
+        return true;
+    }
+    
+    return false;
+}
+
+bool get_tag_path(const std::string& path, tag_path_t *tag_path){
+    
+    tag_path->clear();
+    
+    size_t pos = 0;
+    while(pos <= path.length())
+    {
+        size_t dot = path.find('.', pos);
+        if(dot == std::string::npos)
+        {
+            dot = path.length();
+        }
+        
+        tag_path_segment_t segment;
+        if(!get_tag_path_segment(path.substr(pos, dot - pos), &segment))
+            return false;
+        
+        tag_path->push_back(segment);
+        pos = dot + 1;
+    }
+    
+    return tag_path->size();
+}
+
+#pragma mark -
+
+void json_append_string(const std::wstring& value, std::string& json){
+    
+    json += '"';
+    
+    for(size_t i = 0; i < value.length(); ++i)
+    {
+        std::uint32_t c = (std::uint32_t)value[i];
+        
+        /* wchar_t is UTF-16 on windows */
+        if((c >= 0xD800) && (c <= 0xDBFF) && ((i + 1) < value.length()))
+        {
+            std::uint32_t low = (std::uint32_t)value[i + 1];
+            if((low >= 0xDC00) && (low <= 0xDFFF))
+            {
+                c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+                i++;
+            }
+        }
+        
+        switch (c) {
+            case '"':  json += "\\\""; break;
+            case '\\': json += "\\\\"; break;
+            case '\b': json += "\\b";  break;
+            case '\f': json += "\\f";  break;
+            case '\n': json += "\\n";  break;
+            case '\r': json += "\\r";  break;
+            case '\t': json += "\\t";  break;
+            default:
+                if(c < 0x20)
+                {
+                    char u[8];
+                    snprintf(u, sizeof(u), "\\u%04x", c);
+                    json += u;
+                }else if(c < 0x80)
+                {
+                    json += (char)c;
+                }else if(c < 0x800)
+                {
+                    json += (char)(0xC0 | (c >> 6));
+                    json += (char)(0x80 | (c & 0x3F));
+                }else if(c < 0x10000)
+                {
+                    json += (char)(0xE0 | (c >> 12));
+                    json += (char)(0x80 | ((c >> 6) & 0x3F));
+                    json += (char)(0x80 | (c & 0x3F));
+                }else
+                {
+                    json += (char)(0xF0 | (c >> 18));
+                    json += (char)(0x80 | ((c >> 12) & 0x3F));
+                    json += (char)(0x80 | ((c >> 6) & 0x3F));
+                    json += (char)(0x80 | (c & 0x3F));
+                }
+                break;
+        }
+    }
+    
+    json += '"';
+}
+
+void json_append_utf8(const std::string& value, std::string& json){
+    
+    json += '"';
+    
+    for(size_t i = 0; i < value.length(); ++i)
+    {
+        unsigned char c = (unsigned char)value[i];
+        
+        if((c == '"') || (c == '\\'))
+        {
+            json += '\\';
+            json += (char)c;
+        }else if(c < 0x20)
+        {
+            char u[8];
+            snprintf(u, sizeof(u), "\\u%04x", c);
+            json += u;
+        }else
+        {
+            json += (char)c;
+        }
+    }
+    
+    json += '"';
+}
+
+void json_append_number(double value, std::string& json){
+    
+    if(std::isfinite(value))
+    {
+        char n[32];
+        snprintf(n, sizeof(n), "%.17g", value);
+        json += n;
+    }else
+    {
+        json += "null";
+    }
+}
+
+/* PS3.18 F.2.2: {"Alphabetic":..., "Ideographic":..., "Phonetic":...} */
+
+void json_append_person_name(const std::wstring& value, std::string& json){
+    
+    static const char *groups[] = {"\"Alphabetic\":", "\"Ideographic\":", "\"Phonetic\":"};
+    
+    json += '{';
+    
+    size_t pos = 0;
+    for(size_t i = 0; i < 3; ++i)
+    {
+        size_t end = value.find(L'=', pos);
+        std::wstring group = value.substr(pos, end == std::wstring::npos ? std::wstring::npos : end - pos);
+        
+        if(group.length())
+        {
+            if(json[json.length() - 1] != '{')
+            {
+                json += ',';
+            }
+            json += groups[i];
+            json_append_string(group, json);
+        }
+        
+        if(end == std::wstring::npos)
+            break;
+        
+        pos = end + 1;
+    }
+    
+    json += '}';
+}
+
+void json_append_values(imebra::ReadingDataHandler *handler, imebra::tagVR_t vr, std::string& json){
+    
+    size_t count = handler->getSize();
+    
+    for(size_t i = 0; i < count; ++i)
+    {
+        if(i)
+        {
+            json += ',';
+        }
+        
+        switch (vr) {
+            case imebra::tagVR_t::DS:
+            case imebra::tagVR_t::FL:
+            case imebra::tagVR_t::FD:
+                json_append_number(handler->getDouble(i), json);
+                break;
+            case imebra::tagVR_t::IS:
+            case imebra::tagVR_t::SL:
+            case imebra::tagVR_t::SS:
+                json_append_number(handler->getSignedLong(i), json);
+                break;
+            case imebra::tagVR_t::UL:
+            case imebra::tagVR_t::US:
+                json_append_number(handler->getUnsignedLong(i), json);
+                break;
+            case imebra::tagVR_t::AT:
+            {
+                char at[16];
+                snprintf(at, sizeof(at), "\"%08X\"", (unsigned int)handler->getUnsignedLong(i));
+                json += at;
+            }
+                break;
+            case imebra::tagVR_t::PN:
+                json_append_person_name(handler->getUnicodeString(i), json);
+                break;
+            default:
+                json_append_string(handler->getUnicodeString(i), json);
+                break;
+        }
+    }
+}
+
+/* bulk_uri: prefix of the BulkDataURI placeholders; path: tag path of the items above */
+
+void get_json(imebra::DataSet *data, const std::string& bulk_uri, const std::string& path, std::string& json){
+    
+    json += '{';
+    
+    imebra::tagsIds_t tags = data->getTags();
+    
+    if(json.capacity() < (json.length() + (tags.size() * JSON_BUFFER_RESERVE_PER_TAG)))
+    {
+        json.reserve(json.length() + (tags.size() * JSON_BUFFER_RESERVE_PER_TAG));
+    }
+    
+    for (imebra::tagsIds_t::iterator it = tags.begin() ; it != tags.end(); ++it)
+    {
+        imebra::TagId t = *it;
+        
+        std::unique_ptr<imebra::Tag> tag(data->getTag(t));
+        imebra::tagVR_t dataType = tag->getDataType();
+        
+        char key[16];
+        snprintf(key, sizeof(key), "%04X%04X", t.getGroupId(), t.getTagId());
+        
+        if(it != tags.begin())
+        {
+            json += ',';
+        }
+        
+        json += '"';
+        json += key;
+        json += "\":{\"vr\":\"";
+        json += (char)((int)dataType >> 8);
+        json += (char)((int)dataType & 0xFF);
+        json += '"';
+        
+        if(dataType == imebra::tagVR_t::SQ)
+        {
+            if(tag->sequenceItemExists(0))
+            {
+                json += ",\"Value\":[";
+                
+                size_t itemId = 0;
+                while(tag->sequenceItemExists(itemId))
+                {
+                    std::unique_ptr<imebra::DataSet> item(tag->getSequenceItem(itemId));
+                    
+                    char index[32];
+                    snprintf(index, sizeof(index), "/%lu/", (unsigned long)itemId);
+                    
+                    if(itemId)
+                    {
+                        json += ',';
+                    }
+                    get_json(item.get(), bulk_uri, path + key + index, json);
+                    
+                    itemId++;
+                }
+                
+                json += ']';
+            }
+        }else if(is_bulk_vr(dataType))
+        {
+            /* placeholder only, bulk data is never copied */
+            if(tag->bufferExists(0))
+            {
+                json += ",\"BulkDataURI\":";
+                json_append_utf8(bulk_uri + path + key, json);
+            }
+        }else if(tag->bufferExists(0))
+        {
+            std::unique_ptr<imebra::ReadingDataHandler> handler(tag->getReadingDataHandler(0));
+            
+            if(handler->getSize())
+            {
+                json += ",\"Value\":[";
+                json_append_values(handler.get(), dataType, json);
+                json += ']';
+            }
+        }
+        
+        json += '}';
+    }
+    
+    json += '}';
+}
+
+#pragma mark -
+
+void get_windowing(imebra::DataSet *data, windowing_t *windowing){
+    
+    windowing->colorSpace = imebra::ColorTransformsFactory::normalizeColorSpace(data->getString(imebra::TagId(imebra::tagId_t::PhotometricInterpretation_0028_0004), 0, ""));
+    windowing->monochrome1 = (windowing->colorSpace == "MONOCHROME1");
+    
+    windowing->vois = data->getVOIs();
+    
+    for(size_t scanLUTs(0); ; ++scanLUTs)
+    {
+        try
+        {
+            windowing->luts.push_back((std::shared_ptr<imebra::LUT>)data->getLUT(imebra::TagId(imebra::tagId_t::VOILUTSequence_0028_3010), scanLUTs));
+        }
+        catch(...)
+        {
+            break;
+        }
+    }
+    
+    windowing->slope = data->getDouble(imebra::TagId(imebra::tagId_t::RescaleSlope_0028_1053), 0, 1.0);
+    windowing->intercept = data->getDouble(imebra::TagId(imebra::tagId_t::RescaleIntercept_0028_1052), 0, 0.0);
+    
+    /* a modality LUT is left to imebra */
+    bool modality_lut = false;
+    try
+    {
+        std::unique_ptr<imebra::DataSet> item(data->getSequenceItem(imebra::TagId(imebra::tagId_t::ModalityLUTSequence_0028_3000), 0));
+        modality_lut = true;
+    }
+    catch(...)
+    {
+        
+    }
+    
+    windowing->fused = imebra::ColorTransformsFactory::isMonochrome(windowing->colorSpace) && (!modality_lut) && (windowing->slope != 0.0);
+    
+    /* 8-bit colour JPEG needs neither VOI nor colour conversion to be shown as .jpeg */
+    std::string transferSyntax = data->getString(imebra::TagId(imebra::tagId_t::TransferSyntaxUID_0002_0010), 0, "");
+    
+    windowing->transfer_syntax = get_transfer_syntax_index(transferSyntax);
+    
+    /* the fragment index is built on first access, once for all threads */
+    windowing->fragments.reset();
+    
+    if((transferSyntax.length())
+       && (transferSyntax != "1.2.840.10008.1.2")
+       && (transferSyntax != "1.2.840.10008.1.2.1")
+       && (transferSyntax != "1.2.840.10008.1.2.1.99")
+       && (transferSyntax != "1.2.840.10008.1.2.2"))
+    {
+        windowing->fragments = std::make_shared<fragment_index_t>();
+        windowing->fragments->ready = false;
+    }
+    
+    /* YBR_FULL and YBR_FULL_422 (normalized to YBR_FULL) only: a viewer takes a 3-component
+     JPEG without an APP14 marker for YCbCr, so an RGB-coded stream would show wrong colors */
+    windowing->jpeg_baseline = ((transferSyntax == "1.2.840.10008.1.2.4.50") || (transferSyntax == "1.2.840.10008.1.2.4.51"))
+    && (windowing->colorSpace == "YBR_FULL")
+    && (data->getUnsignedLong(imebra::TagId(imebra::tagId_t::SamplesPerPixel_0028_0002), 0, 0) == 3)
+    && (data->getUnsignedLong(imebra::TagId(imebra::tagId_t::BitsAllocated_0028_0100), 0, 0) == 8);
+    
+    /* the table for the declared pixel format is built once and shared by all frames */
+    windowing->table_ready = false;
+    
+    if(windowing->fused && ((!windowing->vois.empty()) || (!windowing->luts.empty())))
+    {
+        std::uint32_t bitsAllocated = data->getUnsignedLong(imebra::TagId(imebra::tagId_t::BitsAllocated_0028_0100), 0, 0);
+        bool isSigned = data->getUnsignedLong(imebra::TagId(imebra::tagId_t::PixelRepresentation_0028_0103), 0, 0) != 0;
+        
+        switch (bitsAllocated) {
+            case 8:
+                windowing->table_depth = isSigned ? imebra::bitDepth_t::depthS8 : imebra::bitDepth_t::depthU8;
+                windowing->table_ready = true;
+                break;
+            case 16:
+                windowing->table_depth = isSigned ? imebra::bitDepth_t::depthS16 : imebra::bitDepth_t::depthU16;
+                windowing->table_ready = true;
+                break;
+            default:
+                break;
+        }
+        
+        if(windowing->table_ready)
+        {
+            if(!windowing->vois.empty())
+            {
+                build_window_table(*windowing, windowing->table_depth, windowing->vois[0].center, windowing->vois[0].width, windowing->table);
+            }else
+            {
+                build_lut_table(*windowing, windowing->table_depth, *(windowing->luts.front().get()), windowing->table);
+            }
+        }
+    }
+}
+
+static bool get_depth_range(imebra::bitDepth_t depth, std::int32_t *min_value, std::int32_t *max_value){
+    
+    switch (depth) {
+        case imebra::bitDepth_t::depthU8:
+            *min_value = 0;
+            *max_value = 0xFF;
+            return true;
+        case imebra::bitDepth_t::depthS8:
+            *min_value = -0x80;
+            *max_value = 0x7F;
+            return true;
+        case imebra::bitDepth_t::depthU16:
+            *min_value = 0;
+            *max_value = 0xFFFF;
+            return true;
+        case imebra::bitDepth_t::depthS16:
+            *min_value = -0x8000;
+            *max_value = 0x7FFF;
+            return true;
+        default:
+            return false;
+    }
+}
+
+void build_window_table(const windowing_t& windowing, imebra::bitDepth_t depth, double center, double width, std::vector<unsigned char>& table){
+    
+    /* stored value -> modality rescale -> linear VOI (PS3.3 C.11.2.1.2) -> MONOCHROME1 inversion */
+    std::int32_t min_value, max_value;
+    
+    if(get_depth_range(depth, &min_value, &max_value))
+    {
+        table.resize(max_value - min_value + 1);
+        
+        if(width < 1.0) width = 1.0;
+        
+        double low = center - 0.5 - (width - 1.0) / 2.0;
+        double high = center - 0.5 + (width - 1.0) / 2.0;
+        
+        for(std::int32_t i = min_value; i <= max_value; ++i)
+        {
+            double x = i * windowing.slope + windowing.intercept;
+            int y;
+            
+            if(x <= low)
+            {
+                y = 0;
+            }else if(x > high)
+            {
+                y = 255;
+            }else
+            {
+                y = (int)((((x - (center - 0.5)) / (width - 1.0)) + 0.5) * 255.0 + 0.5);
+                if(y < 0) y = 0;
+                if(y > 255) y = 255;
+            }
+            
+            table[i - min_value] = (unsigned char)(windowing.monochrome1 ? 255 - y : y);
+        }
+    }
+}
+
+void build_lut_table(const windowing_t& windowing, imebra::bitDepth_t depth, const imebra::LUT& lut, std::vector<unsigned char>& table){
+    
+    std::int32_t min_value, max_value;
+    
+    if(get_depth_range(depth, &min_value, &max_value))
+    {
+        table.resize(max_value - min_value + 1);
+        
+        std::int32_t first = lut.getFirstMapped();
+        std::int32_t last = first + (std::int32_t)lut.getSize() - 1;
+        double scale = 255.0 / (double)((1u << lut.getBits()) - 1);
+        
+        for(std::int32_t i = min_value; i <= max_value; ++i)
+        {
+            double x = i * windowing.slope + windowing.intercept;
+            std::int32_t index = (std::int32_t)floor(x + 0.5);
+            
+            if(index < first) index = first;
+            if(index > last) index = last;
+            
+            int y = (int)(lut.getMappedValue(index) * scale + 0.5);
+            if(y > 255) y = 255;
+            
+            table[i - min_value] = (unsigned char)(windowing.monochrome1 ? 255 - y : y);
+        }
+    }
+}
+
+template <typename T> static void get_samples_range(const T *samples, size_t count, std::int32_t *min_value, std::int32_t *max_value){
+    
+    T lo = samples[0];
+    T hi = samples[0];
+    
+    for(size_t i = 1; i < count; ++i)
+    {
+        if(samples[i] < lo) lo = samples[i];
+        if(samples[i] > hi) hi = samples[i];
+    }
+    
+    *min_value = lo;
+    *max_value = hi;
+}
+
+template <typename T> static void lookup_samples(const T *samples, std::uint32_t width, std::uint32_t height, const unsigned char *table, std::int32_t min_value, gdImagePtr gd, bitmap_buffer_t *bitmap){
+    
+    /* one pass: table lookup straight into the gd image, or into BGRA rows for the BMP container; top-down like the frame */
+    for(std::uint32_t y = 0; y < height; ++y)
+    {
+        if(gd)
+        {
+            int *row = gd->tpixels[y];
+            
+            for(std::uint32_t x = 0; x < width; ++x)
+            {
+                unsigned char v = table[(std::int32_t)*samples++ - min_value];
+                row[x] = gdTrueColor(v, v, v);
+            }
+        }else
+        {
+            unsigned char *p = (unsigned char *)&bitmap->at((size_t)y * width * 4);
+            
+            for(std::uint32_t x = 0; x < width; ++x)
+            {
+                unsigned char v = table[(std::int32_t)*samples++ - min_value];
+                *p++ = v;
+                *p++ = v;
+                *p++ = v;
+                *p++ = 0xFF;
+            }
+        }
+    }
+}
+
+bool render_monochrome(const imebra::Image& image, const windowing_t& windowing, const image_options_t& image_options, render_frame_t *frame){
+    
+    imebra::bitDepth_t depth = image.getDepth();
+    std::int32_t min_value, max_value;
+    
+    if((image.getChannelsNumber() != 1) || (!get_depth_range(depth, &min_value, &max_value)))
+        return false;
+    
+    std::uint32_t width = image.getWidth();
+    std::uint32_t height = image.getHeight();
+    size_t count = (size_t)width * height;
+    
+    std::unique_ptr<imebra::ReadingDataHandlerNumeric> dataHandler(image.getReadingDataHandler());
+    
+    size_t dataSize = 0;
+    const char *samples = dataHandler->data(&dataSize);
+    
+    if((!samples) || (!count) || (dataSize < count * dataHandler->getUnitSize()))
+        return false;
+    
+    profile_t *profile = frame->profile.get();
+    stage_time_t start = profile_begin(profile);
+    
+    const std::vector<unsigned char> *table = &windowing.table;
+    std::vector<unsigned char> frame_table;
+    
+    if((!windowing.table_ready) || (windowing.table_depth != depth))
+    {
+        if(!windowing.vois.empty())
+        {
+            build_window_table(windowing, depth, windowing.vois[0].center, windowing.vois[0].width, frame_table);
+        }else if(!windowing.luts.empty())
+        {
+            build_lut_table(windowing, depth, *(windowing.luts.front().get()), frame_table);
+        }else
+        {
+            /* no window in the dataset: span the frame's own range, like applyOptimalVOI */
+            std::int32_t lo = 0, hi = 0;
+            switch (depth) {
+                case imebra::bitDepth_t::depthU8:
+                    get_samples_range((const std::uint8_t *)samples, count, &lo, &hi);
+                    break;
+                case imebra::bitDepth_t::depthS8:
+                    get_samples_range((const std::int8_t *)samples, count, &lo, &hi);
+                    break;
+                case imebra::bitDepth_t::depthU16:
+                    get_samples_range((const std::uint16_t *)samples, count, &lo, &hi);
+                    break;
+                default:
+                    get_samples_range((const std::int16_t *)samples, count, &lo, &hi);
+                    break;
+            }
+            double a = lo * windowing.slope + windowing.intercept;
+            double b = hi * windowing.slope + windowing.intercept;
+            double low = a < b ? a : b;
+            double high = a < b ? b : a;
+            build_window_table(windowing, depth, (low + high) / 2.0 + 0.5, high - low + 1.0, frame_table);
+        }
+        table = &frame_table;
+        
+        profile_end(profile, stage_voi, start, frame_table.size());
+    }
+    
+    start = profile_begin(profile);
+    
+    bool bmp = (image_options.format == image_format_bmp) && (image_options.jpeg_quality == 0);
+    
+    gdImagePtr gd = NULL;
+    bitmap_buffer_t bitmap;
+    
+    if(bmp)
+    {
+        bitmap.resize(count * 4);
+    }else
+    {
+        gd = gdImageCreateTrueColor(width, height);
+        if(!gd)
+            return false;
+    }
+    
+    switch (depth) {
+        case imebra::bitDepth_t::depthU8:
+            lookup_samples((const std::uint8_t *)samples, width, height, &table->at(0), min_value, gd, &bitmap);
+            break;
+        case imebra::bitDepth_t::depthS8:
+            lookup_samples((const std::int8_t *)samples, width, height, &table->at(0), min_value, gd, &bitmap);
+            break;
+        case imebra::bitDepth_t::depthU16:
+            lookup_samples((const std::uint16_t *)samples, width, height, &table->at(0), min_value, gd, &bitmap);
+            break;
+        default:
+            lookup_samples((const std::int16_t *)samples, width, height, &table->at(0), min_value, gd, &bitmap);
+            break;
+    }
+    
+    profile_end(profile, stage_bitmap, start, count * 4);
+    
+    start = profile_begin(profile);
+    
+    if(gd)
+    {
+        encode_image(gd, image_options, &frame->image);
+        gdImageDestroy(gd);
+    }else
+    {
+        encode_bmp(bitmap, width, height, &frame->image);
+    }
+    
+    profile_end(profile, stage_encode, start, frame->image.size);
+    
+    return true;
+}
+
+template <typename T> static void downsample_samples(const T *source, std::uint32_t width, std::uint32_t height, std::uint32_t channels, std::uint32_t factor, T *destination, std::uint32_t out_width, std::uint32_t out_height){
+    
+    std::vector<double> sums((size_t)out_width * channels);
+    
+    for(std::uint32_t oy = 0; oy < out_height; ++oy)
+    {
+        std::uint32_t y0 = oy * factor;
+        std::uint32_t y1 = std::min(y0 + factor, height);
+        
+        std::fill(sums.begin(), sums.end(), 0.0);
+        
+        for(std::uint32_t y = y0; y < y1; ++y)
+        {
+            const T *row = source + (size_t)y * width * channels;
+            
+            for(std::uint32_t x = 0; x < width; ++x)
+            {
+                double *sum = &sums[(size_t)(x / factor) * channels];
+                
+                for(std::uint32_t c = 0; c < channels; ++c)
+                {
+                    sum[c] += *row++;
+                }
+            }
+        }
+        
+        for(std::uint32_t ox = 0; ox < out_width; ++ox)
+        {
+            std::uint32_t x0 = ox * factor;
+            double area = (double)(y1 - y0) * (std::min(x0 + factor, width) - x0);
+            
+            for(std::uint32_t c = 0; c < channels; ++c)
+            {
+                *destination++ = (T)std::floor(sums[(size_t)ox * channels + c] / area + 0.5);
+            }
+        }
+    }
+}
+
+imebra::Image *downsample_image(const imebra::Image& image, std::uint32_t max_width, std::uint32_t max_height){
+    
+    /* area averaging on the decoded samples, before any VOI or colour transform */
+    std::uint32_t width = image.getWidth();
+    std::uint32_t height = image.getHeight();
+    std::uint32_t factor = 1;
+    
+    if(max_width && (width > max_width))
+    {
+        factor = std::max(factor, (width + max_width - 1) / max_width);
+    }
+    
+    if(max_height && (height > max_height))
+    {
+        factor = std::max(factor, (height + max_height - 1) / max_height);
+    }
+    
+    if(factor < 2)
+        return NULL;
+    
+    std::uint32_t out_width = (width + factor - 1) / factor;
+    std::uint32_t out_height = (height + factor - 1) / factor;
+    std::uint32_t channels = image.getChannelsNumber();
+    
+    std::unique_ptr<imebra::ReadingDataHandlerNumeric> source(image.getReadingDataHandler());
+    size_t sourceSize = 0;
+    const char *samples = source->data(&sourceSize);
+    
+    if((!samples) || (sourceSize < (size_t)width * height * channels * source->getUnitSize()))
+        return NULL;
+    
+    imebra::Image *thumbnail = new imebra::Image(out_width, out_height, image.getDepth(), image.getColorSpace(), image.getHighBit());
+    
+    {
+        std::unique_ptr<imebra::WritingDataHandlerNumeric> destination(thumbnail->getWritingDataHandler());
+        size_t destinationSize = 0;
+        char *pixels = destination->data(&destinationSize);
+        
+        switch (image.getDepth()) {
+            case imebra::bitDepth_t::depthU8:
+                downsample_samples((const std::uint8_t *)samples, width, height, channels, factor, (std::uint8_t *)pixels, out_width, out_height);
+                break;
+            case imebra::bitDepth_t::depthS8:
+                downsample_samples((const std::int8_t *)samples, width, height, channels, factor, (std::int8_t *)pixels, out_width, out_height);
+                break;
+            case imebra::bitDepth_t::depthU16:
+                downsample_samples((const std::uint16_t *)samples, width, height, channels, factor, (std::uint16_t *)pixels, out_width, out_height);
+                break;
+            case imebra::bitDepth_t::depthS16:
+                downsample_samples((const std::int16_t *)samples, width, height, channels, factor, (std::int16_t *)pixels, out_width, out_height);
+                break;
+            case imebra::bitDepth_t::depthU32:
+                downsample_samples((const std::uint32_t *)samples, width, height, channels, factor, (std::uint32_t *)pixels, out_width, out_height);
+                break;
+            case imebra::bitDepth_t::depthS32:
+                downsample_samples((const std::int32_t *)samples, width, height, channels, factor, (std::int32_t *)pixels, out_width, out_height);
+                break;
+        }
+        /* the samples are committed to the image when the handler goes away */
+    }
+    
+    return thumbnail;
+}
+
+#pragma mark -
+
+/*
+ large per-frame buffers (bitmaps, .bmp and encapsulated JPEG bytes) are recycled here.
+ a thread first reuses its own blocks, without a lock; the render and batch helpers are
+ work_threads, kept between calls, so their blocks are still there for the next call.
+ what a thread cannot keep goes to the shared tier, which has one lock per size class,
+ and so do its blocks when it exits. requests below 64KB or above the last class use malloc.
+ */
+
+buffer_pool_t buffer_pool = {{BUFFER_POOL_THREAD_BUDGET}, {BUFFER_POOL_SHARED_BUDGET}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}, {}};
+
+/* four classes per power of two: 64KB, 80KB, 96KB, 112KB, 128KB... up to 448MB */
+
+static size_t get_buffer_class_size(size_t index){
+    
+    size_t base = (size_t)1 << (BUFFER_POOL_MIN_SHIFT + index / 4);
+    
+    return base + (base / 4) * (index % 4);
+}
+
+static bool get_buffer_class(size_t size, size_t *index){
+    
+    for(size_t i = 0; i < BUFFER_POOL_CLASSES; ++i)
+    {
+        if(size <= get_buffer_class_size(i))
+        {
+            *index = i;
+            return size >= ((size_t)1 << BUFFER_POOL_MIN_SHIFT);
+        }
+    }
+    
+    return false;
+}
+
+static void buffer_cache_free(buffer_cache_t *cache){
+    
+    for(size_t i = 0; i < BUFFER_POOL_CLASSES; ++i)
+    {
+        for(std::vector<void *>::iterator it = cache->blocks[i].begin(); it != cache->blocks[i].end(); ++it)
+        {
+            free(*it);
+        }
+        buffer_pool.thread_bytes.fetch_sub(get_buffer_class_size(i) * cache->blocks[i].size(), std::memory_order_relaxed);
+        cache->blocks[i].clear();
+    }
+    
+    cache->bytes = 0;
+}
+
+buffer_thread_t::buffer_thread_t() : cache(&blocks), flush(false){
+    
+    blocks.bytes = 0;
+    
+    std::lock_guard<std::mutex> lock(buffer_pool.threads_mutex);
+    buffer_pool.threads.push_back(this);
+}
+
+static buffer_thread_t *get_buffer_thread(){
+    
+    static thread_local buffer_thread_t thread;
+    
+    return &thread;
+}
+
+/* back to the thread when it is done with cache; a flush that came meanwhile is done here */
+
+static void buffer_thread_return(buffer_thread_t *thread, buffer_cache_t *cache){
+    
+    if(thread->flush.exchange(false))
+    {
+        buffer_cache_free(cache);
+    }
+    
+    thread->cache.store(cache, std::memory_order_release);
+}
+
+/* true if the shared tier took the block */
+
+static bool buffer_pool_share(void *p, size_t index){
+    
+    size_t size = get_buffer_class_size(index);
+    
+    if((buffer_pool.shared_bytes.fetch_add(size, std::memory_order_relaxed) + size) > buffer_pool.shared_budget.load(std::memory_order_relaxed))
+    {
+        buffer_pool.shared_bytes.fetch_sub(size, std::memory_order_relaxed);
+        return false;
+    }
+    
+    buffer_class_t *shared = &buffer_pool.shared[index];
+    
+    stage_time_t start = profile_begin(NULL);
+    std::lock_guard<std::mutex> lock(shared->mutex);
+    profile_end(NULL, stage_wait, start, 0);
+    
+    shared->blocks.push_back(p);
+    
+    return true;
+}
+
+buffer_thread_t::~buffer_thread_t(){
+    
+    /* buffer_pool_flush only takes cache under threads_mutex */
+    {
+        std::lock_guard<std::mutex> lock(buffer_pool.threads_mutex);
+        buffer_pool.threads.remove(this);
+    }
+    
+    for(size_t i = 0; i < BUFFER_POOL_CLASSES; ++i)
+    {
+        for(std::vector<void *>::iterator it = blocks.blocks[i].begin(); it != blocks.blocks[i].end(); ++it)
+        {
+            buffer_pool.thread_bytes.fetch_sub(get_buffer_class_size(i), std::memory_order_relaxed);
+            
+            if(!buffer_pool_share(*it, i))
+            {
+                free(*it);
+            }
+        }
+    }
+}
+
+void *buffer_pool_acquire(size_t size){
+    
+    size_t index;
+    
+    if(!get_buffer_class(size, &index))
+        return malloc(size ? size : 1);
+    
+    /* the whole class is allocated even with both tiers disabled, so that any block can be kept later */
+    size_t class_size = get_buffer_class_size(index);
+    
+    if(buffer_pool.thread_budget.load(std::memory_order_relaxed))
+    {
+        buffer_thread_t *thread = get_buffer_thread();
+        buffer_cache_t *cache = thread->cache.exchange(NULL, std::memory_order_acquire);
+        
+        /* NULL: buffer_pool_flush has it; go on with the shared tier */
+        if(cache)
+        {
+            void *p = NULL;
+            
+            if(!cache->blocks[index].empty())
+            {
+                p = cache->blocks[index].back();
+                cache->blocks[index].pop_back();
+                cache->bytes -= class_size;
+                buffer_pool.thread_bytes.fetch_sub(class_size, std::memory_order_relaxed);
+                buffer_pool.thread_hits.fetch_add(1, std::memory_order_relaxed);
+            }
+            
+            buffer_thread_return(thread, cache);
+            
+            if(p)
+                return p;
+        }
+    }
+    
+    if(buffer_pool.shared_bytes.load(std::memory_order_relaxed))
+    {
+        buffer_class_t *shared = &buffer_pool.shared[index];
+        
+        stage_time_t start = profile_begin(NULL);
+        std::lock_guard<std::mutex> lock(shared->mutex);
+        profile_end(NULL, stage_wait, start, 0);
+        
+        if(!shared->blocks.empty())
+        {
+            void *p = shared->blocks.back();
+            shared->blocks.pop_back();
+            buffer_pool.shared_bytes.fetch_sub(class_size, std::memory_order_relaxed);
+            buffer_pool.shared_hits.fetch_add(1, std::memory_order_relaxed);
+            return p;
+        }
+    }
+    
+    buffer_pool.misses.fetch_add(1, std::memory_order_relaxed);
+    
+    return malloc(class_size);
+}
+
+void buffer_pool_release(void *p, size_t size){
+    
+    size_t index;
+    
+    if(!p)
+        return;
+    
+    if(!get_buffer_class(size, &index))
+    {
+        free(p);
+        return;
+    }
+    
+    size_t class_size = get_buffer_class_size(index);
+    size_t thread_budget = buffer_pool.thread_budget.load(std::memory_order_relaxed);
+    
+    if(thread_budget)
+    {
+        buffer_thread_t *thread = get_buffer_thread();
+        buffer_cache_t *cache = thread->cache.exchange(NULL, std::memory_order_acquire);
+        
+        if(cache)
+        {
+            bool kept = (cache->bytes + class_size) <= thread_budget;
+            
+            if(kept)
+            {
+                cache->blocks[index].push_back(p);
+                cache->bytes += class_size;
+                buffer_pool.thread_bytes.fetch_add(class_size, std::memory_order_relaxed);
+                buffer_pool.thread_releases.fetch_add(1, std::memory_order_relaxed);
+            }
+            
+            buffer_thread_return(thread, cache);
+            
+            if(kept)
+                return;
+        }
+    }
+    
+    if(buffer_pool_share(p, index))
+    {
+        buffer_pool.shared_releases.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    
+    buffer_pool.frees.fetch_add(1, std::memory_order_relaxed);
+    
+    free(p);
+}
+
+/* for encoded_image_t: the block goes back to the pool with the last reference */
+
+std::shared_ptr<void> buffer_pool_shared_ptr(size_t size){
+    
+    void *p = buffer_pool_acquire(size);
+    
+    if(!p)
+        return std::shared_ptr<void>();
+    
+    return std::shared_ptr<void>(p, [size](void *block){ buffer_pool_release(block, size); });
+}
+
+/*
+ every kept block, whichever thread released it; a thread in the middle of an acquire or
+ release frees its own blocks when it is done with them.
+ */
+
+void buffer_pool_flush(){
+    
+    {
+        std::lock_guard<std::mutex> lock(buffer_pool.threads_mutex);
+        
+        for(std::list<buffer_thread_t *>::iterator it = buffer_pool.threads.begin(); it != buffer_pool.threads.end(); ++it)
+        {
+            buffer_thread_t *thread = *it;
+            buffer_cache_t *cache = thread->cache.exchange(NULL, std::memory_order_acquire);
+            
+            if(cache)
+            {
+                buffer_cache_free(cache);
+                thread->cache.store(cache, std::memory_order_release);
+            }else
+            {
+                thread->flush = true;
+            }
+        }
+    }
+    
+    for(size_t i = 0; i < BUFFER_POOL_CLASSES; ++i)
+    {
+        buffer_class_t *shared = &buffer_pool.shared[i];
+        
+        std::lock_guard<std::mutex> lock(shared->mutex);
+        
+        for(std::vector<void *>::iterator it = shared->blocks.begin(); it != shared->blocks.end(); ++it)
+        {
+            free(*it);
+        }
+        buffer_pool.shared_bytes.fetch_sub(get_buffer_class_size(i) * shared->blocks.size(), std::memory_order_relaxed);
+        shared->blocks.clear();
+    }
+}
+
+#pragma mark -
+
+/*
+ decoded frames, either stored (fused and raw output) or after the modality transform,
+ keyed by a hash of the input; the windowing of each input is kept with them
+ so that a fully cached request does not load the dataset at all.
+ */
+
+frame_cache_t frame_cache = {{FRAME_CACHE_BUDGET}, {}, {}, {}};
+
+static std::uint64_t xxh64_rotl(std::uint64_t x, int r){
+    
+    return (x << r) | (x >> (64 - r));
+}
+
+static std::uint64_t xxh64_round(std::uint64_t acc, std::uint64_t input){
+    
+    acc += input * 0xC2B2AE3D27D4EB4FULL;
+    acc = xxh64_rotl(acc, 31);
+    
+    return acc * 0x9E3779B185EBCA87ULL;
+}
+
+static std::uint64_t xxh64_merge(std::uint64_t acc, std::uint64_t value){
+    
+    acc ^= xxh64_round(0, value);
+    
+    return acc * 0x9E3779B185EBCA87ULL + 0x85EBCA77C2B2AE63ULL;
+}
+
+/* XXH64; unlike FNV over words, every input bit reaches every bit of the hash */
+
+std::uint64_t xxh64(const char *bytes, size_t size, std::uint64_t seed){
+    
+    static const std::uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+    static const std::uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+    static const std::uint64_t prime3 = 0x165667B19E3779F9ULL;
+    static const std::uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+    static const std::uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+    
+    const char *p = bytes;
+    const char *end = bytes + size;
+    std::uint64_t hash;
+    
+    if(size >= 32)
+    {
+        std::uint64_t v[4] = {seed + prime1 + prime2, seed + prime2, seed, seed - prime1};
+        
+        for(; (end - p) >= 32; p += 32)
+        {
+            for(int i = 0; i < 4; ++i)
+            {
+                std::uint64_t word;
+                memcpy(&word, p + (i * 8), 8);
+                v[i] = xxh64_round(v[i], word);
+            }
+        }
+        
+        hash = xxh64_rotl(v[0], 1) + xxh64_rotl(v[1], 7) + xxh64_rotl(v[2], 12) + xxh64_rotl(v[3], 18);
+        
+        for(int i = 0; i < 4; ++i)
+        {
+            hash = xxh64_merge(hash, v[i]);
+        }
+    }else
+    {
+        hash = seed + prime5;
+    }
+    
+    hash += (std::uint64_t)size;
+    
+    for(; (end - p) >= 8; p += 8)
+    {
+        std::uint64_t word;
+        memcpy(&word, p, 8);
+        hash ^= xxh64_round(0, word);
+        hash = xxh64_rotl(hash, 27) * prime1 + prime4;
+    }
+    
+    if((end - p) >= 4)
+    {
+        std::uint32_t word;
+        memcpy(&word, p, 4);
+        hash ^= (std::uint64_t)word * prime1;
+        hash = xxh64_rotl(hash, 23) * prime2 + prime3;
+        p += 4;
+    }
+    
+    for(; p < end; ++p)
+    {
+        hash ^= (unsigned char)*p * prime5;
+        hash = xxh64_rotl(hash, 11) * prime1;
+    }
+    
+    hash ^= hash >> 33;
+    hash *= prime2;
+    hash ^= hash >> 29;
+    hash *= prime3;
+    hash ^= hash >> 32;
+    
+    return hash;
+}
+
+void get_cache_key(const char *bytes, size_t size, std::string& key){
+    
+    char buf[64];
+    snprintf(buf, sizeof(buf), "blob:%016llx:%llu", (unsigned long long)xxh64(bytes, size, 0), (unsigned long long)size);
+    
+    element_source_t source = {(const unsigned char *)bytes, NULL, size};
+    std::string instance;
+    get_instance_key(source, instance);
+    
+    key = buf + instance;
+}
+
+void get_cache_key(const path_t& path, std::string& key){
+    
+    /* a file is identified by its path, size, modification and change dates, and inode where there is one */
+#if defined(_WIN32)
+    struct _stat64 st;
+    if(_wstat64(path.c_str(), &st) != 0)
+    {
+        key.clear();
+        return;
+    }
+    std::wstring_convert<std::codecvt_utf8_utf16<wchar_t> > convert;
+    std::string name(convert.to_bytes(path));
+    /* st_ctime is the creation date on windows, and there is no inode */
+    long long modified = (long long)st.st_mtime * 1000000000LL;
+    long long changed = (long long)st.st_ctime * 1000000000LL;
+    unsigned long long inode = 0;
+#else
+    struct stat st;
+    if(stat(path.c_str(), &st) != 0)
+    {
+        key.clear();
+        return;
+    }
+    std::string name(path);
+#if defined(__APPLE__)
+    long long modified = (long long)st.st_mtimespec.tv_sec * 1000000000LL + st.st_mtimespec.tv_nsec;
+    long long changed = (long long)st.st_ctimespec.tv_sec * 1000000000LL + st.st_ctimespec.tv_nsec;
+#else
+    long long modified = (long long)st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+    long long changed = (long long)st.st_ctim.tv_sec * 1000000000LL + st.st_ctim.tv_nsec;
+#endif
+    unsigned long long inode = (unsigned long long)st.st_ino;
+#endif
+    
+    char buf[96];
+    snprintf(buf, sizeof(buf), ":%llu:%lld:%lld:%llu", (unsigned long long)st.st_size, modified, changed, inode);
+    key = "file:" + name + buf;
+    
+    /*
+     a file replaced with the same size within the resolution of its dates keeps them;
+     that can only happen while the dates are recent, so only then is the instance read from the file.
+     */
+    long long now = (long long)time(NULL);
+    if(((now - (long long)st.st_mtime) >= CACHE_KEY_SETTLED) && ((now - (long long)st.st_ctime) >= CACHE_KEY_SETTLED))
+        return;
+    
+#if defined(_WIN32)
+    FILE *f = _wfopen(path.c_str(), L"rb");
+#else
+    FILE *f = fopen(path.c_str(), "rb");
+#endif
+    
+    if(!f)
+    {
+        key.clear();
+        return;
+    }
+    
+    element_source_t source = {NULL, f, (std::uint64_t)st.st_size};
+    std::string instance;
+    get_instance_key(source, instance);
+    fclose(f);
+    
+    key += instance;
+}
+
+static std::string get_frame_key(const std::string& cache_key, size_t page, bool modality){
+    
+    char buf[32];
+    snprintf(buf, sizeof(buf), "/%lu/%c", (unsigned long)page, modality ? 'm' : 's');
+    
+    return cache_key + buf;
+}
+
+static size_t get_image_size(const imebra::Image& image){
+    
+    size_t unit = 4;
+    
+    switch (image.getDepth()) {
+        case imebra::bitDepth_t::depthU8:
+        case imebra::bitDepth_t::depthS8:
+            unit = 1;
+            break;
+        case imebra::bitDepth_t::depthU16:
+        case imebra::bitDepth_t::depthS16:
+            unit = 2;
+            break;
+        default:
+            break;
+    }
+    
+    return (size_t)image.getWidth() * image.getHeight() * image.getChannelsNumber() * unit;
+}
+
+frame_cache_shard_t *get_frame_cache_shard(const std::string& cache_key){
+    
+    return &frame_cache.shards[std::hash<std::string>()(cache_key) % FRAME_CACHE_SHARDS];
+}
+
+/* call with the shard locked */
+
+static void frame_cache_evict(frame_cache_shard_t *shard){
+    
+    cached_frame_t& last = shard->lru.back();
+    
+    std::map<std::string, cached_info_t>::iterator info = shard->infos.find(last.cache_key);
+    if(info != shard->infos.end())
+    {
+        if(--info->second.frames == 0)
+        {
+            shard->infos.erase(info);
+        }
+    }
+    
+    shard->bytes -= last.size;
+    frame_cache.bytes.fetch_sub(last.size, std::memory_order_relaxed);
+    shard->index.erase(last.key);
+    shard->lru.pop_back();
+    shard->evictions++;
+}
+
+/*
+ call with no shard locked; evicts the least recently used frame of all shards
+ until the whole cache fits in budget. the shards are locked one at a time.
+ */
+
+void frame_cache_trim(size_t budget){
+    
+    while(frame_cache.bytes.load(std::memory_order_relaxed) > budget)
+    {
+        frame_cache_shard_t *oldest = NULL;
+        std::uint64_t used = 0;
+        
+        for(size_t i = 0; i < FRAME_CACHE_SHARDS; ++i)
+        {
+            frame_cache_shard_t *shard = &frame_cache.shards[i];
+            
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            
+            if((!shard->lru.empty()) && ((!oldest) || (shard->lru.back().used < used)))
+            {
+                oldest = shard;
+                used = shard->lru.back().used;
+            }
+        }
+        
+        if(!oldest)
+            return;
+        
+        std::lock_guard<std::mutex> lock(oldest->mutex);
+        
+        /* found or evicted by another thread in the meantime: look again */
+        if((!oldest->lru.empty()) && (oldest->lru.back().used == used))
+        {
+            frame_cache_evict(oldest);
+        }
+    }
+}
+
+std::shared_ptr<imebra::Image> frame_cache_get(const std::string& cache_key, const std::string& key){
+    
+    frame_cache_shard_t *shard = get_frame_cache_shard(cache_key);
+    
+    stage_time_t start = profile_begin(NULL);
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    profile_end(NULL, stage_wait, start, 0);
+    
+    std::map<std::string, std::list<cached_frame_t>::iterator>::iterator it = shard->index.find(key);
+    if(it == shard->index.end())
+    {
+        shard->misses++;
+        statistics.frame_cache_misses.fetch_add(1, std::memory_order_relaxed);
+        return std::shared_ptr<imebra::Image>();
+    }
+    
+    /* most recently used first */
+    shard->lru.splice(shard->lru.begin(), shard->lru, it->second);
+    it->second->used = frame_cache.clock.fetch_add(1, std::memory_order_relaxed);
+    shard->hits++;
+    statistics.frame_cache_hits.fetch_add(1, std::memory_order_relaxed);
+    
+    return it->second->image;
+}
+
+void frame_cache_put(const std::string& cache_key, const std::string& key, std::shared_ptr<imebra::Image> image){
+    
+    size_t size = get_image_size(*image);
+    size_t budget = frame_cache.budget.load(std::memory_order_relaxed);
+    
+    if(size > budget)
+        return;
+    
+    frame_cache_shard_t *shard = get_frame_cache_shard(cache_key);
+    
+    {
+        stage_time_t start = profile_begin(NULL);
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        profile_end(NULL, stage_wait, start, 0);
+        
+        if(shard->index.count(key))
+            return;
+        
+        cached_frame_t frame;
+        frame.key = key;
+        frame.cache_key = cache_key;
+        frame.image = image;
+        frame.size = size;
+        frame.used = frame_cache.clock.fetch_add(1, std::memory_order_relaxed);
+        
+        shard->lru.push_front(frame);
+        shard->index[key] = shard->lru.begin();
+        shard->bytes += size;
+        frame_cache.bytes.fetch_add(size, std::memory_order_relaxed);
+        
+        std::map<std::string, cached_info_t>::iterator info = shard->infos.find(cache_key);
+        if(info != shard->infos.end())
+        {
+            info->second.frames++;
+        }
+    }
+    
+    frame_cache_trim(budget);
+}
+
+void frame_cache_put_info(const std::string& cache_key, const windowing_t& windowing, size_t frames_count){
+    
+    if(!frame_cache.budget.load(std::memory_order_relaxed))
+        return;
+    
+    frame_cache_shard_t *shard = get_frame_cache_shard(cache_key);
+    
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    
+    std::map<std::string, cached_info_t>::iterator info = shard->infos.find(cache_key);
+    if(info == shard->infos.end())
+    {
+        /* inputs whose frames never made it into the cache */
+        if(shard->infos.size() >= (FRAME_CACHE_INFOS / FRAME_CACHE_SHARDS))
+        {
+            for(info = shard->infos.begin(); info != shard->infos.end();)
+            {
+                if(info->second.frames == 0)
+                {
+                    shard->infos.erase(info++);
+                }else
+                {
+                    ++info;
+                }
+            }
+        }
+        
+        cached_info_t cached;
+        cached.windowing = windowing;
+        cached.frames_count = frames_count;
+        cached.frames = 0;
+        shard->infos[cache_key] = cached;
+    }
+}
+
+/* the stage render_frame starts from */
+
+bool get_frame_modality(const image_options_t& image_options, const windowing_t& windowing){
+    
+    if(image_options.output == output_raw)
+        return image_options.rescale;
+    
+    return !windowing.fused;
+}
+
+/* true if every requested frame is cached; the frames are then pinned in result */
+
+bool get_cached_result(dataset_result_t *result, const request_options_t& request){
+    
+    if((request.export_tags) || (request.json_output != json_none) || (result->cache_key.empty()))
+        return false;
+    
+    size_t frames_count;
+    
+    {
+        frame_cache_shard_t *shard = get_frame_cache_shard(result->cache_key);
+        
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        
+        std::map<std::string, cached_info_t>::iterator info = shard->infos.find(result->cache_key);
+        if(info == shard->infos.end())
+        {
+            statistics.result_cache_misses.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        
+        result->windowing = info->second.windowing;
+        frames_count = info->second.frames_count;
+    }
+    
+    bool modality = get_frame_modality(request.image_options, result->windowing);
+    
+    std::vector<size_t> pages;
+    get_frame_list(request.frame_selection, frames_count, pages);
+    
+    std::vector<std::shared_ptr<imebra::Image> > images(pages.size());
+    
+    for(size_t i = 0; i < pages.size(); ++i)
+    {
+        images[i] = frame_cache_get(result->cache_key, get_frame_key(result->cache_key, pages[i], modality));
+        if(!images[i])
+        {
+            statistics.result_cache_misses.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+    
+    statistics.result_cache_hits.fetch_add(1, std::memory_order_relaxed);
+    
+    result->frames.resize(pages.size());
+    
+    for(size_t i = 0; i < pages.size(); ++i)
+    {
+        result->frames[i].frame = pages[i];
+        result->frames[i].decoded = false;
+        result->frames[i].image.size = 0;
+        result->frames[i].raw.size = 0;
+        result->frames[i].source = images[i];
+        result->frames[i].source_modality = modality;
+        
+        if(request.profile)
+        {
+            result->frames[i].profile = std::make_shared<profile_t>();
+        }
+    }
+    
+    return true;
+}
+
+/* the pinned frame, the cache, or a fresh decode that is added to the cache */
+
+std::shared_ptr<imebra::Image> get_frame_image(imebra::DataSet *data, size_t page, bool modality, const windowing_t& windowing, const std::string& cache_key, render_frame_t *frame){
+    
+    if((frame->source) && (frame->source_modality == modality))
+    {
+        return frame->source;
+    }
+    
+    std::string key;
+    
+    if(cache_key.length())
+    {
+        key = get_frame_key(cache_key, page, modality);
+        
+        std::shared_ptr<imebra::Image> image = frame_cache_get(cache_key, key);
+        if(image)
+            return image;
+    }
+    
+    std::shared_ptr<imebra::Image> image;
+    
+    if(data)
+    {
+        try{
+            /* only the fragments of the frame are read and decoded */
+            std::unique_ptr<imebra::DataSet> frame_data(get_frame_dataset(data, page, windowing));
+            
+            imebra::DataSet *source = frame_data ? frame_data.get() : data;
+            size_t source_page = frame_data ? 0 : page;
+            
+            profile_t *profile = frame->profile.get();
+            stage_time_t start = profile_begin(profile);
+            
+            image.reset(source->getImage(source_page));
+            
+            profile_end(profile, stage_decode, start, get_image_size(*image));
+            
+            statistics.frames[windowing.transfer_syntax].fetch_add(1, std::memory_order_relaxed);
+            
+            /* as getImageApplyModalityTransform, timed on its own */
+            if(modality)
+            {
+                start = profile_begin(profile);
+                
+                imebra::ModalityVOILUT modalityTransform(*source);
+                
+                if(!modalityTransform.isEmpty())
+                {
+                    std::uint32_t width = image->getWidth();
+                    std::uint32_t height = image->getHeight();
+                    
+                    std::shared_ptr<imebra::Image> output(modalityTransform.allocateOutputImage(*image, width, height));
+                    modalityTransform.runTransform(*image, 0, 0, width, height, *output, 0, 0);
+                    image = output;
+                }
+                
+                profile_end(profile, stage_modality, start, get_image_size(*image));
+            }
+        }catch(...)
+        {
+            image.reset();
+        }
+        
+        if((image) && (key.length()))
+        {
+            frame_cache_put(cache_key, key, image);
+        }
+    }
+    
+    return image;
+}
+
+#pragma mark -
+
+/* samples are kept in imebra's own buffer until the BLOB is created, no conversion */
+
+void render_raw(imebra::DataSet *data, size_t page, const windowing_t& windowing, const image_options_t& image_options, const std::string& cache_key, render_frame_t *frame){
+    
+    std::shared_ptr<imebra::Image> image = get_frame_image(data, page, image_options.rescale, windowing, cache_key, frame);
+    
+    if(!image)
+        return;
+    
+    frame->raw.handler.reset(image->getReadingDataHandler());
+    frame->raw.image = image;
+    
+    size_t size = 0;
+    frame->raw.samples = frame->raw.handler->data(&size);
+    frame->raw.size = size;
+    frame->raw.depth = image->getDepth();
+    frame->raw.high_bit = image->getHighBit();
+    frame->raw.channels = image->getChannelsNumber();
+    frame->raw.unit_size = frame->raw.handler->getUnitSize();
+    
+    frame->decoded = true;
+    frame->width = image->getWidth();
+    frame->height = image->getHeight();
+    frame->colorSpace = imebra::ColorTransformsFactory::normalizeColorSpace(image->getColorSpace());
+}
+
+/* the encapsulated JPEG stream of the frame is the picture, nothing is decoded */
+
+bool render_passthrough(imebra::DataSet *data, size_t page, const windowing_t& windowing, render_frame_t *frame){
+    
+    std::unique_ptr<imebra::Tag> tag;
+    
+    try{
+        tag.reset(data->getTag(imebra::TagId(imebra::tagId_t::PixelData_7FE0_0010)));
+    }catch(...)
+    {
+        return false;
+    }
+    
+    size_t first, last;
+    
+    if(!get_frame_fragments(data, page, windowing, &first, &last))
+        return false;
+    
+    try{
+        if((last - first) == 1)
+        {
+            /* one fragment: the picture is made straight from imebra's buffer */
+            std::shared_ptr<imebra::ReadingDataHandlerNumeric> handler(tag->getReadingDataHandlerRaw(first));
+            
+            size_t size = 0;
+            const char *bytes = handler->data(&size);
+            
+            if((size < 2) || ((unsigned char)bytes[0] != 0xFF) || ((unsigned char)bytes[1] != 0xD8))
+                return false;
+            
+            frame->image.bytes = std::shared_ptr<void>(handler, (void *)bytes);
+            frame->image.size = size;
+        }else
+        {
+            size_t size = 0;
+            for(size_t i = first; i < last; ++i)
+            {
+                size += tag->getBufferSize(i);
+            }
+            
+            frame->image.bytes = buffer_pool_shared_ptr(size);
+            if(!frame->image.bytes)
+                return false;
+            
+            char *bytes = (char *)frame->image.bytes.get();
+            
+            size_t pos = 0;
+            for(size_t i = first; i < last; ++i)
+            {
+                std::unique_ptr<imebra::ReadingDataHandlerNumeric> handler(tag->getReadingDataHandlerRaw(i));
+                pos += handler->data(bytes + pos, size - pos);
+            }
+            
+            if((pos < 2) || ((unsigned char)bytes[0] != 0xFF) || ((unsigned char)bytes[1] != 0xD8))
+            {
+                frame->image.bytes.reset();
+                return false;
+            }
+            
+            frame->image.size = pos;
+        }
+    }catch(...)
+    {
+        frame->image.bytes.reset();
+        frame->image.size = 0;
+        return false;
+    }
+    
+    frame->image.format = L".jpeg";
+    frame->image.param = NULL;
+    frame->image.value = 0;
+    
+    frame->decoded = true;
+    frame->width = data->getUnsignedLong(imebra::TagId(imebra::tagId_t::Columns_0028_0011), 0, 0);
+    frame->height = data->getUnsignedLong(imebra::TagId(imebra::tagId_t::Rows_0028_0010), 0, 0);
+    frame->colorSpace = windowing.colorSpace;
+    
+    return true;
+}
+
+/* .jpeg at the default quality and full size: the frame is not decoded unless render_passthrough fails */
+
+bool use_passthrough(const windowing_t& windowing, const image_options_t& image_options){
+    
+    return (windowing.jpeg_baseline)
+    && (image_options.output == output_image)
+    && (image_options.format == image_format_jpg) && (image_options.jpeg_quality == 0)
+    && (!image_options.max_width) && (!image_options.max_height);
+}
+
+void render_frame(imebra::DataSet *data, size_t page, const windowing_t& windowing, const image_options_t& image_options, const std::string& cache_key, render_frame_t *frame){
+    
+    frame->decoded = false;
+    
+    if(image_options.output == output_raw)
+    {
+        render_raw(data, page, windowing, image_options, cache_key, frame);
+        return;
+    }
+    
+    if((data) && (use_passthrough(windowing, image_options)))
+    {
+        stage_time_t start = profile_begin(frame->profile.get());
+        
+        if(render_passthrough(data, page, windowing, frame))
+        {
+            /* the copied stream is the encoded image */
+            profile_end(frame->profile.get(), stage_encode, start, frame->image.size);
+            return;
+        }
+    }
+    
+    std::shared_ptr<imebra::Image> image;
+    
+    /* integer monochrome: stored values go through the fused table in one pass */
+    if(windowing.fused)
+    {
+        image = get_frame_image(data, page, false, windowing, cache_key, frame);
+        
+        if(!image)
+            return;
+        
+        if(image && imebra::ColorTransformsFactory::isMonochrome(image->getColorSpace()))
+        {
+            stage_time_t start = profile_begin(frame->profile.get());
+            
+            imebra::Image *thumbnail = downsample_image(*image, image_options.max_width, image_options.max_height);
+            if(thumbnail)
+            {
+                image.reset(thumbnail);
+                profile_end(frame->profile.get(), stage_downsample, start, get_image_size(*image));
+            }
+            
+            frame->decoded = true;
+            frame->width = image->getWidth();
+            frame->height = image->getHeight();
+            frame->colorSpace = imebra::ColorTransformsFactory::normalizeColorSpace(image->getColorSpace());
+            
+            if(render_monochrome(*image, windowing, image_options, frame))
+                return;
+        }
+        
+        image.reset();
+    }
+    
+    image = get_frame_image(data, page, true, windowing, cache_key, frame);
+    
+    if(!image)
+        return;
+    
+    profile_t *profile = frame->profile.get();
+    stage_time_t start = profile_begin(profile);
+    
+    imebra::Image *thumbnail = downsample_image(*image, image_options.max_width, image_options.max_height);
+    if(thumbnail)
+    {
+        image.reset(thumbnail);
+        profile_end(profile, stage_downsample, start, get_image_size(*image));
+    }
+    
+    frame->decoded = true;
+    
+    std::string colorSpace = imebra::ColorTransformsFactory::normalizeColorSpace(image->getColorSpace());
+    std::uint32_t width = image->getWidth();
+    std::uint32_t height = image->getHeight();
+    
+    frame->width = width;
+    frame->height = height;
+    frame->colorSpace = colorSpace;
+    
+    /* retrive image */
+    imebra::TransformsChain chain;
+    
+    size_t requestedBufferSize = 0;
+    bool gotBitmap = false;
+    
+    imebra::DrawBitmap draw(chain);
+    
+    imebra::VOILUT voilutTransform;
+    std::unique_ptr<imebra::Transform> colorSpaceTransform;
+    
+    if(imebra::ColorTransformsFactory::isMonochrome(image->getColorSpace()))
+    {
+        if(!windowing.vois.empty())
+        {
+            voilutTransform.setCenterWidth(windowing.vois[0].center, windowing.vois[0].width);
+        }
+        else if(!windowing.luts.empty())
+        {
+            voilutTransform.setLUT(*(windowing.luts.front().get()));
+        }
+        else
+        {
+            start = profile_begin(profile);
+            voilutTransform.applyOptimalVOI(*image, 0, 0, width, height);
+            profile_end(profile, stage_voi, start, 0);
+        }
+        chain.addTransform(voilutTransform);
+        gotBitmap = true;
+        
+    }else
+    {
+        if(colorSpace != "RGB")
+        {
+            colorSpaceTransform.reset(imebra::ColorTransformsFactory::getTransform(colorSpace, "RGB"));
+            chain.addTransform(*colorSpaceTransform);
+            
+            gotBitmap = true;
+            
+        }
+    }
+    
+    bitmap_buffer_t buffer;
+    
+    if(gotBitmap)
+    {
+        start = profile_begin(profile);
+        
+        /* BGRA is the byte order of a 32-bit BMP, so the buffer can be wrapped as-is for .bmp */
+        requestedBufferSize = draw.getBitmap(*image, imebra::drawBitmapType_t::drawBitmapBGRA, 4, 0, 0);
+        buffer.resize(requestedBufferSize, char(0));
+        
+        try{
+            draw.getBitmap(*image, imebra::drawBitmapType_t::drawBitmapBGRA, 4, (char *)&(buffer.at(0)), requestedBufferSize);
+        }catch(...)
+        {
+            gotBitmap = 0;
+        }
+        
+        profile_end(profile, stage_bitmap, start, buffer.size());
+    }
+    
+    if(gotBitmap)
+    {
+        start = profile_begin(profile);
+        
+        if((image_options.format == image_format_bmp) && (image_options.jpeg_quality == 0))
+        {
+            encode_bmp(buffer, width, height, &frame->image);
+        }else
+        {
+            gdImagePtr gd_in = gd_create_from_bitmap(buffer, width, height);
+            if(gd_in)
+            {
+                encode_image(gd_in, image_options, &frame->image);
+                gdImageDestroy(gd_in);
+            }
+        }
+        
+        profile_end(profile, stage_encode, start, frame->image.size);
+    }
+}
+
+#pragma mark -
+
+/* profile:true, the process-wide statistics unless they are disabled, and the trace */
+
+void profile_reset(profile_t *profile){
+    
+    memset(profile, 0, sizeof(profile_t));
+}
+
+stage_time_t profile_begin(const profile_t *profile){
+    
+    if((!profile) && (!statistics.enabled.load(std::memory_order_relaxed)) && (!trace_enabled.load(std::memory_order_relaxed)))
+        return stage_time_t();
+    
+    return std::chrono::steady_clock::now();
+}
+
+void profile_end(profile_t *profile, stage_t stage, const stage_time_t& start, size_t bytes){
+    
+    if(start == stage_time_t())
+        return;
+    
+    std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+    
+    if(statistics.enabled.load(std::memory_order_relaxed))
+    {
+        statistics_add(&get_statistics_shard()->stages[stage], std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(), bytes);
+    }
+    
+    if(trace_enabled.load(std::memory_order_relaxed))
+    {
+        trace_add(stage, start, elapsed, bytes);
+    }
+    
+    if(!profile)
+        return;
+    
+    profile->calls[stage]++;
+    profile->ms[stage] += std::chrono::duration<double, std::milli>(elapsed).count();
+    profile->bytes[stage] += bytes;
+}
+
+#pragma mark -
+
+void work_pool_init(work_pool_t *pool, unsigned int threads){
+    
+    pool->queues.clear();
+    
+    for(unsigned int i = 0; i < threads; ++i)
+    {
+        pool->queues.push_back(std::unique_ptr<work_queue_t>(new work_queue_t));
+    }
+    
+    pool->pending = 0;
+    pool->queued = 0;
+    pool->helpers = 0;
+}
+
+void work_pool_push(work_pool_t *pool, size_t worker, const work_task_t& task){
+    
+    work_queue_t *queue = pool->queues[worker % pool->queues.size()].get();
+    
+    pool->pending++;
+    
+    {
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->tasks.push_back(task);
+        pool->queued++;
+    }
+    
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    pool->wake.notify_one();
+}
+
+/* own queue from the back (most recent, still in cache), others from the front */
+
+bool work_pool_pop(work_pool_t *pool, size_t worker, work_task_t& task){
+    
+    size_t count = pool->queues.size();
+    
+    for(size_t i = 0; i < count; ++i)
+    {
+        work_queue_t *queue = pool->queues[(worker + i) % count].get();
+        
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        
+        if(!queue->tasks.empty())
+        {
+            if(i == 0)
+            {
+                task = queue->tasks.back();
+                queue->tasks.pop_back();
+            }else
+            {
+                task = queue->tasks.front();
+                queue->tasks.pop_front();
+            }
+            pool->queued--;
+            return true;
+        }
+    }
+    
+    return false;
+}
+
+/* the tasks of one call from its queue at worker, until none is queued or running */
+
+static void work_pool_work(work_pool_t *pool, size_t worker){
+    
+    work_task_t task;
+    
+    for(;;)
+    {
+        if(work_pool_pop(pool, worker, task))
+        {
+            try
+            {
+                task(worker);
+            }
+            catch(...)
+            {
+                
+            }
+            
+            task = nullptr;
+            
+            if(--pool->pending == 0)
+            {
+                std::lock_guard<std::mutex> lock(pool->mutex);
+                pool->wake.notify_all();
+            }
+            continue;
+        }
+        
+        /* nothing to steal: sleep until a task is pushed, or the last one is done */
+        std::unique_lock<std::mutex> lock(pool->mutex);
+        pool->wake.wait(lock, [pool] { return (pool->queued) || (!pool->pending); });
+        
+        if(!pool->pending)
+            break;
+    }
+}
+
+#pragma mark -
+
+/*
+ the threads that help a call are kept between calls, so their thread_local state survives:
+ imebra's MemoryPool, the trace buffers and the buffer pool's thread tier.
+ each thread takes worker slots from its own queue, most recent first, or from the front of another.
+ */
+
+work_threads_t work_threads;
+
+work_threads_t::~work_threads_t(){
+    
+    work_threads_stop();
+}
+
+static bool work_threads_pop(size_t index, std::pair<work_pool_t *, size_t>& slot){
+    
+    size_t count = work_threads.count;
+    
+    for(size_t i = 0; i < count; ++i)
+    {
+        work_thread_queue_t *queue = &work_threads.queues[(index + i) % count];
+        
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        
+        if(!queue->slots.empty())
+        {
+            if(i == 0)
+            {
+                slot = queue->slots.back();
+                queue->slots.pop_back();
+            }else
+            {
+                slot = queue->slots.front();
+                queue->slots.pop_front();
+            }
+            work_threads.queued--;
+            work_threads.busy++;
+            return true;
+        }
+    }
+    
+    return false;
+}
+
+static void work_thread(size_t index){
+    
+    std::pair<work_pool_t *, size_t> slot;
+    
+    for(;;)
+    {
+        if(work_threads_pop(index, slot))
+        {
+            work_pool_t *pool = slot.first;
+            
+            work_pool_work(pool, slot.second);
+            work_threads.busy--;
+            
+            /* the call may return as soon as the lock is released; pool is not used after that */
+            std::lock_guard<std::mutex> lock(pool->mutex);
+            pool->helpers--;
+            pool->wake.notify_all();
+            continue;
+        }
+        
+        std::unique_lock<std::mutex> lock(work_threads.mutex);
+        
+        if(work_threads.stop)
+            break;
+        
+        work_threads.wake.wait(lock, [] { return (work_threads.queued) || (work_threads.stop); });
+        
+        if(work_threads.stop)
+            break;
+    }
+}
+
+/* slots 1...count of pool; a thread is started for each slot no free thread can take. returns the slots queued */
+
+static size_t work_threads_submit(work_pool_t *pool, size_t count){
+    
+    std::lock_guard<std::mutex> lock(work_threads.mutex);
+    
+    size_t waiting = work_threads.queued + count;
+    
+    while((work_threads.count - std::min<size_t>(work_threads.busy, work_threads.count) < waiting) && (work_threads.count < WORK_THREADS_MAX))
+    {
+        try
+        {
+            work_threads.threads.push_back(std::thread(work_thread, (size_t)work_threads.count));
+        }
+        catch(...)
+        {
+            break;
+        }
+        work_threads.count++;
+    }
+    
+    /* no thread at all: the caller does the work alone */
+    if(!work_threads.count)
+        return 0;
+    
+    for(size_t i = 1; i <= count; ++i)
+    {
+        work_thread_queue_t *queue = &work_threads.queues[work_threads.next++ % work_threads.count];
+        
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->slots.push_back(std::make_pair(pool, i));
+        work_threads.queued++;
+    }
+    
+    work_threads.wake.notify_all();
+    
+    return count;
+}
+
+/* slots of pool no thread has taken yet */
+
+static size_t work_threads_cancel(work_pool_t *pool){
+    
+    size_t cancelled = 0;
+    size_t count = work_threads.count;
+    
+    for(size_t i = 0; i < count; ++i)
+    {
+        work_thread_queue_t *queue = &work_threads.queues[i];
+        
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        
+        for(std::deque<std::pair<work_pool_t *, size_t> >::iterator it = queue->slots.begin(); it != queue->slots.end();)
+        {
+            if(it->first == pool)
+            {
+                it = queue->slots.erase(it);
+                work_threads.queued--;
+                cancelled++;
+            }else
+            {
+                ++it;
+            }
+        }
+    }
+    
+    return cancelled;
+}
+
+/* OnExit, or process exit; no call may be running */
+
+void work_threads_stop(){
+    
+    std::vector<std::thread> threads;
+    
+    {
+        std::lock_guard<std::mutex> lock(work_threads.mutex);
+        work_threads.stop = true;
+        work_threads.wake.notify_all();
+        threads.swap(work_threads.threads);
+    }
+    
+    for(std::vector<std::thread>::iterator it = threads.begin(); it != threads.end(); ++it)
+    {
+        it->join();
+    }
+    
+    std::lock_guard<std::mutex> lock(work_threads.mutex);
+    
+    for(size_t i = 0; i < WORK_THREADS_MAX; ++i)
+    {
+        std::lock_guard<std::mutex> lock(work_threads.queues[i].mutex);
+        work_threads.queues[i].slots.clear();
+    }
+    
+    work_threads.count = 0;
+    work_threads.queued = 0;
+    work_threads.busy = 0;
+    work_threads.next = 0;
+    work_threads.stop = false;
+}
+
+/* the calling thread works from queue 0; the other queues are handed to work_threads */
+
+void work_pool_run(work_pool_t *pool){
+    
+    size_t helpers = pool->queues.size() - 1;
+    
+    /* pool is not shared yet; a slot may be done before work_threads_submit returns */
+    pool->helpers = helpers;
+    
+    if((helpers) && (!work_threads_submit(pool, helpers)))
+    {
+        pool->helpers = helpers = 0;
+    }
+    
+    work_pool_work(pool, 0);
+    
+    if(helpers)
+    {
+        size_t cancelled = work_threads_cancel(pool);
+        
+        std::unique_lock<std::mutex> lock(pool->mutex);
+        pool->helpers -= cancelled;
+        pool->wake.wait(lock, [pool] { return !pool->helpers; });
+    }
+}
+
+/*
+ one task per file; each file task pushes one task per frame on its own queue,
+ idle workers steal frames of large files or the next files.
+ */
+
+/* cache lookup, or load and prepare; false, with result->error set, if the item could not be read */
+
+bool load_result(batch_item_t& item, const request_options_t& request, dataset_result_t *result){
+    
+    profile_reset(&result->profile);
+    
+    result->cached = false;
+    result->started = profile_begin(&result->profile);
+    
+    if(request.cache)
+    {
+        if(item.path.length())
+        {
+            get_cache_key(item.path, result->cache_key);
+        }else if(item.memory)
+        {
+            size_t size = 0;
+            const char *bytes = item.memory->data(&size);
+            get_cache_key(bytes, size, result->cache_key);
+        }
+        
+        result->cached = get_cached_result(result, request);
+    }
+    
+    profile_t *profile = request.profile ? &result->profile : NULL;
+    
+    try
+    {
+        if(result->cached)
+        {
+            item.memory.reset();
+        }else if(item.path.length())
+        {
+            stage_time_t start = profile_begin(profile);
+            result->data.reset(load_dataset(item.path, request.max_size_buffer_load));
+            result->path = item.path;
+            profile_end(profile, stage_load, start, 0);
+            prepare_result(result, request);
+        }else if(item.memory)
+        {
+            size_t size = 0;
+            item.memory->data(&size);
+            
+            stage_time_t start = profile_begin(profile);
+            result->data.reset(load_dataset(*item.memory));
+            profile_end(profile, stage_load, start, size);
+            item.memory.reset();
+            prepare_result(result, request);
+        }else
+        {
+            result->error = "invalid item";
+            return false;
+        }
+    }
+    catch(std::exception& e)
+    {
+        result->data.reset();
+        result->error = e.what();
+        return false;
+    }
+    catch(...)
+    {
+        result->data.reset();
+        result->error = "failed to load";
+        return false;
+    }
+    
+    return true;
+}
+
+void run_batch(std::vector<batch_item_t>& items, std::vector<dataset_result_t>& results, const request_options_t& request, batch_progress_t *progress){
+    
+    unsigned int threads = std::max(1U, request.threads);
+    
+    work_pool_t pool;
+    work_pool_init(&pool, threads);
+    
+    for(size_t i = 0; i < items.size(); ++i)
+    {
+        work_pool_push(&pool, i, [&items, &results, &request, &pool, progress, i](size_t worker) {
+            
+            batch_item_t& item = items[i];
+            dataset_result_t& result = results[i];
+            
+            if((progress) && (progress->cancel))
+            {
+                result.error = "cancelled";
+                return;
+            }
+            
+            if(!load_result(item, request, &result))
+                return;
+            
+            if(progress)
+            {
+                progress->frames_total += result.frames.size();
+                progress->items_loaded++;
+            }
+            
+            for(size_t f = 0; f < result.frames.size(); ++f)
+            {
+                work_pool_push(&pool, worker, [&result, &request, progress, f](size_t) {
+                    
+                    /* cancellation is checked between frames */
+                    if((progress) && (progress->cancel))
+                        return;
+                    
+                    render_frame(result.data.get(), result.frames[f].frame, result.windowing, request.image_options, result.cache_key, &result.frames[f]);
+                    
+                    if(progress)
+                    {
+                        progress->bytes += result.frames[f].image.size + result.frames[f].raw.size;
+                        progress->frames_done++;
+                    }
+                });
+            }
+        });
+    }
+    
+    work_pool_run(&pool);
+}
+
+void render_frames(imebra::DataSet *data, std::vector<render_frame_t>& frames, const windowing_t& windowing, const image_options_t& image_options, const std::string& cache_key, unsigned int threads){
+    
+    if(threads > frames.size())
+    {
+        threads = frames.size();
+    }
+    
+    /* imebra locks the dataset internally; gd images are not shared between threads */
+    work_pool_t pool;
+    work_pool_init(&pool, std::max(1U, threads));
+    
+    /* consecutive frames on different queues, pushed last first so that each worker starts from its lowest frame */
+    for(size_t i = frames.size(); i-- > 0;)
+    {
+        work_pool_push(&pool, i, [&, i](size_t) {
+            
+            render_frame(data, frames[i].frame, windowing, image_options, cache_key, &frames[i]);
+        });
+    }
+    
+    work_pool_run(&pool);
+}
+
+/* one dataset: load or cache lookup, then every selected frame on request.threads threads */
+
+bool process_item(batch_item_t& item, const request_options_t& request, dataset_result_t *result){
+    
+    if(!load_result(item, request, result))
+        return false;
+    
+    render_frames(result->data.get(), result->frames, result->windowing, request.image_options, result->cache_key, request.threads);
+    
+    return true;
+}
+
+void get_frame_list(const frame_selection_t& selection, size_t frames_count, std::vector<size_t>& pages){
+    
+    /* frame numbers are checked against NumberOfFrames; imebra seeks to the frame itself */
+    if(selection.list)
+    {
+        for(std::vector<double>::const_iterator it = selection.frames.begin(); it != selection.frames.end(); ++it)
+        {
+            double page = *it;
+            if((page >= 0) && (page < frames_count))
+            {
+                pages.push_back((size_t)page);
+            }
+        }
+    }else
+    {
+        for(size_t page = selection.start;
+            (page < frames_count) && ((selection.count < 0) || (pages.size() < (size_t)selection.count));
+            page += selection.stride)
+        {
+            pages.push_back(page);
+        }
+    }
+}
+
+#pragma mark -
+
+/* Imebra Start job: the batch runs on its own thread until it is collected */
+
+static std::map<std::int32_t, std::shared_ptr<job_t> > jobs;
+static std::mutex jobs_mutex;
+static std::int32_t jobs_next_id = 1;
+
+std::int32_t start_job(std::shared_ptr<job_t> job){
+    
+    job->results.resize(job->items.size());
+    
+    job->progress.cancel = false;
+    job->progress.items_loaded = 0;
+    job->progress.frames_total = 0;
+    job->progress.frames_done = 0;
+    job->progress.bytes = 0;
+    job->done = false;
+    
+    /* started before the job can be found, so no caller sees the thread half set;
+     the job keeps itself alive until it has been collected */
+    job->thread = std::thread([job]() {
+        
+        run_batch(job->items, job->results, job->request, &job->progress);
+        
+        job->done = true;
+    });
+    
+    std::lock_guard<std::mutex> lock(jobs_mutex);
+    
+    std::int32_t id = jobs_next_id++;
+    jobs[id] = job;
+    
+    return id;
+}
+
+std::shared_ptr<job_t> get_job(std::int32_t id){
+    
+    std::lock_guard<std::mutex> lock(jobs_mutex);
+    
+    std::map<std::int32_t, std::shared_ptr<job_t> >::iterator it = jobs.find(id);
+    if(it != jobs.end())
+    {
+        return it->second;
+    }
+    
+    return std::shared_ptr<job_t>();
+}
+
+/* waits for the job to finish and forgets it; only one caller gets it */
+
+std::shared_ptr<job_t> collect_job(std::int32_t id){
+    
+    std::shared_ptr<job_t> job;
+    
+    {
+        std::lock_guard<std::mutex> lock(jobs_mutex);
+        
+        std::map<std::int32_t, std::shared_ptr<job_t> >::iterator it = jobs.find(id);
+        if(it != jobs.end())
+        {
+            job = it->second;
+            jobs.erase(it);
+        }
+    }
+    
+    if((job) && (job->thread.joinable()))
+    {
+        job->thread.join();
+    }
+    
+    return job;
+}
+
+void cancel_jobs(){
+    
+    std::map<std::int32_t, std::shared_ptr<job_t> > pending;
+    
+    {
+        std::lock_guard<std::mutex> lock(jobs_mutex);
+        pending.swap(jobs);
+    }
+    
+    for(std::map<std::int32_t, std::shared_ptr<job_t> >::iterator it = pending.begin(); it != pending.end(); ++it)
+    {
+        it->second->progress.cancel = true;
+        
+        if(it->second->thread.joinable())
+        {
+            it->second->thread.join();
+        }
+    }
+}
+
+#pragma mark -
+
+/*
+ a session keeps the dataset until it is closed or left idle for longer than its timeout;
+ its decoded frames are in the frame cache, under the key of the input.
+ opening the same input again returns the same handle with one more reference.
+ */
+
+static std::map<std::int32_t, std::shared_ptr<session_t> > sessions;
+static std::mutex sessions_mutex;
+static std::int32_t sessions_next_id = 1;
+
+/* releases idle sessions without waiting for the next call; started with the first session that has a timeout */
+
+struct sessions_sweeper_t
+{
+    std::thread thread;
+    std::condition_variable wake;/* with sessions_mutex */
+    bool stop;
+    ~sessions_sweeper_t();
+};
+
+static sessions_sweeper_t sessions_sweeper;
+
+/*
+ call with sessions_mutex locked; the expired sessions are moved to expired, to be released
+ once it is unlocked. returns false if no session has a timeout, or else the time of the next one in next.
+ */
+
+static bool sweep_sessions(std::vector<std::shared_ptr<session_t> >& expired, std::chrono::steady_clock::time_point *next){
+    
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    bool timed = false;
+    
+    for(std::map<std::int32_t, std::shared_ptr<session_t> >::iterator it = sessions.begin(); it != sessions.end();)
+    {
+        session_t *session = it->second.get();
+        
+        if((!session->ready) || (session->timeout <= 0))
+        {
+            ++it;
+            continue;
+        }
+        
+        std::chrono::steady_clock::time_point deadline = session->last_used + std::chrono::seconds(session->timeout);
+        
+        if(now > deadline)
+        {
+            expired.push_back(it->second);
+            sessions.erase(it++);
+            continue;
+        }
+        
+        if((!timed) || (deadline < *next))
+        {
+            *next = deadline;
+        }
+        timed = true;
+        ++it;
+    }
+    
+    return timed;
+}
+
+static void sweep_sessions(std::vector<std::shared_ptr<session_t> >& expired){
+    
+    std::chrono::steady_clock::time_point next;
+    sweep_sessions(expired, &next);
+}
+
+static void sessions_sweep(){
+    
+    std::vector<std::shared_ptr<session_t> > expired;
+    std::unique_lock<std::mutex> lock(sessions_mutex);
+    
+    while(!sessions_sweeper.stop)
+    {
+        std::chrono::steady_clock::time_point next;
+        bool timed = sweep_sessions(expired, &next);
+        
+        if(!expired.empty())
+        {
+            /* datasets are released without the lock */
+            lock.unlock();
+            expired.clear();
+            lock.lock();
+            continue;
+        }
+        
+        /* a session opened meanwhile wakes the sweeper up to take its timeout into account */
+        if(timed)
+        {
+            sessions_sweeper.wake.wait_until(lock, next + std::chrono::milliseconds(1));
+        }else
+        {
+            sessions_sweeper.wake.wait(lock);
+        }
+    }
+}
+
+/* call with sessions_mutex locked */
+
+static void sessions_sweeper_start(){
+    
+    if(sessions_sweeper.thread.joinable())
+    {
+        sessions_sweeper.wake.notify_all();
+        return;
+    }
+    
+    try
+    {
+        sessions_sweeper.thread = std::thread(sessions_sweep);
+    }
+    catch(...)
+    {
+        /* still swept by the next call */
+    }
+}
+
+static void sessions_sweeper_stop(){
+    
+    std::thread thread;
+    
+    {
+        std::lock_guard<std::mutex> lock(sessions_mutex);
+        sessions_sweeper.stop = true;
+        sessions_sweeper.wake.notify_all();
+        thread.swap(sessions_sweeper.thread);
+    }
+    
+    if(thread.joinable())
+    {
+        thread.join();
+    }
+    
+    std::lock_guard<std::mutex> lock(sessions_mutex);
+    sessions_sweeper.stop = false;
+}
+
+sessions_sweeper_t::~sessions_sweeper_t(){
+    
+    sessions_sweeper_stop();
+}
+
+/* load fills in the session; 0 if it returns false */
+
+std::int32_t open_session(const std::string& key, int timeout, const std::function<bool(session_t *)>& load){
+    
+    std::int32_t id = 0;
+    std::shared_ptr<session_t> session;
+    std::vector<std::shared_ptr<session_t> > expired;
+    
+    {
+        /* lookup and insert in one step: the same input opened twice at once is loaded once */
+        std::lock_guard<std::mutex> lock(sessions_mutex);
+        
+        sweep_sessions(expired);
+        
+        if(key.length())
+        {
+            for(std::map<std::int32_t, std::shared_ptr<session_t> >::iterator it = sessions.begin(); it != sessions.end(); ++it)
+            {
+                if(it->second->key == key)
+                {
+                    it->second->refs++;
+                    it->second->timeout = timeout;
+                    it->second->last_used = std::chrono::steady_clock::now();
+                    id = it->first;
+                    session = it->second;
+                    break;
+                }
+            }
+        }
+        
+        if(!id)
+        {
+            session.reset(new session_t);
+            session->key = key;
+            session->refs = 1;
+            session->timeout = timeout;
+            session->last_used = std::chrono::steady_clock::now();
+            session->ready = false;
+            
+            id = sessions_next_id++;
+            sessions[id] = session;
+        }
+    }
+    
+    /* the first caller loads; the others wait for it */
+    std::call_once(session->once, [&]() {
+        
+        if(load(session.get()))
+        {
+            session->ready = true;
+        }
+    });
+    
+    if(!session->ready)
+    {
+        std::lock_guard<std::mutex> lock(sessions_mutex);
+        
+        std::map<std::int32_t, std::shared_ptr<session_t> >::iterator it = sessions.find(id);
+        if((it != sessions.end()) && (it->second == session))
+        {
+            sessions.erase(it);
+        }
+        
+        id = 0;
+    }else if(timeout > 0)
+    {
+        /* the sweeper only counts sessions that are loaded */
+        std::lock_guard<std::mutex> lock(sessions_mutex);
+        sessions_sweeper_start();
+    }
+    
+    return id;
+}
+
+std::shared_ptr<session_t> get_session(std::int32_t id){
+    
+    std::vector<std::shared_ptr<session_t> > expired;
+    std::lock_guard<std::mutex> lock(sessions_mutex);
+    
+    sweep_sessions(expired);
+    
+    std::map<std::int32_t, std::shared_ptr<session_t> >::iterator it = sessions.find(id);
+    if((it != sessions.end()) && (it->second->ready))
+    {
+        it->second->last_used = std::chrono::steady_clock::now();
+        return it->second;
+    }
+    
+    return std::shared_ptr<session_t>();
+}
+
+void close_session(std::int32_t id){
+    
+    std::vector<std::shared_ptr<session_t> > expired;
+    std::lock_guard<std::mutex> lock(sessions_mutex);
+    
+    std::map<std::int32_t, std::shared_ptr<session_t> >::iterator it = sessions.find(id);
+    if(it != sessions.end())
+    {
+        /* a render still running keeps its own reference */
+        if(--it->second->refs == 0)
+        {
+            expired.push_back(it->second);
+            sessions.erase(it);
+        }
+    }
+    
+    sweep_sessions(expired);
+}
+
+/* OnExit: every session, and the sweeper */
+
+void close_sessions(){
+    
+    sessions_sweeper_stop();
+    
+    std::map<std::int32_t, std::shared_ptr<session_t> > closed;
+    
+    std::lock_guard<std::mutex> lock(sessions_mutex);
+    
+    sessions.swap(closed);
+}
+
+#pragma mark -
+
+static std::uint16_t read_u16(const unsigned char *p, bool big_endian){
+    
+    return big_endian ? (std::uint16_t)((p[0] << 8) | p[1]) : (std::uint16_t)((p[1] << 8) | p[0]);
+}
+
+static std::uint32_t read_u32(const unsigned char *p, bool big_endian){
+    
+    return big_endian
+    ? ((std::uint32_t)p[0] << 24) | ((std::uint32_t)p[1] << 16) | ((std::uint32_t)p[2] << 8) | p[3]
+    : ((std::uint32_t)p[3] << 24) | ((std::uint32_t)p[2] << 16) | ((std::uint32_t)p[1] << 8) | p[0];
+}
+
+static bool is_long_vr(const unsigned char *vr){
+    
+    /* VRs with 2 reserved bytes and a 32-bit length in explicit syntaxes */
+    static const char *long_vrs[] = {"OB", "OD", "OF", "OL", "OV", "OW", "SQ", "SV", "UC", "UN", "UR", "UT", "UV", NULL};
+    
+    for(const char **vr_it = long_vrs; *vr_it; ++vr_it)
+    {
+        if((vr[0] == (*vr_it)[0]) && (vr[1] == (*vr_it)[1]))
+            return true;
+    }
+    
+    return false;
+}
+
+/* the walker reads a buffer, or seeks in a file so that the values it skips are never read */
+
+static bool read_source(const element_source_t& source, std::uint64_t pos, unsigned char *bytes, size_t size){
+    
+    if((pos > source.size) || (size > (source.size - pos)))
+        return false;
+    
+    if(source.p)
+    {
+        memcpy(bytes, source.p + pos, size);
+        return true;
+    }
+    
+#if defined(_WIN32)
+    if(_fseeki64(source.f, (__int64)pos, SEEK_SET) != 0)
+        return false;
+#else
+    if(fseeko(source.f, (off_t)pos, SEEK_SET) != 0)
+        return false;
+#endif
+    
+    return fread(bytes, 1, size, source.f) == size;
+}
+
+/* *pos moves past the header, to the value */
+
+static bool read_element_header(const element_source_t& source, std::uint64_t *pos, bool explicit_vr, bool big_endian, std::uint32_t *tag, std::uint32_t *length){
+    
+    unsigned char header[12];
+    
+    if(!read_source(source, *pos, header, 8))
+        return false;
+    
+    *tag = ((std::uint32_t)read_u16(header, big_endian) << 16) | read_u16(header + 2, big_endian);
+    
+    if(((*tag >> 16) == 0xFFFE) || (!explicit_vr))
+    {
+        *length = read_u32(header + 4, big_endian);
+        *pos += 8;
+    }else if(is_long_vr(header + 4))
+    {
+        if(!read_source(source, *pos + 8, header + 8, 4))
+            return false;
+        *length = read_u32(header + 8, big_endian);
+        *pos += 12;
+    }else
+    {
+        *length = read_u16(header + 6, big_endian);
+        *pos += 8;
+    }
+    
+    return true;
+}
+
+static bool skip_element(const element_source_t& source, std::uint64_t *pos, bool explicit_vr, bool big_endian, std::uint32_t *tag);
+
+static bool skip_undefined_length(const element_source_t& source, std::uint64_t *pos, bool explicit_vr, bool big_endian){
+    
+    /* sequence items or encapsulated fragments, up to the sequence delimitation item */
+    for(;;)
+    {
+        std::uint32_t tag = 0;
+        std::uint32_t length = 0;
+        
+        if(!read_element_header(source, pos, explicit_vr, big_endian, &tag, &length))
+            return false;
+        
+        if(tag == 0xFFFEE0DD)
+            return true;
+        
+        if(tag != 0xFFFEE000)
+            return false;
+        
+        if(length != 0xFFFFFFFF)
+        {
+            if(length > (source.size - *pos))
+                return false;
+            *pos += length;
+            continue;
+        }
+        
+        /* item of undefined length: nested elements up to the item delimitation */
+        for(;;)
+        {
+            std::uint32_t nested = 0;
+            if(!skip_element(source, pos, explicit_vr, big_endian, &nested))
+                return false;
+            if(nested == 0xFFFEE00D)
+                break;
+        }
+    }
+}
+
+static bool skip_element(const element_source_t& source, std::uint64_t *pos, bool explicit_vr, bool big_endian, std::uint32_t *tag){
+    
+    std::uint32_t length = 0;
+    
+    if(!read_element_header(source, pos, explicit_vr, big_endian, tag, &length))
+        return false;
+    
+    if(length == 0xFFFFFFFF)
+    {
+        if((*tag >> 16) == 0xFFFE)
+            return true;
+        return skip_undefined_length(source, pos, explicit_vr, big_endian);
+    }
+    
+    if(length > (source.size - *pos))
+        return false;
+    
+    *pos += length;
+    
+    return true;
+}
+
+/* the first top level element at or past tag; false if the elements before it can't be walked */
+
+static bool find_element(const element_source_t& source, std::uint32_t tag, std::uint64_t *start, std::uint32_t *found, bool *explicit_vr, bool *big_endian, std::string *transfer_syntax){
+    
+    std::uint64_t pos = 0;
+    unsigned char header[8];
+    
+    if((read_source(source, 128, header, 4)) && (!memcmp(header, "DICM", 4)))
+    {
+        pos = 132;
+    }
+    
+    std::string transferSyntax;
+    
+    /* the meta information group is always explicit little endian */
+    while((read_source(source, pos, header, 8)) && (read_u16(header, false) == 0x0002))
+    {
+        std::uint64_t value = pos + 8;
+        std::uint32_t meta = 0;
+        
+        if(!skip_element(source, &pos, true, false, &meta))
+            return false;
+        
+        if(meta == 0x00020010)
+        {
+            char uid[64];
+            size_t length = (size_t)std::min<std::uint64_t>(pos - value, sizeof(uid));
+            
+            if(!read_source(source, value, (unsigned char *)uid, length))
+                return false;
+            
+            transferSyntax.assign(uid, length);
+            while((!transferSyntax.empty()) && ((transferSyntax[transferSyntax.size() - 1] == 0) || (transferSyntax[transferSyntax.size() - 1] == ' ')))
+            {
+                transferSyntax.erase(transferSyntax.size() - 1);
+            }
+        }
+    }
+    
+    if(transfer_syntax)
+    {
+        *transfer_syntax = transferSyntax;
+    }
+    
+    if(!read_source(source, pos, header, 8))
+        return false;
+    
+    if(transferSyntax == "1.2.840.10008.1.2.1.99")
+        return false;/* deflated */
+    
+    *big_endian = false;
+    
+    if(transferSyntax.empty())
+    {
+        /* no meta information: guess the syntax from the first element */
+        *explicit_vr = isupper(header[4]) && isupper(header[5]);
+    }else
+    {
+        *explicit_vr = (transferSyntax != "1.2.840.10008.1.2");
+        *big_endian = (transferSyntax == "1.2.840.10008.1.2.2");
+    }
+    
+    while(read_source(source, pos, header, 8))
+    {
+        *found = ((std::uint32_t)read_u16(header, *big_endian) << 16) | read_u16(header + 2, *big_endian);
+        
+        if(*found >= tag)
+        {
+            *start = pos;
+            return true;
+        }
+        
+        if(!skip_element(source, &pos, *explicit_vr, *big_endian, found))
+            return false;
+    }
+    
+    return false;
+}
+
+size_t find_pixel_data_offset(const unsigned char *p, size_t size){
+    
+    /* walk the top level elements; anything that can't be walked is parsed whole by imebra */
+    element_source_t source = {p, NULL, size};
+    
+    std::uint64_t start = 0;
+    std::uint32_t found = 0;
+    bool explicit_vr;
+    bool big_endian;
+    
+    if((find_element(source, 0x7FE00010, &start, &found, &explicit_vr, &big_endian, NULL)) && (found == 0x7FE00010))
+        return (size_t)start;
+    
+    return size;
+}
+
+/* ":<SOP Instance UID>:<transfer syntax>", to tell apart inputs with the same hash or date */
+
+void get_instance_key(const element_source_t& source, std::string& key){
+    
+    std::uint64_t pos = 0;
+    std::uint32_t found = 0;
+    std::uint32_t length = 0;
+    bool explicit_vr;
+    bool big_endian;
+    std::string transferSyntax;
+    std::string uid;
+    
+    if((find_element(source, 0x00080018, &pos, &found, &explicit_vr, &big_endian, &transferSyntax))
+       && (found == 0x00080018)
+       && (read_element_header(source, &pos, explicit_vr, big_endian, &found, &length))
+       && (length <= 64))
+    {
+        char value[64];
+        
+        if(read_source(source, pos, (unsigned char *)value, length))
+        {
+            uid.assign(value, length);
+            while((!uid.empty()) && ((uid[uid.size() - 1] == 0) || (uid[uid.size() - 1] == ' ')))
+            {
+                uid.erase(uid.size() - 1);
+            }
+        }
+    }
+    
+    key = ":" + uid + ":" + transferSyntax;
+}
+
+/*
+ up to limit bytes of a top level value, read from the file: imebra loads a value
+ left in the file whole before any of it can be read. buffer 0 is the value, or the
+ offset table of encapsulated pixel data; the fragments follow from 1.
+ */
+
+bool read_element_prefix(const path_t& path, std::uint32_t tag, size_t buffer, size_t limit, std::string& bytes){
+    
+#if defined(_WIN32)
+    struct _stat64 st;
+    if(_wstat64(path.c_str(), &st) != 0)
+        return false;
+    FILE *f = _wfopen(path.c_str(), L"rb");
+#else
+    struct stat st;
+    if(stat(path.c_str(), &st) != 0)
+        return false;
+    FILE *f = fopen(path.c_str(), "rb");
+#endif
+    
+    if(!f)
+        return false;
+    
+    element_source_t source = {NULL, f, (std::uint64_t)st.st_size};
+    
+    std::uint64_t pos = 0;
+    std::uint32_t found = 0;
+    std::uint32_t length = 0;
+    bool explicit_vr;
+    bool big_endian;
+    bool value = false;
+    
+    /* imebra swaps big endian values; those are left to the data handler */
+    if((find_element(source, tag, &pos, &found, &explicit_vr, &big_endian, NULL))
+       && (found == tag)
+       && (!big_endian)
+       && (read_element_header(source, &pos, explicit_vr, false, &found, &length)))
+    {
+        if(length != 0xFFFFFFFF)
+        {
+            value = (buffer == 0);
+        }else if(tag == 0x7FE00010)
+        {
+            for(size_t item = 0; read_element_header(source, &pos, explicit_vr, false, &found, &length); ++item)
+            {
+                if((found != 0xFFFEE000) || (length == 0xFFFFFFFF))
+                    break;
+                
+                if(item == buffer)
+                {
+                    value = true;
+                    break;
+                }
+                
+                pos += length;
+            }
+        }
+    }
+    
+    if(value)
+    {
+        bytes.resize((size_t)std::min<std::uint64_t>(length, limit));
+        value = (bytes.empty()) || (read_source(source, pos, (unsigned char *)&bytes[0], bytes.size()));
+    }
+    
+    fclose(f);
+    
+    return value;
+}
+
+#pragma mark -
+
+/*
+ frame -> fragments (buffers of the pixel data, buffer 0 is the basic offset table);
+ from the extended offset table (7FE0,0001), the basic offset table, one fragment
+ per frame, or a scan for the first bytes of each codestream.
+ */
+
+static bool is_codestream_start(const unsigned char *p, size_t size){
+    
+    static const unsigned char jp2[] = {0x00, 0x00, 0x00, 0x0C, 0x6A, 0x50, 0x20, 0x20};
+    
+    if(size < 2)
+        return false;
+    
+    if((p[0] == 0xFF) && ((p[1] == 0xD8) || (p[1] == 0x4F)))/* SOI, SOC */
+        return true;
+    
+    return (size >= sizeof(jp2)) && (!memcmp(p, jp2, sizeof(jp2)));
+}
+
+static bool map_frame_offsets(const std::vector<std::uint64_t>& offsets, const std::vector<std::uint64_t>& positions, size_t buffers, fragment_index_t *index){
+    
+    for(size_t f = 0; f < offsets.size(); ++f)
+    {
+        std::vector<std::uint64_t>::const_iterator it = std::lower_bound(positions.begin(), positions.end(), offsets[f]);
+        
+        if((it == positions.end()) || (*it != offsets[f]))
+            return false;
+        
+        size_t first = 1 + (it - positions.begin());
+        
+        if((f) && (first <= index->frames[f - 1].first))
+            return false;
+        
+        if(f)
+        {
+            index->frames[f - 1].second = first;
+        }
+        
+        index->frames.push_back(std::make_pair(first, buffers));
+    }
+    
+    return true;
+}
+
+static void build_fragment_index(imebra::DataSet *data, fragment_index_t *index){
+    
+    index->frames.clear();
+    
+    std::unique_ptr<imebra::Tag> tag(data->getTag(imebra::TagId(imebra::tagId_t::PixelData_7FE0_0010)));
+    
+    size_t frames_count = data->getUnsignedLong(imebra::TagId(imebra::tagId_t::NumberOfFrames_0028_0008), 0, 1);
+    size_t buffers = tag->getBuffersCount();
+    
+    if((!frames_count) || (buffers < 2))
+        return;
+    
+    /* offsets count from the first byte of the first fragment item; each item has an 8 byte header */
+    std::vector<std::uint64_t> positions(buffers - 1);
+    
+    std::uint64_t position = 0;
+    for(size_t i = 1; i < buffers; ++i)
+    {
+        positions[i - 1] = position;
+        position += 8 + tag->getBufferSize(i);
+    }
+    
+    std::vector<std::uint64_t> offsets;
+    
+    imebra::TagId extendedOffsetTable(0x7FE0, 0x0001);
+    
+    if(data->bufferExists(extendedOffsetTable, 0))
+    {
+        std::unique_ptr<imebra::ReadingDataHandlerNumeric> handler(data->getReadingDataHandlerRaw(extendedOffsetTable, 0));
+        size_t size = 0;
+        const unsigned char *p = (const unsigned char *)handler->data(&size);
+        
+        if((size / 8) == frames_count)
+        {
+            for(size_t f = 0; f < frames_count; ++f)
+            {
+                offsets.push_back(((std::uint64_t)read_u32(p + (f * 8) + 4, false) << 32) | read_u32(p + (f * 8), false));
+            }
+            
+            if(map_frame_offsets(offsets, positions, buffers, index))
+            {
+                index->ready = true;
+                return;
+            }
+        }
+    }
+    
+    index->frames.clear();
+    offsets.clear();
+    
+    if(tag->getBufferSize(0) >= (frames_count * 4))
+    {
+        std::unique_ptr<imebra::ReadingDataHandlerNumeric> handler(tag->getReadingDataHandlerRaw(0));
+        size_t size = 0;
+        const unsigned char *p = (const unsigned char *)handler->data(&size);
+        
+        for(size_t f = 0; f < frames_count; ++f)
+        {
+            offsets.push_back(read_u32(p + (f * 4), false));
+        }
+        
+        if(map_frame_offsets(offsets, positions, buffers, index))
+        {
+            index->ready = true;
+            return;
+        }
+    }
+    
+    index->frames.clear();
+    
+    if(frames_count == 1)
+    {
+        index->frames.push_back(std::make_pair((size_t)1, buffers));
+    }else if(buffers == (frames_count + 1))
+    {
+        for(size_t f = 0; f < frames_count; ++f)
+        {
+            index->frames.push_back(std::make_pair(f + 1, f + 2));
+        }
+    }else
+    {
+        /* no table: every fragment is read once to find where the frames start */
+        for(size_t i = 1; i < buffers; ++i)
+        {
+            std::unique_ptr<imebra::ReadingDataHandlerNumeric> handler(tag->getReadingDataHandlerRaw(i));
+            size_t size = 0;
+            const unsigned char *p = (const unsigned char *)handler->data(&size);
+            
+            if((i == 1) || (is_codestream_start(p, size)))
+            {
+                if(!index->frames.empty())
+                {
+                    index->frames.back().second = i;
+                }
+                index->frames.push_back(std::make_pair(i, buffers));
+            }
+        }
+        
+        if(index->frames.size() != frames_count)
+        {
+            index->frames.clear();
+            return;
+        }
+    }
+    
+    index->ready = true;
+}
+
+bool get_frame_fragments(imebra::DataSet *data, size_t page, const windowing_t& windowing, size_t *first, size_t *last){
+    
+    fragment_index_t *index = windowing.fragments.get();
+    
+    if(!index)
+        return false;
+    
+    std::call_once(index->once, [data, index]() {
+        
+        try
+        {
+            build_fragment_index(data, index);
+        }
+        catch(...)
+        {
+            index->frames.clear();
+            index->ready = false;
+        }
+    });
+    
+    if((!index->ready) || (page >= index->frames.size()))
+        return false;
+    
+    *first = index->frames[page].first;
+    *last = index->frames[page].second;
+    
+    return (*first) < (*last);
+}
+
+/*
+ a single-frame dataset holding only the fragments of one frame of a multi-frame object,
+ with the attributes the codecs and the modality transform need; NULL when not applicable.
+ */
+
+imebra::DataSet *get_frame_dataset(imebra::DataSet *data, size_t page, const windowing_t& windowing){
+    
+    if(data->getUnsignedLong(imebra::TagId(imebra::tagId_t::NumberOfFrames_0028_0008), 0, 1) < 2)
+        return NULL;
+    
+    size_t first, last;
+    
+    if(!get_frame_fragments(data, page, windowing, &first, &last))
+        return NULL;
+    
+    static const imebra::tagId_t attributes[] = {
+        imebra::tagId_t::SamplesPerPixel_0028_0002,
+        imebra::tagId_t::PhotometricInterpretation_0028_0004,
+        imebra::tagId_t::PlanarConfiguration_0028_0006,
+        imebra::tagId_t::Rows_0028_0010,
+        imebra::tagId_t::Columns_0028_0011,
+        imebra::tagId_t::BitsAllocated_0028_0100,
+        imebra::tagId_t::BitsStored_0028_0101,
+        imebra::tagId_t::HighBit_0028_0102,
+        imebra::tagId_t::PixelRepresentation_0028_0103,
+        imebra::tagId_t::RescaleIntercept_0028_1052,
+        imebra::tagId_t::RescaleSlope_0028_1053,
+        imebra::tagId_t::RescaleType_0028_1054};
+    
+    std::string transferSyntax = data->getString(imebra::TagId(imebra::tagId_t::TransferSyntaxUID_0002_0010), 0, "");
+    
+    std::unique_ptr<imebra::DataSet> frame_data(new imebra::DataSet(transferSyntax));
+    
+    for(size_t i = 0; i < sizeof(attributes) / sizeof(attributes[0]); ++i)
+    {
+        imebra::TagId t(attributes[i]);
+        
+        if(data->bufferExists(t, 0))
+        {
+            std::unique_ptr<imebra::Tag> tag(data->getTag(t));
+            std::unique_ptr<imebra::ReadingDataHandlerNumeric> reading(tag->getReadingDataHandlerRaw(0));
+            size_t size = 0;
+            const char *bytes = reading->data(&size);
+            
+            std::unique_ptr<imebra::WritingDataHandlerNumeric> writing(frame_data->getWritingDataHandlerRaw(t, 0, tag->getDataType()));
+            writing->assign(bytes, size);
+        }
+    }
+    
+    try
+    {
+        imebra::TagId modalityLUT(imebra::tagId_t::ModalityLUTSequence_0028_3000);
+        std::unique_ptr<imebra::DataSet> item(data->getSequenceItem(modalityLUT, 0));
+        frame_data->setSequenceItem(modalityLUT, 0, *item);
+    }
+    catch(...)
+    {
+        
+    }
+    
+    imebra::TagId pixelData(imebra::tagId_t::PixelData_7FE0_0010);
+    std::unique_ptr<imebra::Tag> tag(data->getTag(pixelData));
+    
+    size_t size = 0;
+    for(size_t i = first; i < last; ++i)
+    {
+        size += tag->getBufferSize(i);
+    }
+    
+    /* empty offset table, then the frame as one fragment */
+    {
+        std::unique_ptr<imebra::WritingDataHandlerNumeric> table(frame_data->getWritingDataHandlerRaw(pixelData, 0, imebra::tagVR_t::OB));
+        table->setSize(0);
+    }
+    
+    std::unique_ptr<imebra::WritingDataHandlerNumeric> fragment(frame_data->getWritingDataHandlerRaw(pixelData, 1, imebra::tagVR_t::OB));
+    fragment->setSize(size);
+    
+    size_t capacity = 0;
+    char *bytes = fragment->data(&capacity);
+    
+    size_t pos = 0;
+    for(size_t i = first; (i < last) && (pos < capacity); ++i)
+    {
+        std::unique_ptr<imebra::ReadingDataHandlerNumeric> reading(tag->getReadingDataHandlerRaw(i));
+        pos += reading->data(bytes + pos, capacity - pos);
+    }
+    
+    fragment.reset();
+    
+    return frame_data.release();
+}
+
+gdImagePtr gd_create_from_bitmap(const bitmap_buffer_t& bitmap, std::uint32_t width, std::uint32_t height){
+    
+    /* 32-bit BGRA rows from DrawBitmap, 4-byte aligned, top-down like the frame */
+    
+    if((!width) || (!height) || (bitmap.size() < (size_t)width * height * 4))
+        return NULL;
+    
+    gdImagePtr gd = gdImageCreateTrueColor(width, height);
+    
+    if(gd)
+    {
+        const unsigned char *p = (const unsigned char *)&bitmap.at(0);
+        
+        for(std::uint32_t y = 0; y < height; ++y)
+        {
+            int *row = gd->tpixels[y];
+            
+            for(std::uint32_t x = 0; x < width; ++x)
+            {
+                row[x] = gdTrueColor(p[2], p[1], p[0]);
+                p += 4;
+            }
+        }
+    }
+    
+    return gd;
+}
+
+void encode_bmp(const bitmap_buffer_t& bitmap, std::uint32_t width, std::uint32_t height, encoded_image_t *encoded){
+    
+    bitmap_file_header bfh;
+    bitmap_image_header bih;
+    
+    int file_size = sizeof_bitmap_file_header + sizeof_bitmap_image_header + bitmap.size();
+    int offset_bits = sizeof_bitmap_file_header + sizeof_bitmap_image_header;
+    
+    memcpy(&bfh.bitmap_type, "BM", 2);
+    
+    bfh.file_size       = file_size;
+    bfh.reserved1       = 0;
+    bfh.reserved2       = 0;
+    bfh.offset_bits     = offset_bits;
+    
+    bih.size_header     = sizeof_bitmap_image_header;
+    bih.width           = width;
+    bih.height          = height;
+    bih.planes          = 1;
+    bih.bit_count       = 32;
+    bih.compression     = 0;
+    bih.image_size      = 0;
+    bih.ppm_x           = 0;
+    bih.ppm_y           = 0;
+    bih.clr_used        = 0;
+    bih.clr_important   = 0;
+    
+    std::shared_ptr<void> block = buffer_pool_shared_ptr(file_size);
+    
+    if(block)
+    {
+        char *bytes = (char *)block.get();
+        
+        memcpy(bytes, &bfh, sizeof_bitmap_file_header);
+        memcpy(bytes + sizeof_bitmap_file_header, &bih, sizeof_bitmap_image_header);
+        /* a BMP with a positive height is stored bottom-up */
+        size_t row_size = (size_t)width * 4;
+        for(std::uint32_t y = 0; y < height; ++y)
+        {
+            memcpy(bytes + offset_bits + (size_t)(height - 1 - y) * row_size, &(bitmap.at((size_t)y * row_size)), row_size);
+        }
+        
+        encoded->bytes = block;
+        encoded->size = file_size;
+        encoded->format = L".bmp";
+        encoded->param = L"compression";
+        encoded->value = 0;
+    }
+}
+
+void encode_image(gdImagePtr gd, const image_options_t& image_options, encoded_image_t *encoded){
+    
+    if(gd)
+    {
+        int len = 0;
+        void *bytes = NULL;
+        switch (image_options.format) {
+            case image_format_png:
+                bytes = gdImagePngPtrEx(gd, &len, image_options.png_level);
+                encoded->format = L".png";
+                encoded->param = L"level";
+                encoded->value = image_options.png_level;
+                break;
+            case image_format_jpg:
+                bytes = gdImageJpegPtr(gd, &len, image_options.jpeg_quality);
+                encoded->format = L".jpeg";
+                encoded->param = L"quality";
+                encoded->value = image_options.jpeg_quality;
+                break;
+            case image_format_gif:
+                bytes = gdImageGifPtr(gd, &len);
+                encoded->format = L".gif";
+                encoded->param = NULL;
+                break;
+            case image_format_tiff:
+                bytes = gdImageTiffPtr(gd, &len);
+                encoded->format = L".tiff";
+                encoded->param = NULL;
+                break;
+            case image_format_wbmp:
+                bytes = gdImageWBMPPtr(gd, &len, image_options.wbmp_fg);
+                encoded->format = L".wbmp";
+                encoded->param = L"fg";
+                encoded->value = image_options.wbmp_fg;
+                break;
+            case image_format_webp:
+                bytes = gdImageWebpPtrEx(gd, &len, image_options.webp_quality);
+                encoded->format = L".webp";
+                encoded->param = L"quality";
+                encoded->value = image_options.webp_quality;
+                break;
+            default:
+                bytes = gdImageBmpPtr(gd, &len, image_options.bmp_compression);
+                encoded->format = L".bmp";
+                encoded->param = L"compression";
+                encoded->value = image_options.bmp_compression;
+                break;
+        }
+        
+        if(bytes)
+        {
+            encoded->bytes = std::shared_ptr<void>(bytes, gdFree);
+            encoded->size = len;
+        }
+    }
+}
+#pragma mark -
+
+gdImagePtr decode_image(image_format_t format, const void *bytes, int size){
+    
+    void *p = (void *)bytes;
+    
+    switch (format) {
+        case image_format_png:
+            return gdImageCreateFromPngPtr(size, p);
+        case image_format_jpg:
+            return gdImageCreateFromJpegPtr(size, p);
+        case image_format_gif:
+            return gdImageCreateFromGifPtr(size, p);
+        case image_format_tiff:
+            return gdImageCreateFromTiffPtr(size, p);
+        case image_format_wbmp:
+            return gdImageCreateFromWBMPPtr(size, p);
+        case image_format_webp:
+            return gdImageCreateFromWebpPtr(size, p);
+        default:
+            return gdImageCreateFromBmpPtr(size, p);
+    }
+}
+
+/* true if the filter was applied; *gd may be replaced */
+
+bool apply_filter(gdImagePtr *gd, const filter_t& filter){
+    
+    const std::string& name = filter.filter;
+    
+    if(name == "selectiveBlur")
+        return gdImageSelectiveBlur(*gd);
+    
+    if(name == "edgeDetectQuick")
+        return gdImageEdgeDetectQuick(*gd);
+    
+    if(name == "emboss")
+        return gdImageEmboss(*gd);
+    
+    if(name == "meanRemoval")
+        return gdImageMeanRemoval(*gd);
+    
+    if(name == "grayScale")
+        return gdImageGrayScale(*gd);
+    
+    if(name == "negate")
+        return gdImageNegate(*gd);
+    
+    if(name == "smooth")
+        return gdImageSmooth(*gd, filter.weight);
+    
+    if(name == "brightness")
+        return gdImageBrightness(*gd, filter.brightness);
+    
+    if(name == "contrast")
+        return gdImageContrast(*gd, filter.contrast);
+    
+    if(name == "rotate")
+    {
+        gdImagePtr _gd = gdImageCreateTrueColor(filter.dst_w, filter.dst_h);
+        
+        if(!_gd)
+            return false;
+        
+        /* make background transparent */
+        gdImageAlphaBlending(_gd, 0);
+        gdImageFill(_gd, 0, 0, gdImageColorAllocateAlpha(_gd, 0, 0, 0, 255));
+        gdImageSaveAlpha(_gd, 1);
+        
+        gdImageCopyRotated(_gd, *gd,
+                           filter.dst_x,
+                           filter.dst_y,
+                           filter.src_x,
+                           filter.src_y,
+                           filter.src_w,
+                           filter.src_h,
+                           filter.angle);
+        
+        gdImageDestroy(*gd);
+        
+        *gd = _gd;
+        
+        return true;
+    }
+    
+    if(name == "scatter")
+        return gdImageScatter(*gd, filter.sub, filter.plus);
+    
+    if(name == "pixelate")
+        return gdImagePixelate(*gd, filter.size, filter.mode);
+    
+    if(name == "gaussianBlur")
+    {
+        gdImagePtr _gd = gdImageCopyGaussianBlurred(*gd, filter.radius, filter.sigma);
+        
+        if(!_gd)
+            return false;
+        
+        gdImageDestroy(*gd);
+        
+        *gd = _gd;
+        
+        return true;
+    }
+    
+    if(name == "color")
+        return gdImageColor(*gd, filter.red, filter.green, filter.blue, filter.alpha);
+    
+    if(name == "scatterColor")
+    {
+        std::vector<int> colors(filter.colors);
+        return gdImageScatterColor(*gd, filter.sub, filter.plus, colors.empty() ? NULL : &colors[0], colors.size());
+    }
+    
+    if(name == "convolution")
+    {
+        float matrix[3][3];
+        memcpy(matrix, filter.matrix, sizeof(matrix));
+        return gdImageConvolution(*gd, matrix, filter.div, filter.offset);
+    }
+    
+    return false;
+}
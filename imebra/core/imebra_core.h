@@ -0,0 +1,687 @@
+/* --------------------------------------------------------------------------------
+ #
+ #	imebra_core.h
+ #	decode, window, render and encode; no dependency on the 4D plugin API
+ #	Project : Imebra
+ #
+ # --------------------------------------------------------------------------------*/
+
+#ifndef IMEBRA_CORE_H
+#define IMEBRA_CORE_H
+
+#include <imebra/imebra.h>
+#include <list>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <functional>
+#include <cmath>
+#include <algorithm>
+#include <map>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <sys/stat.h>
+#include <chrono>
+#include <ctime>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <new>
+#if defined(_WIN32)
+#include <locale>
+#include <codecvt>
+#endif
+
+#include "gd.h"
+
+#define FILE_BUFFER_LOAD 0x10000
+#define FRAME_CACHE_BUDGET 0x8000000
+#define FRAME_CACHE_INFOS 256
+#define FRAME_CACHE_SHARDS 16
+#define CACHE_KEY_SETTLED 2/* seconds after its last change before a file's dates are enough to identify it */
+
+#define JSON_BUFFER_RESERVE 0x10000
+#define JSON_BUFFER_RESERVE_PER_TAG 64
+
+#define STATISTICS_COMMANDS 16
+#define STATISTICS_BUCKETS 24
+#define STATISTICS_TRANSFER_SYNTAXES 16
+#define STATISTICS_SHARDS 16
+#define TRACE_BUFFER_EVENTS 0x4000
+#define TRACE_KIND_COMMAND 64
+
+#define BUFFER_POOL_MIN_SHIFT 16
+#define BUFFER_POOL_CLASSES 52
+#define BUFFER_POOL_THREAD_BUDGET 0x2000000
+#define BUFFER_POOL_SHARED_BUDGET 0x8000000
+
+#define WORK_THREADS_MAX 64
+
+#if defined(_WIN32)
+typedef std::wstring path_t;
+#else
+typedef std::string path_t;
+#endif
+
+typedef enum image_formats
+{
+    image_format_bmp  = 0,
+    image_format_png  = 1,
+    image_format_jpg  = 2,
+    image_format_gif  = 3,
+    image_format_wbmp = 4,
+    image_format_webp = 5,
+    image_format_tiff = 6
+}image_format_t;
+
+typedef enum outputs
+{
+    output_image = 0,
+    output_raw   = 1
+}output_t;
+
+typedef struct
+{
+    image_format_t format;
+    int jpeg_quality;
+    int png_level;
+    int wbmp_fg;
+    int webp_quality;
+    int bmp_compression;
+    std::uint32_t max_width;
+    std::uint32_t max_height;
+    output_t output;
+    bool rescale;
+}image_options_t;
+
+typedef struct
+{
+    std::shared_ptr<void> bytes;
+    size_t size;
+    const wchar_t *format;
+    const wchar_t *param;/* level, quality, fg or compression; NULL for .gif and .tiff */
+    int value;
+}encoded_image_t;
+
+typedef struct
+{
+    std::shared_ptr<imebra::Image> image;
+    std::shared_ptr<imebra::ReadingDataHandlerNumeric> handler;
+    const char *samples;/* owned by handler */
+    size_t size;
+    imebra::bitDepth_t depth;
+    std::uint32_t high_bit;
+    std::uint32_t channels;
+    size_t unit_size;
+}raw_frame_t;
+
+typedef enum stages
+{
+    stage_load       = 0,
+    stage_json       = 1,
+    stage_decode     = 2,
+    stage_modality   = 3,
+    stage_downsample = 4,
+    stage_voi        = 5,
+    stage_bitmap     = 6,
+    stage_encode     = 7,
+    stage_objects    = 8,
+    stage_wait       = 9,/* plugin locks shared between processes: frame cache, sessions, buffer pool */
+    stage_count      = 10
+}stage_t;
+
+typedef std::chrono::steady_clock::time_point stage_time_t;
+
+typedef struct
+{
+    std::uint32_t calls[stage_count];
+    double ms[stage_count];
+    std::uint64_t bytes[stage_count];
+}profile_t;
+
+typedef struct
+{
+    std::atomic<std::uint64_t> calls;
+    std::atomic<std::uint64_t> ns;
+    std::atomic<std::uint64_t> bytes;
+    std::atomic<std::uint64_t> buckets[STATISTICS_BUCKETS];/* bucket n: up to 2^n microseconds */
+}stage_statistics_t;
+
+typedef struct
+{
+    std::uint64_t calls;
+    std::uint64_t ns;
+    std::uint64_t bytes;
+    std::uint64_t buckets[STATISTICS_BUCKETS];
+}stage_statistics_values_t;
+
+/* threads add to their own shard, so that the counters do not bounce between cores */
+
+typedef struct alignas(64)
+{
+    stage_statistics_t commands[STATISTICS_COMMANDS];
+    stage_statistics_t stages[stage_count];
+}statistics_shard_t;
+
+typedef struct
+{
+    std::atomic<bool> enabled;
+    statistics_shard_t shards[STATISTICS_SHARDS];
+    std::atomic<std::uint64_t> frames[STATISTICS_TRANSFER_SYNTAXES];/* decoded, per transfer syntax */
+    std::atomic<std::uint64_t> frame_cache_hits;
+    std::atomic<std::uint64_t> frame_cache_misses;
+    std::atomic<std::uint64_t> result_cache_hits;
+    std::atomic<std::uint64_t> result_cache_misses;
+}statistics_t;
+
+/* a span; written by one thread only, read by the flush while it may be overwritten */
+
+typedef struct
+{
+    std::atomic<std::uint64_t> start;/* nanoseconds, steady clock */
+    std::atomic<std::uint64_t> duration;
+    std::atomic<std::uint64_t> info;/* kind:8 tid:24 bytes:32 */
+}trace_event_t;
+
+typedef struct
+{
+    std::atomic<std::uint64_t> head;/* events published */
+    std::atomic<std::uint64_t> writing;/* head + 1 while an event is written */
+    std::atomic<bool> in_use;/* owned by a running thread */
+    trace_event_t events[TRACE_BUFFER_EVENTS];
+}trace_buffer_t;
+
+struct trace_thread_t
+{
+    trace_buffer_t *buffer;
+    std::uint32_t tid;
+    ~trace_thread_t();/* the buffer goes back to the next thread, its events are kept */
+};
+
+typedef struct
+{
+    size_t frame;
+    bool decoded;
+    std::uint32_t width;
+    std::uint32_t height;
+    std::string colorSpace;
+    encoded_image_t image;
+    raw_frame_t raw;
+    std::shared_ptr<imebra::Image> source;/* pinned from the frame cache */
+    bool source_modality;
+    std::shared_ptr<profile_t> profile;/* profile:true only */
+}render_frame_t;
+
+typedef struct
+{
+    std::once_flag once;
+    bool ready;
+    std::vector<std::pair<size_t, size_t> > frames;/* first and end buffer of each frame */
+}fragment_index_t;
+
+typedef struct
+{
+    std::string colorSpace;
+    bool monochrome1;
+    imebra::vois_t vois;
+    std::list<std::shared_ptr<imebra::LUT> > luts;
+    double slope;
+    double intercept;
+    bool fused;/* modality, VOI and MONOCHROME1 in one stored value -> 8-bit table */
+    bool table_ready;
+    imebra::bitDepth_t table_depth;
+    std::vector<unsigned char> table;
+    bool jpeg_baseline;/* frames can be returned as encapsulated */
+    std::shared_ptr<fragment_index_t> fragments;/* encapsulated pixel data only */
+    size_t transfer_syntax;/* index in the statistics table */
+}windowing_t;
+
+typedef enum binary_policies
+{
+    binary_skip   = 0,
+    binary_length = 1,
+    binary_hex    = 2,
+    binary_base64 = 3,
+    binary_blob   = 4
+}binary_policy_t;
+
+typedef struct
+{
+    binary_policy_t binary;/* OB, OD, OF, OL, OW and UN values */
+    std::map<imebra::tagVR_t, binary_policy_t> vr_binary;
+    size_t limit;
+    size_t max_size_buffer_load;/* larger values of a file are still in the file */
+}tag_options_t;
+
+typedef struct
+{
+    std::string name;/* as written, without [item] */
+    std::uint16_t group;
+    std::uint16_t element;
+    long item;/* -1 for all items */
+}tag_path_segment_t;
+
+typedef std::vector<tag_path_segment_t> tag_path_t;
+
+typedef struct
+{
+    const char *keyword;
+    std::uint32_t tag;
+}tag_keyword_t;
+
+typedef struct
+{
+    std::string path;
+    tag_path_t tag_path;
+}tag_list_entry_t;
+
+typedef enum json_outputs
+{
+    json_none = 0,
+    json_text = 1,
+    json_blob = 2
+}json_output_t;
+
+typedef struct
+{
+    bool list;/* frames:[...] rather than start/stride/count */
+    std::vector<double> frames;
+    int start;
+    int stride;
+    int count;
+}frame_selection_t;
+
+typedef struct
+{
+    image_options_t image_options;
+    bool export_tags;
+    bool use_tag_list;
+    tag_options_t tag_options;
+    std::vector<tag_list_entry_t> tag_list;
+    json_output_t json_output;
+    std::string bulk_uri;
+    frame_selection_t frame_selection;
+    size_t max_size_buffer_load;
+    bool cache;
+    unsigned int threads;
+    bool profile;
+}request_options_t;
+
+typedef struct
+{
+    std::unique_ptr<imebra::DataSet> data;
+    windowing_t windowing;
+    std::vector<render_frame_t> frames;
+    std::string json;
+    std::string error;
+    std::string cache_key;/* empty: not cached */
+    path_t path;/* the file data was loaded from; empty for a BLOB */
+    bool cached;/* every frame came from the cache, data was not loaded */
+    profile_t profile;/* load, json and objects; frames have their own */
+    stage_time_t started;
+}dataset_result_t;
+
+typedef struct
+{
+    path_t path;
+    std::shared_ptr<imebra::ReadMemory> memory;
+}batch_item_t;
+
+typedef struct
+{
+    std::atomic<bool> cancel;
+    std::atomic<size_t> items_loaded;
+    std::atomic<size_t> frames_total;
+    std::atomic<size_t> frames_done;
+    std::atomic<size_t> bytes;/* encoded or raw */
+}batch_progress_t;
+
+typedef struct
+{
+    request_options_t request;
+    std::vector<batch_item_t> items;
+    std::vector<dataset_result_t> results;
+    batch_progress_t progress;
+    std::atomic<bool> done;
+    std::thread thread;
+}job_t;
+
+typedef struct
+{
+    std::string key;/* same as the frame cache key; decoded frames are kept there, within its budget */
+    size_t refs;
+    int timeout;/* seconds idle before the session is released, 0=never */
+    std::chrono::steady_clock::time_point last_used;
+    std::unique_ptr<imebra::DataSet> data;
+    windowing_t windowing;
+    size_t frames_count;
+    std::once_flag once;/* load */
+    std::atomic<bool> ready;/* loaded; not returned by get_session until then */
+}session_t;
+
+typedef std::function<void(size_t)> work_task_t;/* argument: index of the worker running the task */
+
+typedef struct
+{
+    std::deque<work_task_t> tasks;
+    std::mutex mutex;
+}work_queue_t;
+
+typedef struct
+{
+    std::vector<std::unique_ptr<work_queue_t> > queues;
+    std::atomic<size_t> pending;/* queued or running */
+    std::atomic<size_t> queued;
+    std::mutex mutex;/* idle workers sleep on wake */
+    std::condition_variable wake;
+    size_t helpers;/* worker slots handed to work_threads and not done yet; under mutex */
+}work_pool_t;
+
+/* a worker slot of one call: the call's pool, and the index of the queue it works from */
+
+typedef struct
+{
+    std::deque<std::pair<work_pool_t *, size_t> > slots;
+    std::mutex mutex;
+}work_thread_queue_t;
+
+/* threads kept for the whole process and shared by every call; started when a call needs them */
+
+struct work_threads_t
+{
+    work_thread_queue_t queues[WORK_THREADS_MAX];/* one per thread */
+    std::atomic<size_t> count;/* threads started */
+    std::atomic<size_t> queued;
+    std::atomic<size_t> busy;/* threads working for a call */
+    std::vector<std::thread> threads;
+    size_t next;
+    bool stop;
+    std::mutex mutex;/* threads, next and stop; idle threads sleep on wake */
+    std::condition_variable wake;
+    ~work_threads_t();/* work_threads_stop */
+};
+
+typedef struct
+{
+    const unsigned char *p;/* NULL: read from f */
+    FILE *f;
+    std::uint64_t size;
+}element_source_t;
+
+typedef struct
+{
+    std::string key;
+    std::string cache_key;
+    std::shared_ptr<imebra::Image> image;
+    size_t size;
+    std::uint64_t used;/* frame_cache.clock when last put or found */
+}cached_frame_t;
+
+typedef struct
+{
+    windowing_t windowing;
+    size_t frames_count;
+    size_t frames;/* entries in the cache */
+}cached_info_t;
+
+typedef struct
+{
+    size_t bytes;
+    size_t hits;
+    size_t misses;
+    size_t evictions;
+    std::list<cached_frame_t> lru;
+    std::map<std::string, std::list<cached_frame_t>::iterator> index;
+    std::map<std::string, cached_info_t> infos;
+    std::mutex mutex;
+}frame_cache_shard_t;
+
+/* every frame of an input is in the shard of its cache key; the budget is shared */
+
+typedef struct
+{
+    std::atomic<size_t> budget;
+    std::atomic<size_t> bytes;
+    std::atomic<std::uint64_t> clock;
+    frame_cache_shard_t shards[FRAME_CACHE_SHARDS];
+}frame_cache_t;
+
+/* blocks released by a thread, reused by the same thread without a lock */
+
+typedef struct
+{
+    std::vector<void *> blocks[BUFFER_POOL_CLASSES];
+    size_t bytes;
+}buffer_cache_t;
+
+/* thread_local; cache is NULL while the thread itself or buffer_pool_flush uses it */
+
+struct buffer_thread_t
+{
+    std::atomic<buffer_cache_t *> cache;
+    std::atomic<bool> flush;/* set by buffer_pool_flush while the thread had cache */
+    buffer_cache_t blocks;
+    buffer_thread_t();
+    ~buffer_thread_t();/* the blocks go to the shared tier, or are freed past its budget */
+};
+
+/* blocks passed on by the threads, one lock per size class */
+
+typedef struct
+{
+    std::vector<void *> blocks;
+    std::mutex mutex;
+}buffer_class_t;
+
+typedef struct
+{
+    std::atomic<size_t> thread_budget;/* each thread, 0=no thread tier */
+    std::atomic<size_t> shared_budget;/* 0=no shared tier */
+    std::atomic<size_t> thread_bytes;/* every thread */
+    std::atomic<size_t> shared_bytes;
+    std::atomic<std::uint64_t> thread_hits;
+    std::atomic<std::uint64_t> shared_hits;
+    std::atomic<std::uint64_t> misses;
+    std::atomic<std::uint64_t> thread_releases;
+    std::atomic<std::uint64_t> shared_releases;
+    std::atomic<std::uint64_t> frees;
+    buffer_class_t shared[BUFFER_POOL_CLASSES];
+    std::list<buffer_thread_t *> threads;/* for buffer_pool_flush */
+    std::mutex threads_mutex;
+}buffer_pool_t;
+
+void *buffer_pool_acquire(size_t size);
+void buffer_pool_release(void *p, size_t size);
+
+/* std::vector storage from the pool, for the per-frame bitmaps */
+
+template <typename T> struct buffer_pool_allocator
+{
+    typedef T value_type;
+    
+    buffer_pool_allocator(){}
+    template <typename U> buffer_pool_allocator(const buffer_pool_allocator<U>&){}
+    
+    T *allocate(size_t n)
+    {
+        void *p = buffer_pool_acquire(n * sizeof(T));
+        if(!p)
+            throw std::bad_alloc();
+        return (T *)p;
+    }
+    
+    void deallocate(T *p, size_t n)
+    {
+        buffer_pool_release(p, n * sizeof(T));
+    }
+};
+
+template <typename T, typename U> bool operator==(const buffer_pool_allocator<T>&, const buffer_pool_allocator<U>&){ return true; }
+template <typename T, typename U> bool operator!=(const buffer_pool_allocator<T>&, const buffer_pool_allocator<U>&){ return false; }
+
+typedef std::vector<char, buffer_pool_allocator<char> > bitmap_buffer_t;
+
+typedef struct
+{
+    std::string filter;
+    double weight;/* smooth */
+    double brightness;
+    double contrast;
+    int angle;/* rotate */
+    int dst_w;
+    int dst_h;
+    int dst_x;
+    int dst_y;
+    int src_w;
+    int src_h;
+    int src_x;
+    int src_y;
+    int sub;/* scatter, scatterColor */
+    int plus;
+    std::vector<int> colors;
+    int size;/* pixelate */
+    int mode;
+    int radius;/* gaussianBlur */
+    double sigma;
+    int red;/* color */
+    int green;
+    int blue;
+    int alpha;
+    float matrix[3][3];/* convolution */
+    double div;
+    double offset;
+}filter_t;
+
+#pragma pack(1)  // ensure structure is packed
+struct bitmap_file_header {
+    unsigned char   bitmap_type[2];     // 2 bytes
+    int             file_size;          // 4 bytes
+    short           reserved1;          // 2 bytes
+    short           reserved2;          // 2 bytes
+    unsigned int    offset_bits;        // 4 bytes
+};
+// bitmap image header (40 bytes)
+struct bitmap_image_header {
+    unsigned int    size_header;        // 4 bytes
+    unsigned int    width;              // 4 bytes
+    unsigned int    height;             // 4 bytes
+    short int       planes;             // 2 bytes
+    short int       bit_count;          // 2 bytes
+    unsigned int    compression;        // 4 bytes
+    unsigned int    image_size;         // 4 bytes
+    unsigned int    ppm_x;              // 4 bytes
+    unsigned int    ppm_y;              // 4 bytes
+    unsigned int    clr_used;           // 4 bytes
+    unsigned int    clr_important;      // 4 bytes
+};
+#pragma pack(0)  // restore normal structure packing rules
+
+#define sizeof_bitmap_file_header 14
+#define sizeof_bitmap_image_header 40
+
+extern statistics_t statistics;
+extern std::atomic<bool> trace_enabled;
+extern std::atomic<std::uint64_t> trace_origin;
+extern const wchar_t *stage_names[stage_count];
+extern frame_cache_t frame_cache;
+extern buffer_pool_t buffer_pool;
+extern work_threads_t work_threads;
+
+imebra::DataSet *load_dataset(const path_t& path, size_t maxSizeBufferLoad);
+imebra::DataSet *load_dataset(imebra::ReadMemory& mem);
+
+void json_append_string(const std::wstring& value, std::string& json);
+void json_append_utf8(const std::string& value, std::string& json);
+void json_append_number(double value, std::string& json);
+void json_append_person_name(const std::wstring& value, std::string& json);
+void json_append_values(imebra::ReadingDataHandler *handler, imebra::tagVR_t vr, std::string& json);
+void get_json(imebra::DataSet *data, const std::string& bulk_uri, const std::string& path, std::string& json);
+
+bool get_tag_keyword(const std::string& keyword, std::uint32_t *tag);
+bool get_tag_path_segment(const std::string& segment, tag_path_segment_t *path_segment);
+bool get_tag_path(const std::string& path, tag_path_t *tag_path);
+
+bool is_bulk_vr(imebra::tagVR_t vr);
+void bytes_to_hex(const unsigned char *bytes, size_t len, std::string& hex);
+void bytes_to_base64(const unsigned char *bytes, size_t len, std::string& base64);
+
+bool get_frame_modality(const image_options_t& image_options, const windowing_t& windowing);
+std::uint64_t xxh64(const char *bytes, size_t size, std::uint64_t seed);
+void get_cache_key(const char *bytes, size_t size, std::string& key);
+void get_cache_key(const path_t& path, std::string& key);
+frame_cache_shard_t *get_frame_cache_shard(const std::string& cache_key);
+void frame_cache_trim(size_t budget);
+std::shared_ptr<imebra::Image> frame_cache_get(const std::string& cache_key, const std::string& key);
+void frame_cache_put(const std::string& cache_key, const std::string& key, std::shared_ptr<imebra::Image> image);
+void frame_cache_put_info(const std::string& cache_key, const windowing_t& windowing, size_t frames_count);
+bool get_cached_result(dataset_result_t *result, const request_options_t& request);
+std::shared_ptr<imebra::Image> get_frame_image(imebra::DataSet *data, size_t page, bool modality, const windowing_t& windowing, const std::string& cache_key, render_frame_t *frame);
+
+void prepare_result(dataset_result_t *result, const request_options_t& request);
+
+void work_pool_init(work_pool_t *pool, unsigned int threads);
+void work_pool_push(work_pool_t *pool, size_t worker, const work_task_t& task);
+bool work_pool_pop(work_pool_t *pool, size_t worker, work_task_t& task);
+void work_pool_run(work_pool_t *pool);
+void work_threads_stop();
+bool load_result(batch_item_t& item, const request_options_t& request, dataset_result_t *result);
+bool process_item(batch_item_t& item, const request_options_t& request, dataset_result_t *result);
+void run_batch(std::vector<batch_item_t>& items, std::vector<dataset_result_t>& results, const request_options_t& request, batch_progress_t *progress);
+
+std::int32_t start_job(std::shared_ptr<job_t> job);
+std::shared_ptr<job_t> get_job(std::int32_t id);
+std::shared_ptr<job_t> collect_job(std::int32_t id);
+void cancel_jobs();
+
+std::int32_t open_session(const std::string& key, int timeout, const std::function<bool(session_t *)>& load);
+std::shared_ptr<session_t> get_session(std::int32_t id);
+void close_session(std::int32_t id);
+void close_sessions();
+
+size_t find_pixel_data_offset(const unsigned char *p, size_t size);
+void get_instance_key(const element_source_t& source, std::string& key);
+bool read_element_prefix(const path_t& path, std::uint32_t tag, size_t buffer, size_t limit, std::string& bytes);
+bool get_frame_fragments(imebra::DataSet *data, size_t page, const windowing_t& windowing, size_t *first, size_t *last);
+imebra::DataSet *get_frame_dataset(imebra::DataSet *data, size_t page, const windowing_t& windowing);
+
+void encode_image(gdImagePtr gd, const image_options_t& image_options, encoded_image_t *encoded);
+void encode_bmp(const bitmap_buffer_t& bitmap, std::uint32_t width, std::uint32_t height, encoded_image_t *encoded);
+gdImagePtr decode_image(image_format_t format, const void *bytes, int size);
+bool apply_filter(gdImagePtr *gd, const filter_t& filter);
+gdImagePtr gd_create_from_bitmap(const bitmap_buffer_t& bitmap, std::uint32_t width, std::uint32_t height);
+
+void get_frame_list(const frame_selection_t& selection, size_t frames_count, std::vector<size_t>& pages);
+void get_windowing(imebra::DataSet *data, windowing_t *windowing);
+void build_window_table(const windowing_t& windowing, imebra::bitDepth_t depth, double center, double width, std::vector<unsigned char>& table);
+void build_lut_table(const windowing_t& windowing, imebra::bitDepth_t depth, const imebra::LUT& lut, std::vector<unsigned char>& table);
+imebra::Image *downsample_image(const imebra::Image& image, std::uint32_t max_width, std::uint32_t max_height);
+bool render_monochrome(const imebra::Image& image, const windowing_t& windowing, const image_options_t& image_options, render_frame_t *frame);
+void render_raw(imebra::DataSet *data, size_t page, const windowing_t& windowing, const image_options_t& image_options, const std::string& cache_key, render_frame_t *frame);
+bool use_passthrough(const windowing_t& windowing, const image_options_t& image_options);
+bool render_passthrough(imebra::DataSet *data, size_t page, const windowing_t& windowing, render_frame_t *frame);
+void render_frame(imebra::DataSet *data, size_t page, const windowing_t& windowing, const image_options_t& image_options, const std::string& cache_key, render_frame_t *frame);
+void render_frames(imebra::DataSet *data, std::vector<render_frame_t>& frames, const windowing_t& windowing, const image_options_t& image_options, const std::string& cache_key, unsigned int threads);
+
+std::shared_ptr<void> buffer_pool_shared_ptr(size_t size);
+void buffer_pool_flush();
+
+void profile_reset(profile_t *profile);
+stage_time_t profile_begin(const profile_t *profile);
+void profile_end(profile_t *profile, stage_t stage, const stage_time_t& start, size_t bytes);
+
+void statistics_add(stage_statistics_t *stage, std::uint64_t ns, size_t bytes);
+void statistics_add_command(int command, const stage_time_t& start);
+statistics_shard_t *get_statistics_shard();
+void statistics_collect(bool command, size_t index, bool reset, stage_statistics_values_t *values);
+size_t get_transfer_syntax_index(const std::string& transferSyntax);
+const char *get_transfer_syntax(size_t index);
+
+std::uint64_t trace_ns(const stage_time_t& t);
+void trace_add(std::uint32_t kind, const stage_time_t& start, std::chrono::steady_clock::duration duration, size_t bytes);
+size_t trace_write(FILE *f, std::uint64_t origin, const wchar_t *const *command_names);
+
+
+#endif
@@ -0,0 +1,4332 @@
+/*
+ keywords of the tags in include/imebra/tagsEnumeration.h
+ lowercase, sorted for binary search; retired tags lose to current tags of the same name
+ */
+
+#ifndef TAG_KEYWORDS_H
+#define TAG_KEYWORDS_H
+
+static const tag_keyword_t tag_keywords[] = {
+    {"abortflag", 0x40101024},
+    {"abortreason", 0x40101021},
+    {"absolutechanneldisplayscale", 0x003A0248},
+    {"abstractpriorcodesequence", 0x0072003E},
+    {"abstractpriorvalue", 0x0072003C},
+    {"accessionnumber", 0x00080050},
+    {"accessorycode", 0x300A00F9},
+    {"acquiredimageareadoseproduct", 0x00189473},
+    {"acquiredsoundpathlength", 0x00144031},
+    {"acquisitioncomments", 0x00184000},
+    {"acquisitioncompressiontype", 0x00144032},
+    {"acquisitioncontextdescription", 0x00400556},
+    {"acquisitioncontextsequence", 0x00400555},
+    {"acquisitioncontrast", 0x00089209},
+    {"acquisitiondate", 0x00080022},
+    {"acquisitiondatetime", 0x0008002A},
+    {"acquisitiondeviceprocessingcode", 0x00181401},
+    {"acquisitiondeviceprocessingdescription", 0x00181400},
+    {"acquisitiondevicetypecodesequence", 0x00220015},
+    {"acquisitionduration", 0x00189073},
+    {"acquisitionendlocationsequence", 0x00189932},
+    {"acquisitionindex", 0x00209518},
+    {"acquisitionmatrix", 0x00181310},
+    {"acquisitionmethodalgorithmsequence", 0x00221423},
+    {"acquisitionmethodcodesequence", 0x00221420},
+    {"acquisitionmotion", 0x00189930},
+    {"acquisitionnumber", 0x00200012},
+    {"acquisitionprotocoldescription", 0x00189424},
+    {"acquisitionprotocolelementsequence", 0x00189920},
+    {"acquisitionprotocolelementspecificationsequence", 0x0018991F},
+    {"acquisitionprotocolname", 0x00189423},
+    {"acquisitionsamplesize", 0x00144033},
+    {"acquisitionsinseries", 0x00201001},
+    {"acquisitionsinstudy", 0x00201004},
+    {"acquisitionstartcondition", 0x00180073},
+    {"acquisitionstartconditiondata", 0x00180074},
+    {"acquisitionstartlocationsequence", 0x00189931},
+    {"acquisitionstatus", 0x40101044},
+    {"acquisitionterminationcondition", 0x00180071},
+    {"acquisitionterminationconditiondata", 0x00180075},
+    {"acquisitiontime", 0x00080032},
+    {"acquisitiontimesynchronized", 0x00181800},
+    {"acquisitiontype", 0x00189302},
+    {"acrossscanspatialresolution", 0x00220048},
+    {"actiontypeid", 0x00001008},
+    {"activeaperture", 0x00145100},
+    {"activesourcediameter", 0x300A0218},
+    {"activesourcelength", 0x300A021A},
+    {"actualcardiactriggerdelaytime", 0x00209252},
+    {"actualcardiactriggertimepriortorpeak", 0x00209155},
+    {"actualenvironmentalconditions", 0x00141010},
+    {"actualframeduration", 0x00181242},
+    {"actualhumanperformerssequence", 0x00404035},
+    {"actualrespiratorytriggerdelaytime", 0x00209257},
+    {"adaptivemapformat", 0x00280730},
+    {"addgrayscale", 0x00005150},
+    {"addintermediatesequence", 0x00460101},
+    {"additionaldrugsequence", 0x0018002A},
+    {"additionalinspectionmethodsequence", 0x4010106F},
+    {"additionalinspectionselectioncriteria", 0x4010106E},
+    {"additionalpatienthistory", 0x001021B0},
+    {"additionalrtroiidentificationcodesequence", 0x300600B9},
+    {"additionalscreeningperformed", 0x4010106D},
+    {"addnearsequence", 0x00460100},
+    {"addothersequence", 0x00460102},
+    {"addpower", 0x00460104},
+    {"addresstrial", 0x0040A353},
+    {"administrationroutecodesequence", 0x00540302},
+    {"admissionid", 0x00380010},
+    {"admittingdate", 0x00380020},
+    {"admittingdiagnosescodesequence", 0x00081084},
+    {"admittingdiagnosesdescription", 0x00081080},
+    {"admittingtime", 0x00380021},
+    {"advancedblendingsequence", 0x00701B01},
+    {"affectedsopclassuid", 0x00000002},
+    {"affectedsopinstanceuid", 0x00001000},
+    {"afterloaderchannelid", 0x300A0273},
+    {"agecorrectedsensitivitydeviationalgorithmsequence", 0x00240065},
+    {"agecorrectedsensitivitydeviationprobabilityvalue", 0x00240100},
+    {"agecorrectedsensitivitydeviationvalue", 0x00240092},
+    {"aircounts", 0x00143070},
+    {"aitdevicetype", 0x40101070},
+    {"alarmdecision", 0x40101031},
+    {"alarmdecisiontime", 0x4010102B},
+    {"algorithmcodesequencetrial", 0x0040A296},
+    {"algorithmdescription", 0x00189528},
+    {"algorithmdescriptiontrial", 0x0040A297},
+    {"algorithmfamilycodesequence", 0x0066002F},
+    {"algorithmname", 0x00660036},
+    {"algorithmnamecodesequence", 0x00660030},
+    {"algorithmparameters", 0x00660032},
+    {"algorithmroutingcodesequence", 0x40101064},
+    {"algorithmsource", 0x00240202},
+    {"algorithmtype", 0x00189527},
+    {"algorithmversion", 0x00660031},
+    {"aliaseddatatype", 0x0018980B},
+    {"alinepixelspacing", 0x00520014},
+    {"alinerate", 0x00520011},
+    {"alinesperframe", 0x00520012},
+    {"allergies", 0x00102110},
+    {"allowlossycompression", 0x2200000F},
+    {"allowmediasplitting", 0x22000007},
+    {"alongscanspatialresolution", 0x00220037},
+    {"alphaluttransferfunction", 0x00281410},
+    {"alphapalettecolorlookuptabledata", 0x00281204},
+    {"alphapalettecolorlookuptabledescriptor", 0x00281104},
+    {"alternatebeamdose", 0x300A0091},
+    {"alternatebeamdosetype", 0x300A0092},
+    {"alternatecontaineridentifiersequence", 0x00400515},
+    {"alternatecontentdescriptionsequence", 0x00700087},
+    {"alternaterepresentationsequence", 0x00083001},
+    {"ambientlightvaluesource", 0x00287025},
+    {"ambientreflectionintensity", 0x00701702},
+    {"amplifiertype", 0x0014400A},
+    {"analyzedarea", 0x00460227},
+    {"anatomicalorientationtype", 0x00102210},
+    {"anatomicapproachdirectioncodesequencetrial", 0x00082255},
+    {"anatomiclocationofexamininginstrumentcodesequencetrial", 0x00082259},
+    {"anatomiclocationofexamininginstrumentdescriptiontrial", 0x00082258},
+    {"anatomicperspectivecodesequencetrial", 0x00082257},
+    {"anatomicperspectivedescriptiontrial", 0x00082256},
+    {"anatomicportalofentrancecodesequencetrial", 0x00082253},
+    {"anatomicregionmodifiersequence", 0x00082220},
+    {"anatomicregionsequence", 0x00082218},
+    {"anatomicregionsinstudycodesequence", 0x00080063},
+    {"anatomicstructure", 0x00082208},
+    {"anatomicstructurereferencepoint", 0x00221463},
+    {"anatomicstructurespaceorregioncodesequencetrial", 0x00082251},
+    {"anatomicstructurespaceorregionmodifiercodesequencetrial", 0x0008225A},
+    {"anatomicstructurespaceorregionsequence", 0x00082229},
+    {"anchorpoint", 0x00700014},
+    {"anchorpointannotationunits", 0x00700004},
+    {"anchorpointvisibility", 0x00700015},
+    {"angioflag", 0x00180025},
+    {"anglenumber", 0x00200018},
+    {"angularposition", 0x00181141},
+    {"angularstep", 0x00181144},
+    {"angularviewvector", 0x00540090},
+    {"animationcurvesequence", 0x00701A04},
+    {"animationstepsize", 0x00701A05},
+    {"annotationclipping", 0x00701907},
+    {"annotationcontentsequence", 0x21300050},
+    {"annotationdisplayformatid", 0x20100030},
+    {"annotationflag", 0x20000065},
+    {"annotationgroupnumber", 0x0040A180},
+    {"annotationposition", 0x20300010},
+    {"anodetargetmaterial", 0x00181191},
+    {"anomalylocatorindicator", 0x4010107A},
+    {"anomalylocatorindicatorsequence", 0x40101079},
+    {"anteriorchamberdepth", 0x00221131},
+    {"anteriorchamberdepthdefinitioncodesequence", 0x00221125},
+    {"anteriorchamberdepthsequence", 0x00221128},
+    {"apertureelevation", 0x00145102},
+    {"apexposition", 0x00209308},
+    {"applicableframerange", 0x00286102},
+    {"applicablesafetystandardagency", 0x00189174},
+    {"applicablesafetystandarddescription", 0x00189175},
+    {"applicationmanufacturer", 0x00189526},
+    {"applicationmaximumrepainttime", 0x0072010E},
+    {"applicationname", 0x00189524},
+    {"applicationsetupcheck", 0x30080116},
+    {"applicationsetupmanufacturer", 0x300A0238},
+    {"applicationsetupname", 0x300A0236},
+    {"applicationsetupnumber", 0x300A0234},
+    {"applicationsetupsequence", 0x300A0230},
+    {"applicationsetuptype", 0x300A0232},
+    {"applicationversion", 0x00189525},
+    {"applicatorapertureshape", 0x300A0432},
+    {"applicatordescription", 0x300A010A},
+    {"applicatorgeometrysequence", 0x300A0431},
+    {"applicatorid", 0x300A0108},
+    {"applicatoropening", 0x300A0433},
+    {"applicatoropeningx", 0x300A0434},
+    {"applicatoropeningy", 0x300A0435},
+    {"applicatorsequence", 0x300A0107},
+    {"applicatortype", 0x300A0109},
+    {"approvalsequence", 0x00440100},
+    {"approvalstatus", 0x300E0002},
+    {"approvalstatusdatetime", 0x00440004},
+    {"approvalstatusfurtherdescription", 0x00440003},
+    {"approvalsubjectsequence", 0x00440109},
+    {"arbitrary", 0x40000010},
+    {"archiverequested", 0x0040A494},
+    {"arterialspinlabelingcontrast", 0x00189250},
+    {"ascanrate", 0x00221649},
+    {"aslboluscutoffdelaytime", 0x0018925F},
+    {"aslboluscutoffflag", 0x0018925C},
+    {"aslboluscutofftechnique", 0x0018925E},
+    {"aslboluscutofftimingsequence", 0x0018925D},
+    {"aslcontext", 0x00189257},
+    {"aslcrusherdescription", 0x0018925B},
+    {"aslcrusherflag", 0x00189259},
+    {"aslcrusherflowlimit", 0x0018925A},
+    {"aslmidslabposition", 0x00189256},
+    {"aslpulsetrainduration", 0x00189258},
+    {"aslslabnumber", 0x00189253},
+    {"aslslaborientation", 0x00189255},
+    {"aslslabsequence", 0x00189260},
+    {"aslslabthickness", 0x00189254},
+    {"asltechniquedescription", 0x00189252},
+    {"asserteridentificationsequence", 0x00440103},
+    {"assertioncodesequence", 0x00440101},
+    {"assertioncomments", 0x00440106},
+    {"assertiondatetime", 0x00440104},
+    {"assertionexpirationdatetime", 0x00440105},
+    {"assertionuid", 0x00440102},
+    {"assessedattributevaluesequence", 0x00820010},
+    {"assessedsopinstancesequence", 0x00820004},
+    {"assessmentlabel", 0x00820023},
+    {"assessmentobservationssequence", 0x00820007},
+    {"assessmentrequestersequence", 0x00820017},
+    {"assessmentsetid", 0x00820016},
+    {"assessmentsummary", 0x00820001},
+    {"assessmentsummarydescription", 0x00820003},
+    {"assessmenttypecodesequence", 0x00820021},
+    {"assignedlocation", 0x4010102A},
+    {"assigningagencyordepartmentcodesequence", 0x0040003A},
+    {"assigningfacilitysequence", 0x00400036},
+    {"assigningjurisdictioncodesequence", 0x00400039},
+    {"atdabilityassessment", 0x40101014},
+    {"atdassessmentflag", 0x40101015},
+    {"atdassessmentprobability", 0x40101016},
+    {"atdassessmentsequence", 0x40101038},
+    {"attachedcontours", 0x30060049},
+    {"attenuationcorrected", 0x00189759},
+    {"attenuationcorrectionmethod", 0x00541101},
+    {"attenuationcorrectionsource", 0x00189738},
+    {"attenuationcorrectiontemporalrelationship", 0x00189770},
+    {"attributeidentifierlist", 0x00001005},
+    {"attributeitemselector", 0x00741054},
+    {"attributemodificationdatetime", 0x04000562},
+    {"attributeoccurrencepointer", 0x00741052},
+    {"attributeoccurrenceprivatecreator", 0x00741056},
+    {"attributeoccurrencesequence", 0x00741050},
+    {"audiocomments", 0x5000200E},
+    {"audiosampledata", 0x5000200C},
+    {"audiosampleformat", 0x50002002},
+    {"audiotype", 0x50002000},
+    {"authorizationequipmentcertificationnumber", 0x01000426},
+    {"authorobserversequence", 0x0040A078},
+    {"autokvplowerbound", 0x00189946},
+    {"autokvpselectiontype", 0x00189944},
+    {"autokvpupperbound", 0x00189945},
+    {"autorefractionlefteyesequence", 0x00460052},
+    {"autorefractionrighteyesequence", 0x00460050},
+    {"autosequenceflag", 0x00741025},
+    {"averagebeamdosepointdepth", 0x300A008D},
+    {"averagebeamdosepointequivalentdepth", 0x300A008E},
+    {"averagebeamdosepointsourcetoexternalcontourdistance", 0x300A0131},
+    {"averagebeamdosepointssd", 0x300A008F},
+    {"averagecornealpower", 0x00460220},
+    {"averagepulsewidth", 0x00181154},
+    {"axialacceptance", 0x00541200},
+    {"axialdetectordimension", 0x00189727},
+    {"axiallengthoftheeye", 0x00220030},
+    {"axialmash", 0x00541201},
+    {"axialpower", 0x00460249},
+    {"axialresolution", 0x00520008},
+    {"axislabels", 0x50000040},
+    {"axisofrotation", 0x0066001B},
+    {"axisunits", 0x50000030},
+    {"b1rms", 0x00181320},
+    {"backgroundcolor", 0x00460092},
+    {"backgroundilluminationcolorcodesequence", 0x00240024},
+    {"backgroundluminance", 0x00240020},
+    {"badpixelimage", 0x00143080},
+    {"barcodesymbology", 0x22000006},
+    {"barcodevalue", 0x22000005},
+    {"baselinecorrection", 0x00189067},
+    {"basiccolorimagesequence", 0x20200111},
+    {"basicgrayscaleimagesequence", 0x20200110},
+    {"basismaterialscodesequence", 0x40101045},
+    {"beamangle", 0x00189449},
+    {"beamcurrentmodulationid", 0x300A034C},
+    {"beamdeliverydurationlimit", 0x300A00C5},
+    {"beamdescription", 0x300A00C3},
+    {"beamdose", 0x300A0084},
+    {"beamdosemeaning", 0x300A008B},
+    {"beamdosepointdepth", 0x300A0088},
+    {"beamdosepointequivalentdepth", 0x300A0089},
+    {"beamdosepointssd", 0x300A008A},
+    {"beamdosespecificationpoint", 0x300A0082},
+    {"beamdosetype", 0x300A0090},
+    {"beamdoseverificationcontrolpointsequence", 0x300A008C},
+    {"beamlimitingdeviceangle", 0x300A0120},
+    {"beamlimitingdeviceangletolerance", 0x300A0046},
+    {"beamlimitingdeviceleafpairssequence", 0x300800A0},
+    {"beamlimitingdevicepositionsequence", 0x300A011A},
+    {"beamlimitingdevicepositiontolerance", 0x300A004A},
+    {"beamlimitingdevicerotationdirection", 0x300A0121},
+    {"beamlimitingdevicesequence", 0x300A00B6},
+    {"beamlimitingdevicetolerancesequence", 0x300A0048},
+    {"beammeterset", 0x300A0086},
+    {"beamname", 0x300A00C2},
+    {"beamnumber", 0x300A00C0},
+    {"beamorderindex", 0x00741324},
+    {"beamorderindextrial", 0x00741024},
+    {"beamsequence", 0x300A00B0},
+    {"beamspotsize", 0x00520003},
+    {"beamstopperposition", 0x30080230},
+    {"beamtasksequence", 0x00741020},
+    {"beamtasktype", 0x00741022},
+    {"beamtype", 0x300A00C4},
+    {"beatrejectionflag", 0x00181080},
+    {"beltheight", 0x40101062},
+    {"bibliographiccitationtrial", 0x0040A16A},
+    {"billingitemsequence", 0x00400296},
+    {"billingprocedurestepsequence", 0x00400320},
+    {"billingsuppliesanddevicessequence", 0x00400324},
+    {"biopsytargetsequence", 0x00182041},
+    {"biplaneacquisitionsequence", 0x00285000},
+    {"bitsallocated", 0x00280100},
+    {"bitsforcodeword", 0x00280804},
+    {"bitsgrouped", 0x00280069},
+    {"bitsmappedtocolorlookuptable", 0x00281403},
+    {"bitsstored", 0x00280101},
+    {"blendingdisplayinputsequence", 0x00701B03},
+    {"blendingdisplaysequence", 0x00701B04},
+    {"blendinginputnumber", 0x00701B02},
+    {"blendinglookuptabledata", 0x00281408},
+    {"blendinglookuptabledescriptor", 0x00281407},
+    {"blendinglut1sequence", 0x00281404},
+    {"blendinglut1transferfunction", 0x00281405},
+    {"blendinglut2sequence", 0x0028140C},
+    {"blendinglut2transferfunction", 0x0028140D},
+    {"blendingmode", 0x00701B06},
+    {"blendingoperationtype", 0x00720500},
+    {"blendingposition", 0x00700405},
+    {"blendingsequence", 0x00700402},
+    {"blendingweightconstant", 0x00281406},
+    {"blindspotlocalized", 0x00240106},
+    {"blindspotxcoordinate", 0x00240107},
+    {"blindspotycoordinate", 0x00240108},
+    {"blockcolumns", 0x00280092},
+    {"blockdata", 0x300A0106},
+    {"blockdivergence", 0x300A00FA},
+    {"blockedpixels", 0x00280090},
+    {"blockidentifyinginformationstatus", 0x00080303},
+    {"blockmountingposition", 0x300A00FB},
+    {"blockname", 0x300A00FE},
+    {"blocknumber", 0x300A00FC},
+    {"blocknumberofpoints", 0x300A0104},
+    {"blockrows", 0x00280091},
+    {"blocksequence", 0x300A00F4},
+    {"blockslabnumber", 0x300A0443},
+    {"blockslabsequence", 0x300A0441},
+    {"blockslabthickness", 0x300A0442},
+    {"blockthickness", 0x300A0100},
+    {"blocktransmission", 0x300A0102},
+    {"blocktrayid", 0x300A00F5},
+    {"blocktype", 0x300A00F8},
+    {"bloodsignalnulling", 0x00189022},
+    {"bluepalettecolorlookuptabledata", 0x00281203},
+    {"bluepalettecolorlookuptabledescriptor", 0x00281103},
+    {"boardingpassid", 0x4010101A},
+    {"bodypartexamined", 0x00180015},
+    {"bodypartthickness", 0x001811A0},
+    {"bold", 0x00700249},
+    {"bolusdescription", 0x300A00DD},
+    {"bolusid", 0x300A00DC},
+    {"bonethermalindex", 0x00185024},
+    {"borderdensity", 0x20100100},
+    {"borders", 0x00005160},
+    {"bottomrighthandcorneroflocalizerarea", 0x00480202},
+    {"boundingboxannotationunits", 0x00700003},
+    {"boundingboxbottomrighthandcorner", 0x00700011},
+    {"boundingboxcrop", 0x00701303},
+    {"boundingboxtexthorizontaljustification", 0x00700012},
+    {"boundingboxtoplefthandcorner", 0x00700010},
+    {"boundingpolygon", 0x4010101D},
+    {"boundingrectangle", 0x00686347},
+    {"brachyaccessorydeviceid", 0x300A0263},
+    {"brachyaccessorydevicename", 0x300A0266},
+    {"brachyaccessorydevicenominalthickness", 0x300A026A},
+    {"brachyaccessorydevicenominaltransmission", 0x300A026C},
+    {"brachyaccessorydevicenumber", 0x300A0262},
+    {"brachyaccessorydevicesequence", 0x300A0260},
+    {"brachyaccessorydevicetype", 0x300A0264},
+    {"brachyapplicationsetupdose", 0x300A00A4},
+    {"brachyapplicationsetupdosespecificationpoint", 0x300A00A2},
+    {"brachycontrolpointdeliveredsequence", 0x30080160},
+    {"brachycontrolpointsequence", 0x300A02D0},
+    {"brachypulsecontrolpointdeliveredsequence", 0x30080173},
+    {"brachyreferenceddosereferencesequence", 0x300C0055},
+    {"brachytasksequence", 0x00741401},
+    {"brachytreatmenttechnique", 0x300A0200},
+    {"brachytreatmenttype", 0x300A0202},
+    {"branchofservice", 0x00101081},
+    {"breastimplantpresent", 0x00281300},
+    {"breastsupportisocenterprimaryangle", 0x00189545},
+    {"breastsupportisocentersecondaryangle", 0x00189546},
+    {"breastsupportxpositiontoisocenter", 0x00189547},
+    {"breastsupportypositiontoisocenter", 0x00189548},
+    {"breastsupportzpositiontoisocenter", 0x00189549},
+    {"breedregistrationnumber", 0x00102295},
+    {"breedregistrationsequence", 0x00102294},
+    {"breedregistrycodesequence", 0x00102296},
+    {"bridgeresistors", 0x00144088},
+    {"bscancycletime", 0x00221645},
+    {"bscancycletimevector", 0x00221646},
+    {"bscanrate", 0x00221650},
+    {"bscanslabthickness", 0x00221643},
+    {"bulkmotioncompensationtechnique", 0x00189172},
+    {"bulkmotionsignalsource", 0x00189173},
+    {"bulkmotionstatus", 0x00189166},
+    {"burnedinannotation", 0x00280301},
+    {"cadfileformat", 0x00140023},
+    {"calciumscoringmassfactordevice", 0x00189352},
+    {"calciumscoringmassfactorpatient", 0x00189351},
+    {"calculatedanatomythickness", 0x00189452},
+    {"calculateddosereferencedescription", 0x30080074},
+    {"calculateddosereferencedosevalue", 0x30080076},
+    {"calculateddosereferencenumber", 0x30080072},
+    {"calculateddosereferencesequence", 0x30080070},
+    {"calculatedframelist", 0x00081162},
+    {"calculatedtargetposition", 0x00182044},
+    {"calibrationdatasequence", 0x00540306},
+    {"calibrationdate", 0x0014407E},
+    {"calibrationimage", 0x00500004},
+    {"calibrationnotes", 0x00143099},
+    {"calibrationprocedure", 0x00144072},
+    {"calibrationsequence", 0x00189455},
+    {"calibrationsettingssequence", 0x00144070},
+    {"calibrationtime", 0x0014407C},
+    {"cameraangleofview", 0x0022001E},
+    {"cardiacbeatrejectiontechnique", 0x00189169},
+    {"cardiaccycleposition", 0x00189236},
+    {"cardiacframingtype", 0x00181064},
+    {"cardiacnumberofimages", 0x00181090},
+    {"cardiacrrintervalspecified", 0x00189070},
+    {"cardiacsignalsource", 0x00189085},
+    {"cardiacsynchronizationsequence", 0x00189118},
+    {"cardiacsynchronizationtechnique", 0x00189037},
+    {"carmpositionertabletoprelationship", 0x00189474},
+    {"carrierid", 0x40101058},
+    {"carrieridassigningauthority", 0x40101059},
+    {"cassetteid", 0x00181007},
+    {"cassetteorientation", 0x00181402},
+    {"cassettesize", 0x00181403},
+    {"catchtrialsdataflag", 0x00240055},
+    {"catheterdirectionofrotation", 0x00520031},
+    {"catheterrotationalrate", 0x00520013},
+    {"centerofcircularcollimator", 0x00181710},
+    {"centerofcircularexposurecontrolsensingregion", 0x00189440},
+    {"centerofcircularshutter", 0x00181610},
+    {"centerofmass", 0x4010101B},
+    {"centerofpto", 0x4010101C},
+    {"centerofrotation", 0x0066001C},
+    {"centerofrotationoffset", 0x00181145},
+    {"certificateofsigner", 0x04000115},
+    {"certificatetype", 0x04000110},
+    {"certifiedtimestamp", 0x04000310},
+    {"certifiedtimestamptype", 0x04000305},
+    {"chairheadframeposition", 0x300A0151},
+    {"chairheadframepositiontolerance", 0x300A0153},
+    {"channelbaseline", 0x003A0213},
+    {"channeldefinitionsequence", 0x003A0200},
+    {"channeldeliverycontinuationsequence", 0x0074140D},
+    {"channeldeliveryorderindex", 0x0074140C},
+    {"channeldeliveryordersequence", 0x00741405},
+    {"channelderivationdescription", 0x003A020C},
+    {"channeldescriptioncodesequence", 0x0022001A},
+    {"channeldisplaysequence", 0x003A0242},
+    {"channeleffectivelength", 0x300A0271},
+    {"channelidentificationcode", 0x003A0301},
+    {"channelinnerlength", 0x300A0272},
+    {"channellabel", 0x003A0203},
+    {"channellength", 0x300A0284},
+    {"channelmaximumvalue", 0x54000112},
+    {"channelminimumvalue", 0x54000110},
+    {"channelmode", 0x003A0302},
+    {"channelnumber", 0x300A0282},
+    {"channeloffset", 0x003A0218},
+    {"channeloverlap", 0x0014409F},
+    {"channelposition", 0x003A0245},
+    {"channelrecommendeddisplaycielabvalue", 0x003A0244},
+    {"channelsampleskew", 0x003A0215},
+    {"channelsensitivity", 0x003A0210},
+    {"channelsensitivitycorrectionfactor", 0x003A0212},
+    {"channelsensitivityunitssequence", 0x003A0211},
+    {"channelsequence", 0x300A0280},
+    {"channelsettingssequence", 0x00144091},
+    {"channelshieldid", 0x300A02B3},
+    {"channelshieldname", 0x300A02B4},
+    {"channelshieldnominalthickness", 0x300A02B8},
+    {"channelshieldnominaltransmission", 0x300A02BA},
+    {"channelshieldnumber", 0x300A02B2},
+    {"channelshieldsequence", 0x300A02B0},
+    {"channelsourcemodifierssequence", 0x003A0209},
+    {"channelsourcesequence", 0x003A0208},
+    {"channelstatus", 0x003A0205},
+    {"channelthreshold", 0x00144092},
+    {"channeltimeskew", 0x003A0214},
+    {"channeltotaltime", 0x300A0286},
+    {"channelwidth", 0x00460042},
+    {"chemicalshiftmaximumintegrationlimitinhz", 0x00189196},
+    {"chemicalshiftmaximumintegrationlimitinppm", 0x00189296},
+    {"chemicalshiftminimumintegrationlimitinhz", 0x00189195},
+    {"chemicalshiftminimumintegrationlimitinppm", 0x00189295},
+    {"chemicalshiftreference", 0x00189053},
+    {"chemicalshiftsequence", 0x00189084},
+    {"ciexywhitepoint", 0x00287018},
+    {"cinerate", 0x00180040},
+    {"cinerelativetorealtime", 0x00720330},
+    {"clinicaltrialcoordinatingcentername", 0x00120060},
+    {"clinicaltrialprotocolethicscommitteeapprovalnumber", 0x00120082},
+    {"clinicaltrialprotocolethicscommitteename", 0x00120081},
+    {"clinicaltrialprotocolid", 0x00120020},
+    {"clinicaltrialprotocolname", 0x00120021},
+    {"clinicaltrialseriesdescription", 0x00120072},
+    {"clinicaltrialseriesid", 0x00120071},
+    {"clinicaltrialsiteid", 0x00120030},
+    {"clinicaltrialsitename", 0x00120031},
+    {"clinicaltrialsponsorname", 0x00120010},
+    {"clinicaltrialsubjectid", 0x00120040},
+    {"clinicaltrialsubjectreadingid", 0x00120042},
+    {"clinicaltrialtimepointdescription", 0x00120051},
+    {"clinicaltrialtimepointid", 0x00120050},
+    {"coatingmaterialscodesequence", 0x006863A4},
+    {"codelabel", 0x00280800},
+    {"codemeaning", 0x00080104},
+    {"codenumberformat", 0x00280740},
+    {"codetablelocation", 0x00280803},
+    {"codevalue", 0x00080100},
+    {"codingschemedesignator", 0x00080102},
+    {"codingschemeexternalid", 0x00080114},
+    {"codingschemeidentificationsequence", 0x00080110},
+    {"codingschemename", 0x00080115},
+    {"codingschemeregistry", 0x00080112},
+    {"codingschemeresourcessequence", 0x00080109},
+    {"codingschemeresponsibleorganization", 0x00080116},
+    {"codingschemeuid", 0x0008010C},
+    {"codingschemeurl", 0x0008010E},
+    {"codingschemeurltype", 0x0008010A},
+    {"codingschemeversion", 0x00080103},
+    {"coefficientcoding", 0x00280402},
+    {"coefficientcodingpointers", 0x00280403},
+    {"coefficientssddn", 0x7FE00040},
+    {"coefficientssdhn", 0x7FE00030},
+    {"coefficientssdvn", 0x7FE00020},
+    {"coincidencewindowwidth", 0x00541210},
+    {"collationflag", 0x20000063},
+    {"collimatorgridname", 0x00181180},
+    {"collimatorleftverticaledge", 0x00181702},
+    {"collimatorlowerhorizontaledge", 0x00181708},
+    {"collimatorrightverticaledge", 0x00181704},
+    {"collimatorshape", 0x00181700},
+    {"collimatorshapesequence", 0x00189407},
+    {"collimatortype", 0x00181181},
+    {"collimatorupperhorizontaledge", 0x00181706},
+    {"colorimageprintingflag", 0x20000062},
+    {"colorspace", 0x00282002},
+    {"columnangulation", 0x00181450},
+    {"columnangulationpatient", 0x00189447},
+    {"columnoverlap", 0x00280094},
+    {"columnpositionintotalimagepixelmatrix", 0x0048021E},
+    {"columns", 0x00280011},
+    {"columnsfornthordercoefficients", 0x00280401},
+    {"commanddatasettype", 0x00000800},
+    {"commandfield", 0x00000100},
+    {"commandgrouplength", 0x00000000},
+    {"commandlengthtoend", 0x00000001},
+    {"commandmagnificationtype", 0x00005180},
+    {"commandrecognitioncode", 0x00000010},
+    {"commentsonpatientperformanceofvisualfield", 0x00240044},
+    {"commentsonradiationdose", 0x00400310},
+    {"commentsontheperformedprocedurestep", 0x00400280},
+    {"commentsonthescheduledprocedurestep", 0x00400400},
+    {"compensatorcolumnoffset", 0x300A02E5},
+    {"compensatorcolumns", 0x300A00E8},
+    {"compensatordescription", 0x300A02EB},
+    {"compensatordivergence", 0x300A02E0},
+    {"compensatorid", 0x300A00E5},
+    {"compensatormillingtooldiameter", 0x300A02E8},
+    {"compensatormountingposition", 0x300A02E1},
+    {"compensatornumber", 0x300A00E4},
+    {"compensatorpixelspacing", 0x300A00E9},
+    {"compensatorposition", 0x300A00EA},
+    {"compensatorrelativestoppingpowerratio", 0x300A02E7},
+    {"compensatorrows", 0x300A00E7},
+    {"compensatorsequence", 0x300A00E3},
+    {"compensatorthicknessdata", 0x300A00EC},
+    {"compensatortransmissiondata", 0x300A00EB},
+    {"compensatortrayid", 0x300A00EF},
+    {"compensatortype", 0x300A00EE},
+    {"completionflag", 0x0040A491},
+    {"completionflagdescription", 0x0040A492},
+    {"compleximagecomponent", 0x00089208},
+    {"component1referencedid", 0x00760070},
+    {"component1referencedmatingfeatureid", 0x00760090},
+    {"component1referencedmatingfeaturesetid", 0x00760080},
+    {"component2referencedid", 0x007600A0},
+    {"component2referencedmatingfeatureid", 0x007600C0},
+    {"component2referencedmatingfeaturesetid", 0x007600B0},
+    {"componentassemblysequence", 0x00760060},
+    {"componentid", 0x00760055},
+    {"componentinputsequence", 0x00701803},
+    {"componentmanufacturer", 0x00140028},
+    {"componentmanufacturingprocedure", 0x00140025},
+    {"componentreferencesystem", 0x00140024},
+    {"componentsequence", 0x00760040},
+    {"componentshape", 0x00140050},
+    {"componenttype", 0x00701802},
+    {"componenttypecodesequence", 0x00760034},
+    {"componenttypessequence", 0x00760032},
+    {"componentwelderids", 0x00140100},
+    {"compositingmethod", 0x00701206},
+    {"compoundgraphicinstanceid", 0x00700226},
+    {"compoundgraphicsequence", 0x00700209},
+    {"compoundgraphictype", 0x00700294},
+    {"compoundgraphicunits", 0x00700282},
+    {"compressioncode", 0x00280060},
+    {"compressioncontactarea", 0x001811A5},
+    {"compressiondescription", 0x00280063},
+    {"compressionforce", 0x001811A2},
+    {"compressionlabel", 0x00280062},
+    {"compressionoriginator", 0x00280061},
+    {"compressionpressure", 0x001811A3},
+    {"compressionrecognitioncode", 0x0028005F},
+    {"compressionsequence", 0x00280065},
+    {"compressionsteppointers", 0x00280066},
+    {"concatenationframeoffsetnumber", 0x00209228},
+    {"concatenationuid", 0x00209161},
+    {"conceptcodesequence", 0x0040A168},
+    {"conceptnamecodesequence", 0x0040A043},
+    {"condenserlenspower", 0x00480111},
+    {"confidentialitycode", 0x00401008},
+    {"confidentialityconstraintonpatientdatadescription", 0x00403001},
+    {"configurationdescription", 0x0028700D},
+    {"configurationid", 0x0028700B},
+    {"configurationinformation", 0x20100150},
+    {"configurationinformationdescription", 0x20100152},
+    {"configurationname", 0x0028700C},
+    {"configurationqaresultssequence", 0x00287011},
+    {"connectortype", 0x00145105},
+    {"consentforclinicaltrialusesequence", 0x00120083},
+    {"consentfordistributionflag", 0x00120085},
+    {"constantvolumeflag", 0x00189333},
+    {"constrainttype", 0x00820032},
+    {"constraintvaluesequence", 0x00820034},
+    {"constraintviolationcondition", 0x00820037},
+    {"constraintviolationsignificance", 0x00820036},
+    {"constraintweight", 0x300A0021},
+    {"consultingphysicianidentificationsequence", 0x0008009D},
+    {"consultingphysicianname", 0x0008009C},
+    {"contactdisplayname", 0x0074100C},
+    {"contacturi", 0x0074100A},
+    {"containercomponentdescription", 0x0050001E},
+    {"containercomponentdiameter", 0x0050001D},
+    {"containercomponentid", 0x0050001B},
+    {"containercomponentlength", 0x0050001C},
+    {"containercomponentmaterial", 0x0050001A},
+    {"containercomponentsequence", 0x00400520},
+    {"containercomponentthickness", 0x00500013},
+    {"containercomponenttypecodesequence", 0x00500012},
+    {"containercomponentwidth", 0x00500015},
+    {"containerdescription", 0x0040051A},
+    {"containeridentifier", 0x00400512},
+    {"containertypecodesequence", 0x00400518},
+    {"contentcreatoridentificationcodesequence", 0x00700086},
+    {"contentcreatorname", 0x00700084},
+    {"contentdate", 0x00080023},
+    {"contentdescription", 0x00700081},
+    {"contentitemmodifiersequence", 0x00400441},
+    {"contentlabel", 0x00700080},
+    {"contentqualification", 0x00189004},
+    {"contentsequence", 0x0040A730},
+    {"contenttemplatesequence", 0x0040A504},
+    {"contenttime", 0x00080033},
+    {"contextgroupextensioncreatoruid", 0x0008010D},
+    {"contextgroupextensionflag", 0x0008010B},
+    {"contextgroupidentificationsequence", 0x00080123},
+    {"contextgrouplocalversion", 0x00080107},
+    {"contextgroupversion", 0x00080106},
+    {"contextidentifier", 0x0008010F},
+    {"contextuid", 0x00080117},
+    {"continuationendmeterset", 0x00740121},
+    {"continuationendtotalreferenceairkerma", 0x00741403},
+    {"continuationpulsenumber", 0x00741404},
+    {"continuationstartmeterset", 0x00740120},
+    {"continuationstarttotalreferenceairkerma", 0x00741402},
+    {"continuityofcontent", 0x0040A050},
+    {"contourdata", 0x30060050},
+    {"contourgeometrictype", 0x30060042},
+    {"contourimagesequence", 0x30060016},
+    {"contournumber", 0x30060048},
+    {"contouroffsetvector", 0x30060045},
+    {"contoursequence", 0x30060040},
+    {"contourslabthickness", 0x30060044},
+    {"contouruncertaintyradius", 0x00700312},
+    {"contraindicationscodesequence", 0x0018990B},
+    {"contrastadministrationprofilesequence", 0x00189340},
+    {"contrastbolusadministrationroutesequence", 0x00180014},
+    {"contrastbolusagent", 0x00180010},
+    {"contrastbolusagentadministered", 0x00189342},
+    {"contrastbolusagentdetected", 0x00189343},
+    {"contrastbolusagentnumber", 0x00189337},
+    {"contrastbolusagentphase", 0x00189344},
+    {"contrastbolusagentsequence", 0x00180012},
+    {"contrastbolusingredient", 0x00181048},
+    {"contrastbolusingredientcodesequence", 0x00189338},
+    {"contrastbolusingredientconcentration", 0x00181049},
+    {"contrastbolusingredientopaque", 0x00189425},
+    {"contrastbolusingredientpercentbyvolume", 0x00520001},
+    {"contrastbolusroute", 0x00181040},
+    {"contrastbolusstarttime", 0x00181042},
+    {"contrastbolusstoptime", 0x00181043},
+    {"contrastbolust1relaxivity", 0x00180013},
+    {"contrastbolustotaldose", 0x00181044},
+    {"contrastbolususagesequence", 0x00189341},
+    {"contrastbolusvolume", 0x00181041},
+    {"contrastflowduration", 0x00181047},
+    {"contrastflowrate", 0x00181046},
+    {"contrastframeaveraging", 0x00286112},
+    {"contributingequipmentsequence", 0x0018A001},
+    {"contributingsopinstancesreferencesequence", 0x00209529},
+    {"contributingsourcessequence", 0x00189506},
+    {"contributiondatetime", 0x0018A002},
+    {"contributiondescription", 0x0018A003},
+    {"controlpoint3dposition", 0x300A02D4},
+    {"controlpointdeliverysequence", 0x30080040},
+    {"controlpointindex", 0x300A0112},
+    {"controlpointorientation", 0x300A0412},
+    {"controlpointrelativeposition", 0x300A02D2},
+    {"controlpointsequence", 0x300A0111},
+    {"conventionalcontrolpointverificationsequence", 0x0074104C},
+    {"conventionalmachineverificationsequence", 0x00741044},
+    {"conversionsourceattributessequence", 0x00209172},
+    {"conversiontype", 0x00080064},
+    {"convolutionkernel", 0x00181210},
+    {"convolutionkernelgroup", 0x00189316},
+    {"coordinatessetgeometrictypetrial", 0x0040A290},
+    {"coordinatestartvalue", 0x50000112},
+    {"coordinatestepvalue", 0x50000114},
+    {"coordinatesystemaxessequence", 0x00142204},
+    {"coordinatesystemaxiscodesequence", 0x004008DA},
+    {"coordinatesystemaxisdescription", 0x00142206},
+    {"coordinatesystemaxisnumber", 0x0014220A},
+    {"coordinatesystemaxistype", 0x0014220C},
+    {"coordinatesystemaxisunits", 0x0014220E},
+    {"coordinatesystemaxisvalues", 0x00142210},
+    {"coordinatesystemdatasetmapping", 0x00142208},
+    {"coordinatesystemnumberofaxes", 0x00142202},
+    {"coordinatesystemtransformrotationandscalematrix", 0x0014222A},
+    {"coordinatesystemtransformsequence", 0x00142220},
+    {"coordinatesystemtransformtranslationmatrix", 0x0014222C},
+    {"copies", 0x00005170},
+    {"cornealeccentricityindex", 0x00460234},
+    {"cornealisvalue", 0x00460224},
+    {"cornealpointestimated", 0x00460248},
+    {"cornealpointlocation", 0x00460247},
+    {"cornealsize", 0x00460046},
+    {"cornealtopographymappingnormalssequence", 0x00460210},
+    {"cornealtopographymapqualityevaluation", 0x00460242},
+    {"cornealtopographymaptypecodesequence", 0x00460207},
+    {"cornealtopographysurface", 0x00460201},
+    {"cornealvertexlocation", 0x00460202},
+    {"cornealwavefront", 0x00460253},
+    {"correctedimage", 0x00280051},
+    {"correctedlocalizeddeviationfromnormal", 0x00240079},
+    {"correctedlocalizeddeviationfromnormalcalculated", 0x00240078},
+    {"correctedlocalizeddeviationfromnormalprobability", 0x00240081},
+    {"correctedlocalizeddeviationfromnormalprobabilitycalculated", 0x00240080},
+    {"correctedparametersequence", 0x30080068},
+    {"correctionvalue", 0x3008006A},
+    {"countlossnormalizationcorrected", 0x00189764},
+    {"countrate", 0x00181243},
+    {"countryofresidence", 0x00102150},
+    {"countsaccumulated", 0x00180070},
+    {"countsincluded", 0x00541400},
+    {"countssource", 0x00541002},
+    {"couplingmedium", 0x00144056},
+    {"couplingtechnique", 0x00144054},
+    {"couplingvelocity", 0x00144057},
+    {"coverageofkspace", 0x00189094},
+    {"cranialthermalindex", 0x00185026},
+    {"creationdate", 0x21000040},
+    {"creationtime", 0x21000050},
+    {"creatorversionuid", 0x00089123},
+    {"crop", 0x00701204},
+    {"croppingspecificationindex", 0x00701205},
+    {"croppingspecificationnumber", 0x00701309},
+    {"cssfontname", 0x00700229},
+    {"ctacquisitiondetailssequence", 0x00189304},
+    {"ctacquisitiontypesequence", 0x00189301},
+    {"ctadditionalxraysourcesequence", 0x00189360},
+    {"ctdiphantomtypecodesequence", 0x00189346},
+    {"ctdivol", 0x00189345},
+    {"ctdivolnotificationtrigger", 0x00189942},
+    {"ctexposuresequence", 0x00189321},
+    {"ctgeometrysequence", 0x00189312},
+    {"ctimageframetypesequence", 0x00189329},
+    {"ctpositionsequence", 0x00189326},
+    {"ctreconstructionsequence", 0x00189314},
+    {"cttabledynamicssequence", 0x00189308},
+    {"ctxraydetailssequence", 0x00189325},
+    {"cumulativedosereferencecoefficient", 0x300A010C},
+    {"cumulativedosetodosereference", 0x30080052},
+    {"cumulativemetersetweight", 0x300A0134},
+    {"cumulativetimeweight", 0x300A02D6},
+    {"currentconfigurationid", 0x00287002},
+    {"currentfractionnumber", 0x30080022},
+    {"currentobservertrial", 0x0040A307},
+    {"currentpatientlocation", 0x00380300},
+    {"currentrequestedprocedureevidencesequence", 0x0040A375},
+    {"currenttreatmentstatus", 0x30080200},
+    {"curvaturetype", 0x00140052},
+    {"curveactivationlayer", 0x50001001},
+    {"curvedata", 0x50003000},
+    {"curvedatadescriptor", 0x50000110},
+    {"curvedate", 0x00080025},
+    {"curvedescription", 0x50000022},
+    {"curvedimensions", 0x50000005},
+    {"curvelabel", 0x50002500},
+    {"curvenumber", 0x00200024},
+    {"curverange", 0x50000106},
+    {"curvereferencedoverlaygroup", 0x50002610},
+    {"curvereferencedoverlaysequence", 0x50002600},
+    {"curvetime", 0x00080035},
+    {"custodialorganizationsequence", 0x0040A07C},
+    {"cylinderaxis", 0x00220009},
+    {"cylinderlenspower", 0x00220008},
+    {"cylinderpower", 0x00460147},
+    {"cylindersequence", 0x00460018},
+    {"dacamplitude", 0x0014403C},
+    {"dacgainpoints", 0x00144038},
+    {"dacsequence", 0x00144035},
+    {"dactimepoints", 0x0014403A},
+    {"dactype", 0x00144036},
+    {"damping", 0x00144028},
+    {"darkcurrentcounts", 0x00143050},
+    {"darkcurrentsequence", 0x00143040},
+    {"datablock", 0x00280702},
+    {"datablockdescription", 0x00280701},
+    {"datacollectioncenterpatient", 0x00189313},
+    {"datacollectiondiameter", 0x00180090},
+    {"dataelementssigned", 0x04000020},
+    {"dataframeassignmentsequence", 0x00281401},
+    {"datainformationsequence", 0x00540063},
+    {"dataobservationsequence", 0x00240325},
+    {"datapathassignment", 0x00281402},
+    {"datapathid", 0x0028140E},
+    {"datapointcolumns", 0x00289002},
+    {"datapointrows", 0x00289001},
+    {"datarepresentation", 0x00289108},
+    {"datasetdescription", 0x00240309},
+    {"datasetname", 0x00240306},
+    {"datasetsource", 0x00240308},
+    {"datasetsubtype", 0x00080041},
+    {"datasettrailingpadding", 0xFFFCFFFC},
+    {"datasettype", 0x00080040},
+    {"datasetversion", 0x00240307},
+    {"datatype", 0x00189808},
+    {"datavaluerepresentation", 0x50000103},
+    {"date", 0x0040A121},
+    {"dateofdocumentorverbaltransactiontrial", 0x0040A110},
+    {"dateofgaincalibration", 0x00143076},
+    {"dateoflastcalibration", 0x00181200},
+    {"dateoflastdetectorcalibration", 0x0018700C},
+    {"dateofsecondarycapture", 0x00181012},
+    {"datetime", 0x0040A120},
+    {"datetimeoflastcalibration", 0x00181202},
+    {"dbdt", 0x00181318},
+    {"dctlabel", 0x00280700},
+    {"ddlvalue", 0x00287017},
+    {"deadtimecorrected", 0x00189761},
+    {"deadtimecorrectionflag", 0x00541401},
+    {"deadtimefactor", 0x00541324},
+    {"decaycorrected", 0x00189758},
+    {"decaycorrection", 0x00541102},
+    {"decaycorrectiondatetime", 0x00189701},
+    {"decayfactor", 0x00541321},
+    {"decimalpotentialvisualacuity", 0x00460238},
+    {"decimalvisualacuity", 0x00460137},
+    {"decimatecropresult", 0x202000A2},
+    {"decouplednucleus", 0x00189060},
+    {"decoupling", 0x00189059},
+    {"decouplingchemicalshiftreference", 0x00189063},
+    {"decouplingfrequency", 0x00189061},
+    {"decouplingmethod", 0x00189062},
+    {"defaultmagnificationtype", 0x201000A6},
+    {"defaultprinterresolutionid", 0x20100054},
+    {"defaultsmoothingtype", 0x201000A8},
+    {"definitionsourcesequence", 0x00081156},
+    {"deformableregistrationgridsequence", 0x00640005},
+    {"deformableregistrationsequence", 0x00640002},
+    {"degreeofdilation", 0x0022000E},
+    {"degreeoffreedomid", 0x00686410},
+    {"degreeoffreedomtype", 0x00686420},
+    {"deidentificationaction", 0x00080307},
+    {"deidentificationactionsequence", 0x00080305},
+    {"deidentificationmethod", 0x00120063},
+    {"deidentificationmethodcodesequence", 0x00120064},
+    {"delaylawidentifier", 0x0014405C},
+    {"deletionlock", 0x00741230},
+    {"deliveredchanneltotaltime", 0x30080134},
+    {"delivereddepthdoseparameterssequence", 0x300A0506},
+    {"delivereddistaldepth", 0x300A0508},
+    {"delivereddistaldepthfraction", 0x300A0507},
+    {"deliveredmeterset", 0x30080044},
+    {"deliverednominalrangemodulatedregiondepths", 0x300A0510},
+    {"deliverednominalrangemodulationfractions", 0x300A0509},
+    {"deliverednumberofpulses", 0x30080138},
+    {"deliveredprimarymeterset", 0x30080036},
+    {"deliveredpulserepetitioninterval", 0x3008013C},
+    {"deliveredreferencedosedefinition", 0x300A0511},
+    {"deliveredsecondarymeterset", 0x30080037},
+    {"deliveredtreatmenttime", 0x3008003B},
+    {"deliverymaximumdose", 0x300A0023},
+    {"deliveryverificationimagesequence", 0x00741030},
+    {"deliverywarningdose", 0x300A0022},
+    {"density", 0x40101018},
+    {"depthdoseparameterssequence", 0x300A0505},
+    {"depthofscanfield", 0x00185050},
+    {"depthoftransverseimage", 0x00220041},
+    {"depthsoffocus", 0x00189801},
+    {"depthspatialresolution", 0x00220035},
+    {"depthvalueaveragingflag", 0x300A0093},
+    {"derivationalgorithmsequence", 0x00221612},
+    {"derivationcodesequence", 0x00089215},
+    {"derivationdescription", 0x00082111},
+    {"derivationimagesequence", 0x00089124},
+    {"derivationimplantassemblytemplatesequence", 0x0076000E},
+    {"derivationimplanttemplatesequence", 0x00686224},
+    {"destinationae", 0x21000140},
+    {"detailsofcoefficients", 0x00280404},
+    {"detectoractivationoffsetfromexposure", 0x00187016},
+    {"detectoractiveareaorientation", 0x00189558},
+    {"detectoractiveareatlhcposition", 0x00189557},
+    {"detectoractivedimensions", 0x00187026},
+    {"detectoractiveorigin", 0x00187028},
+    {"detectoractiveshape", 0x00187024},
+    {"detectoractivetime", 0x00187014},
+    {"detectorbinning", 0x0018701A},
+    {"detectorcalibrationdata", 0x4010106C},
+    {"detectorconditionsnominalflag", 0x00187000},
+    {"detectorconfiguration", 0x00187005},
+    {"detectordescription", 0x00187006},
+    {"detectorelementphysicalsize", 0x00187020},
+    {"detectorelementsize", 0x00541203},
+    {"detectorelementspacing", 0x00187022},
+    {"detectorgeometry", 0x00189725},
+    {"detectorgeometrysequence", 0x40100004},
+    {"detectorid", 0x0018700A},
+    {"detectorinformationsequence", 0x00540022},
+    {"detectorisocenterprimaryangle", 0x00189550},
+    {"detectorisocentersecondaryangle", 0x00189551},
+    {"detectorlinesofresponseused", 0x00541104},
+    {"detectormanufacturermodelname", 0x0018702B},
+    {"detectormanufacturername", 0x0018702A},
+    {"detectormode", 0x00187008},
+    {"detectornormalizationcorrection", 0x00189768},
+    {"detectorpositionsequence", 0x00189541},
+    {"detectorprimaryangle", 0x00181530},
+    {"detectorsecondaryangle", 0x00181531},
+    {"detectortemperature", 0x00187001},
+    {"detectortemperaturesequence", 0x00143020},
+    {"detectortimesincelastexposure", 0x00187012},
+    {"detectortype", 0x00187004},
+    {"detectorvector", 0x00540020},
+    {"detectorxpositiontoisocenter", 0x00189552},
+    {"detectorypositiontoisocenter", 0x00189553},
+    {"detectorzpositiontoisocenter", 0x00189554},
+    {"deviationindex", 0x00181413},
+    {"devicedescription", 0x00500020},
+    {"devicediameter", 0x00500016},
+    {"devicediameterunits", 0x00500017},
+    {"deviceid", 0x00181003},
+    {"devicelength", 0x00500014},
+    {"devicemotioncontrolsequence", 0x300A0450},
+    {"devicemotionexecutionmode", 0x300A0451},
+    {"devicemotionobservationmode", 0x300A0452},
+    {"devicemotionparametercodesequence", 0x300A0453},
+    {"devicesequence", 0x00500010},
+    {"deviceserialnumber", 0x00181000},
+    {"deviceuid", 0x00181002},
+    {"devicevolume", 0x00500018},
+    {"dialogreceiver", 0x00004000},
+    {"diameterofvisibility", 0x00700262},
+    {"diaphragmposition", 0x30020034},
+    {"dicommediaretrievalsequence", 0x0040E022},
+    {"dicomretrievalsequence", 0x0040E021},
+    {"dicomstoragesequence", 0x00404071},
+    {"dicosversion", 0x4010103A},
+    {"diffusereflectionintensity", 0x00701704},
+    {"diffusionacquisitioncodesequence", 0x00660133},
+    {"diffusionanisotropytype", 0x00189147},
+    {"diffusionbmatrixsequence", 0x00189601},
+    {"diffusionbvalue", 0x00189087},
+    {"diffusionbvaluexx", 0x00189602},
+    {"diffusionbvaluexy", 0x00189603},
+    {"diffusionbvaluexz", 0x00189604},
+    {"diffusionbvalueyy", 0x00189605},
+    {"diffusionbvalueyz", 0x00189606},
+    {"diffusionbvaluezz", 0x00189607},
+    {"diffusiondirectionality", 0x00189075},
+    {"diffusiongradientdirectionsequence", 0x00189076},
+    {"diffusiongradientorientation", 0x00189089},
+    {"diffusionmodelcodesequence", 0x00660134},
+    {"digitalimageformatacquired", 0x00181023},
+    {"digitalsignaturedatetime", 0x04000105},
+    {"digitalsignaturepurposecodesequence", 0x04000401},
+    {"digitalsignaturessequence", 0xFFFAFFFA},
+    {"digitalsignatureuid", 0x04000100},
+    {"digitizingdevicetransportdirection", 0x00182020},
+    {"dimensiondescriptionlabel", 0x00209421},
+    {"dimensionindexpointer", 0x00209165},
+    {"dimensionindexprivatecreator", 0x00209213},
+    {"dimensionindexsequence", 0x00209222},
+    {"dimensionindexvalues", 0x00209157},
+    {"dimensionorganizationsequence", 0x00209221},
+    {"dimensionorganizationtype", 0x00209311},
+    {"dimensionorganizationuid", 0x00209164},
+    {"directoryrecordsequence", 0x00041220},
+    {"directoryrecordtype", 0x00041430},
+    {"dischargedate", 0x00380030},
+    {"dischargediagnosiscodesequence", 0x00380044},
+    {"dischargediagnosisdescription", 0x00380040},
+    {"dischargetime", 0x00380032},
+    {"displaycalibrationresultsequence", 0x00287016},
+    {"displaydevicetypecodesequence", 0x00287022},
+    {"displayedareabottomrighthandcorner", 0x00700053},
+    {"displayedareabottomrighthandcornertrial", 0x00700051},
+    {"displayedareaselectionsequence", 0x0070005A},
+    {"displayedareatoplefthandcorner", 0x00700052},
+    {"displayedareatoplefthandcornertrial", 0x00700050},
+    {"displayedzvalue", 0x00182046},
+    {"displayenvironmentspatialposition", 0x00720108},
+    {"displayfilterpercentage", 0x00289411},
+    {"displayformat", 0x00005110},
+    {"displayfunctiontype", 0x00287019},
+    {"displaysethorizontaljustification", 0x00720717},
+    {"displaysetlabel", 0x00720203},
+    {"displaysetnumber", 0x00720202},
+    {"displaysetpatientorientation", 0x00720700},
+    {"displaysetpresentationgroup", 0x00720204},
+    {"displaysetpresentationgroupdescription", 0x00720206},
+    {"displaysetscrollinggroup", 0x00720212},
+    {"displaysetssequence", 0x00720200},
+    {"displaysetverticaljustification", 0x00720718},
+    {"displayshadingflag", 0x003A0246},
+    {"displaysubsystemconfigurationsequence", 0x0028700A},
+    {"displaysubsystemdescription", 0x00287005},
+    {"displaysubsystemid", 0x00287003},
+    {"displaysubsystemname", 0x00287004},
+    {"displaysubsystemqaresultssequence", 0x00287010},
+    {"displaysubsystemsequence", 0x00287023},
+    {"displaywindowlabelvector", 0x00182006},
+    {"distaldepth", 0x300A0502},
+    {"distaldepthfraction", 0x300A0501},
+    {"distancebetweenbscanslabs", 0x00221644},
+    {"distancebetweenfocalplanes", 0x00480014},
+    {"distanceobjecttotabletop", 0x00189403},
+    {"distancepupillarydistance", 0x00460060},
+    {"distancereceptorplanetodetectorhousing", 0x00189426},
+    {"distancesourcetodatacollectioncenter", 0x00189335},
+    {"distancesourcetodetector", 0x00181110},
+    {"distancesourcetoentrance", 0x00400306},
+    {"distancesourcetoisocenter", 0x00189402},
+    {"distancesourcetopatient", 0x00181111},
+    {"distancesourcetosupport", 0x00400307},
+    {"distributionaddress", 0x4008011A},
+    {"distributionname", 0x40080119},
+    {"distributiontype", 0x00120084},
+    {"dlpnotificationtrigger", 0x00189943},
+    {"documentauthoridentifiercodesequencetrial", 0x0040A068},
+    {"documentauthortrial", 0x0040A067},
+    {"documentclasscodesequence", 0x0040E008},
+    {"documentidentifiercodesequencetrial", 0x0040A066},
+    {"documentingobserveridentifiercodesequencetrial", 0x0040A076},
+    {"documentingorganizationidentifiercodesequencetrial", 0x0040A028},
+    {"documenttitle", 0x00420010},
+    {"dopplercorrectionangle", 0x00186034},
+    {"dopplersamplevolumexposition", 0x00186039},
+    {"dopplersamplevolumeyposition", 0x0018603B},
+    {"dosecalibrationfactor", 0x00541322},
+    {"dosecomment", 0x30040006},
+    {"dosegridscaling", 0x3004000E},
+    {"doseratedelivered", 0x30080048},
+    {"doserateset", 0x300A0115},
+    {"dosereferencedescription", 0x300A0016},
+    {"dosereferencenumber", 0x300A0012},
+    {"dosereferencepointcoordinates", 0x300A0018},
+    {"dosereferencesequence", 0x300A0010},
+    {"dosereferencestructuretype", 0x300A0014},
+    {"dosereferencetype", 0x300A0020},
+    {"dosereferenceuid", 0x300A0013},
+    {"dosesummationtype", 0x3004000A},
+    {"dosetype", 0x30040004},
+    {"doseunits", 0x30040002},
+    {"dosevalue", 0x30040012},
+    {"doubleexposurefielddelta", 0x0074133A},
+    {"doubleexposurefielddeltatrial", 0x0074103A},
+    {"doubleexposureflag", 0x00741034},
+    {"doubleexposuremeterset", 0x00741338},
+    {"doubleexposuremetersettrial", 0x00741038},
+    {"doubleexposureordering", 0x00741036},
+    {"doublefloatpixeldata", 0x7FE00009},
+    {"doublefloatpixelpaddingrangelimit", 0x00280125},
+    {"doublefloatpixelpaddingvalue", 0x00280123},
+    {"doublefloatrealworldvaluefirstvaluemapped", 0x00409214},
+    {"doublefloatrealworldvaluelastvaluemapped", 0x00409213},
+    {"driveprobesequence", 0x00144083},
+    {"drivetype", 0x00144081},
+    {"dvhdata", 0x30040058},
+    {"dvhdosescaling", 0x30040052},
+    {"dvhmaximumdose", 0x30040072},
+    {"dvhmeandose", 0x30040074},
+    {"dvhminimumdose", 0x30040070},
+    {"dvhnormalizationdosevalue", 0x30040042},
+    {"dvhnormalizationpoint", 0x30040040},
+    {"dvhnumberofbins", 0x30040056},
+    {"dvhreferencedroisequence", 0x30040060},
+    {"dvhroicontributiontype", 0x30040062},
+    {"dvhsequence", 0x30040050},
+    {"dvhtype", 0x30040001},
+    {"dvhvolumeunits", 0x30040054},
+    {"dynamicrange", 0x00185030},
+    {"echonumbers", 0x00180086},
+    {"echopeakposition", 0x00189298},
+    {"echoplanarpulsesequence", 0x00189018},
+    {"echopulsesequence", 0x00189008},
+    {"echotime", 0x00180081},
+    {"echotrainlength", 0x00180091},
+    {"edgepointindexlist", 0x00660024},
+    {"effectivedatetime", 0x00686226},
+    {"effectiveduration", 0x00180072},
+    {"effectiveechotime", 0x00189082},
+    {"effectiverefractiveindex", 0x00520004},
+    {"effectivewedgeangle", 0x300A00DE},
+    {"elementdimensiona", 0x00144014},
+    {"elementdimensionb", 0x00144015},
+    {"elementpitcha", 0x00144016},
+    {"elementpitchb", 0x0014401D},
+    {"elementshape", 0x00144013},
+    {"emmetropicmagnification", 0x0022000A},
+    {"emptyimageboxcielabvalue", 0x00720421},
+    {"emptyimagedensity", 0x20100110},
+    {"encapsulateddocument", 0x00420011},
+    {"encryptedattributessequence", 0x04000500},
+    {"encryptedcontent", 0x04000520},
+    {"encryptedcontenttransfersyntaxuid", 0x04000510},
+    {"endacquisitiondatetime", 0x00189517},
+    {"endcumulativemetersetweight", 0x300C0009},
+    {"endcumulativetimeweight", 0x00741408},
+    {"endingrespiratoryamplitude", 0x00209248},
+    {"endingrespiratoryphase", 0x00209249},
+    {"endmessageid", 0x00005020},
+    {"endmeterset", 0x3008007A},
+    {"energyweightingfactor", 0x00189353},
+    {"energywindowcenterline", 0x00180032},
+    {"energywindowinformationsequence", 0x00540012},
+    {"energywindowlowerlimit", 0x00540014},
+    {"energywindowname", 0x00540018},
+    {"energywindownumber", 0x00540308},
+    {"energywindowrangesequence", 0x00540013},
+    {"energywindowtotalwidth", 0x00180033},
+    {"energywindowupperlimit", 0x00540015},
+    {"energywindowvector", 0x00540010},
+    {"enhancedpalettecolorlookuptablesequence", 0x0028140B},
+    {"entrancedose", 0x00400302},
+    {"entrancedosederivation", 0x00408303},
+    {"entrancedoseinmgy", 0x00408302},
+    {"environmentalconditions", 0x00141040},
+    {"equipmentadministratorsequence", 0x00287000},
+    {"equipmentcoordinatesystemidentification", 0x00289537},
+    {"equipmentmodality", 0x00080221},
+    {"equivalentcdadocumentsequence", 0x0040A090},
+    {"equivalentcodesequence", 0x00080121},
+    {"equivalentpupilradius", 0x00460205},
+    {"erase", 0x00005190},
+    {"errorcomment", 0x00000902},
+    {"errorid", 0x00000903},
+    {"escapetriplet", 0x10000000},
+    {"estimateddosesaving", 0x00189324},
+    {"estimatedradiographicmagnificationfactor", 0x00181114},
+    {"ethicscommitteeapprovaleffectivenessenddate", 0x00120087},
+    {"ethicscommitteeapprovaleffectivenessstartdate", 0x00120086},
+    {"ethnicgroup", 0x00102160},
+    {"evaluationattempt", 0x00142008},
+    {"evaluatorname", 0x00142006},
+    {"evaluatornumber", 0x00142004},
+    {"evaluatorsequence", 0x00142002},
+    {"eventcodesequence", 0x00082135},
+    {"eventelapsedtimes", 0x00082130},
+    {"eventtimeoffset", 0x00082134},
+    {"eventtimernames", 0x00082132},
+    {"eventtimersequence", 0x00082133},
+    {"eventtypeid", 0x00001002},
+    {"examinedbodythickness", 0x00109431},
+    {"excessivefalsenegatives", 0x00240052},
+    {"excessivefalsenegativesdataflag", 0x00240051},
+    {"excessivefalsepositives", 0x00240062},
+    {"excessivefalsepositivesdataflag", 0x00240061},
+    {"excessivefixationlosses", 0x00240040},
+    {"excessivefixationlossesdataflag", 0x00240039},
+    {"excitationfrequency", 0x00144024},
+    {"excludedintervalssequence", 0x00189803},
+    {"exclusionduration", 0x00189805},
+    {"exclusionstartdatetime", 0x00189804},
+    {"exclusivecomponenttype", 0x00760036},
+    {"executionstatus", 0x21000020},
+    {"executionstatusinfo", 0x21000030},
+    {"expectedcompletiondatetime", 0x00404011},
+    {"expirydate", 0x00141020},
+    {"exposedarea", 0x00400303},
+    {"exposure", 0x00181152},
+    {"exposurecontrolmode", 0x00187060},
+    {"exposurecontrolmodedescription", 0x00187062},
+    {"exposurecontrolsensingregionleftverticaledge", 0x00189436},
+    {"exposurecontrolsensingregionlowerhorizontaledge", 0x00189439},
+    {"exposurecontrolsensingregionrightverticaledge", 0x00189437},
+    {"exposurecontrolsensingregionshape", 0x00189435},
+    {"exposurecontrolsensingregionssequence", 0x00189434},
+    {"exposurecontrolsensingregionupperhorizontaledge", 0x00189438},
+    {"exposuredosesequence", 0x0040030E},
+    {"exposureindex", 0x00181411},
+    {"exposureinmas", 0x00189332},
+    {"exposureinuas", 0x00181153},
+    {"exposuremodulationtype", 0x00189323},
+    {"exposuresequence", 0x30020030},
+    {"exposuresondetectorsincelastcalibration", 0x00187010},
+    {"exposuresondetectorsincemanufactured", 0x00187011},
+    {"exposuresonplate", 0x00181404},
+    {"exposurestatus", 0x00187064},
+    {"exposuretime", 0x00181150},
+    {"exposuretimeinms", 0x00189328},
+    {"exposuretimeinus", 0x00188150},
+    {"extendedcodemeaning", 0x00080108},
+    {"extendedcodevalue", 0x00080101},
+    {"extendeddepthoffield", 0x00480012},
+    {"externalcontourentrypoint", 0x300A0133},
+    {"facetsequence", 0x00660034},
+    {"failedattributessequence", 0x00741048},
+    {"failedsopinstanceuidlist", 0x00080058},
+    {"failedsopsequence", 0x00081198},
+    {"failureattributes", 0x2200000E},
+    {"failurereason", 0x00081197},
+    {"falsenegativesestimate", 0x00240046},
+    {"falsenegativesestimateflag", 0x00240045},
+    {"falsenegativesquantity", 0x00240050},
+    {"falsepositivesestimate", 0x00240054},
+    {"falsepositivesestimateflag", 0x00240053},
+    {"falsepositivesquantity", 0x00240060},
+    {"fiducialdescription", 0x0070030F},
+    {"fiducialidentifier", 0x00700310},
+    {"fiducialidentifiercodesequence", 0x00700311},
+    {"fiducialsequence", 0x0070031E},
+    {"fiducialsetsequence", 0x0070031C},
+    {"fiducialspropertycategorycodesequence", 0x0070031F},
+    {"fiducialuid", 0x0070031A},
+    {"fieldofviewdescription", 0x00189433},
+    {"fieldofviewdimensions", 0x00181149},
+    {"fieldofviewdimensionsinfloat", 0x00189461},
+    {"fieldofviewhorizontalflip", 0x00187034},
+    {"fieldofvieworigin", 0x00187030},
+    {"fieldofviewrotation", 0x00187032},
+    {"fieldofviewsequence", 0x00189432},
+    {"fieldofviewshape", 0x00181147},
+    {"filemetainformationgrouplength", 0x00020000},
+    {"filemetainformationversion", 0x00020001},
+    {"filesetconsistencyflag", 0x00041212},
+    {"filesetdescriptorfileid", 0x00041141},
+    {"filesetid", 0x00041130},
+    {"fillerordernumberimagingservicerequest", 0x00402017},
+    {"fillerordernumberprocedure", 0x00401007},
+    {"fillmode", 0x00700257},
+    {"fillpattern", 0x00700256},
+    {"fillstylesequence", 0x00700233},
+    {"filmboxcontentsequence", 0x21300030},
+    {"filmconsumptionsequence", 0x00400321},
+    {"filmdestination", 0x20000040},
+    {"filmorientation", 0x20100040},
+    {"filmsessionlabel", 0x20000050},
+    {"filmsizeid", 0x20100050},
+    {"filterbeampathlengthmaximum", 0x00187058},
+    {"filterbeampathlengthminimum", 0x00187056},
+    {"filterbyattributepresence", 0x00720404},
+    {"filterbycategory", 0x00720402},
+    {"filterbyoperator", 0x00720406},
+    {"filterhighfrequency", 0x003A0221},
+    {"filterlowfrequency", 0x003A0220},
+    {"filtermaterial", 0x00187050},
+    {"filtermaterialusedingaincalibration", 0x00143074},
+    {"filteroperationssequence", 0x00720400},
+    {"filterthicknessmaximum", 0x00187054},
+    {"filterthicknessminimum", 0x00187052},
+    {"filterthicknessusedingaincalibration", 0x00143075},
+    {"filtertype", 0x00181160},
+    {"finalcumulativemetersetweight", 0x300A010E},
+    {"finalcumulativetimeweight", 0x300A02C8},
+    {"findingsflagtrial", 0x0040A007},
+    {"findingsgrouprecordingdatetrial", 0x0040A023},
+    {"findingsgrouprecordingtimetrial", 0x0040A024},
+    {"findingsgroupuidtrial", 0x0040A021},
+    {"findingssequencetrial", 0x0040A020},
+    {"findingssourcecategorycodesequencetrial", 0x0040A026},
+    {"findlocation", 0x00000400},
+    {"finitevolume", 0x0066000E},
+    {"firstalinelocation", 0x00520034},
+    {"firstorderphasecorrection", 0x00189198},
+    {"firstorderphasecorrectionangle", 0x56000010},
+    {"firsttreatmentdate", 0x30080054},
+    {"fixationcheckedquantity", 0x00240035},
+    {"fixationdevicedescription", 0x300A0196},
+    {"fixationdevicelabel", 0x300A0194},
+    {"fixationdevicepitchangle", 0x300A0199},
+    {"fixationdeviceposition", 0x300A0198},
+    {"fixationdevicerollangle", 0x300A019A},
+    {"fixationdevicesequence", 0x300A0190},
+    {"fixationdevicetype", 0x300A0192},
+    {"fixationeye", 0x300A0150},
+    {"fixationlightazimuthalangle", 0x300A0356},
+    {"fixationlightazimuthalangletolerance", 0x300A0154},
+    {"fixationlightpolarangle", 0x300A0358},
+    {"fixationlightpolarangletolerance", 0x300A0155},
+    {"fixationmethodcodesequence", 0x006863AC},
+    {"fixationmonitoringcodesequence", 0x00240033},
+    {"fixationsequence", 0x00240032},
+    {"flatkeratometricaxissequence", 0x00460080},
+    {"flipangle", 0x00181314},
+    {"floatingpointvalue", 0x0040A161},
+    {"floatingpointvalues", 0x00660125},
+    {"floatpixeldata", 0x7FE00008},
+    {"floatpixelpaddingrangelimit", 0x00280124},
+    {"floatpixelpaddingvalue", 0x00280122},
+    {"flowcompensation", 0x00189010},
+    {"flowcompensationdirection", 0x00189183},
+    {"fluencedatascale", 0x30020042},
+    {"fluencedatasource", 0x30020041},
+    {"fluencemapsequence", 0x30020040},
+    {"fluencemode", 0x30020051},
+    {"fluencemodeid", 0x30020052},
+    {"fluoroscopyflag", 0x00189334},
+    {"focaldistance", 0x00181182},
+    {"focalspots", 0x00181190},
+    {"focusdepth", 0x00185012},
+    {"focusmethod", 0x00480011},
+    {"fontname", 0x00700227},
+    {"fontnametype", 0x00700228},
+    {"fovealpointnormativedataflag", 0x00240117},
+    {"fovealpointprobabilityvalue", 0x00240118},
+    {"fovealsensitivity", 0x00240087},
+    {"fovealsensitivitymeasured", 0x00240086},
+    {"fractionalchanneldisplayscale", 0x003A0247},
+    {"fractiongroupdescription", 0x300A0072},
+    {"fractiongroupnumber", 0x300A0071},
+    {"fractiongroupsequence", 0x300A0070},
+    {"fractiongroupsummarysequence", 0x30080220},
+    {"fractiongrouptype", 0x30080224},
+    {"fractionnumber", 0x30020029},
+    {"fractionpattern", 0x300A007B},
+    {"fractionstatussummarysequence", 0x30080240},
+    {"frameacquisitiondatetime", 0x00189074},
+    {"frameacquisitionduration", 0x00189220},
+    {"frameacquisitionnumber", 0x00209156},
+    {"frameacquisitionsequence", 0x00189417},
+    {"frameanatomysequence", 0x00209071},
+    {"framecomments", 0x00209158},
+    {"framecontentsequence", 0x00209111},
+    {"framedelay", 0x00181066},
+    {"framedetectorparameterssequence", 0x00189451},
+    {"framedimensionpointer", 0x0028000A},
+    {"framedisplaysequence", 0x00089458},
+    {"framedisplayshuttersequence", 0x00189472},
+    {"frameextractionsequence", 0x00081164},
+    {"frameincrementpointer", 0x00280009},
+    {"framelabel", 0x00209453},
+    {"framelabelvector", 0x00182002},
+    {"framelaterality", 0x00209072},
+    {"framenumbersofinterest", 0x00286020},
+    {"frameofinterestdescription", 0x00286022},
+    {"frameofinteresttype", 0x00286023},
+    {"frameofreferencerelationshipsequence", 0x300600C0},
+    {"frameofreferencetodisplayedcoordinatesystemtransformationmatrix", 0x0070030B},
+    {"frameofreferencetransformationcomment", 0x300600C8},
+    {"frameofreferencetransformationmatrix", 0x300600C6},
+    {"frameofreferencetransformationmatrixtype", 0x0070030C},
+    {"frameofreferencetransformationtype", 0x300600C4},
+    {"frameofreferenceuid", 0x00200052},
+    {"framepixeldatapropertiessequence", 0x00289443},
+    {"framepixelshiftsequence", 0x00289415},
+    {"frameprimaryanglevector", 0x00182003},
+    {"framereferencedatetime", 0x00189151},
+    {"framereferencetime", 0x00541300},
+    {"framesecondaryanglevector", 0x00182004},
+    {"frametime", 0x00181063},
+    {"frametimevector", 0x00181065},
+    {"frametype", 0x00089007},
+    {"framevoilutsequence", 0x00289132},
+    {"frequencycorrection", 0x00189101},
+    {"functionalgrouppointer", 0x00209167},
+    {"functionalgroupprivatecreator", 0x00209238},
+    {"functionalmrsequence", 0x00189621},
+    {"functionalsettlingphaseframespresent", 0x00189622},
+    {"functionalsyncpulse", 0x00189623},
+    {"gaincorrectionreferencesequence", 0x00143060},
+    {"gammavalue", 0x0028701A},
+    {"gantryangle", 0x300A011E},
+    {"gantryangletolerance", 0x300A0044},
+    {"gantrydetectorslew", 0x00181121},
+    {"gantrydetectortilt", 0x00181120},
+    {"gantryid", 0x00181008},
+    {"gantrymotioncorrected", 0x00189762},
+    {"gantrypitchangle", 0x300A014A},
+    {"gantrypitchangletolerance", 0x300A014E},
+    {"gantrypitchrotationdirection", 0x300A014C},
+    {"gantryrotationdirection", 0x300A011F},
+    {"gantrytype", 0x40101008},
+    {"gaplength", 0x00700261},
+    {"gatedinformationsequence", 0x00540062},
+    {"gatesettingssequence", 0x00144060},
+    {"gatethreshold", 0x00144062},
+    {"generalaccessorydescription", 0x300A0422},
+    {"generalaccessoryid", 0x300A0421},
+    {"generalaccessorynumber", 0x300A0424},
+    {"generalaccessorysequence", 0x300A0420},
+    {"generalaccessorytype", 0x300A0423},
+    {"generalizeddefectcorrectedsensitivitydeviationflag", 0x00240102},
+    {"generalizeddefectcorrectedsensitivitydeviationprobabilityvalue", 0x00240104},
+    {"generalizeddefectcorrectedsensitivitydeviationvalue", 0x00240103},
+    {"generalizeddefectsensitivitydeviationalgorithmsequence", 0x00240067},
+    {"generalmachineverificationsequence", 0x00741042},
+    {"generalpurposeperformedprocedurestepstatus", 0x00404002},
+    {"generalpurposescheduledproceduresteppriority", 0x00404003},
+    {"generalpurposescheduledprocedurestepstatus", 0x00404001},
+    {"generatorid", 0x00181005},
+    {"generatorpower", 0x00181170},
+    {"geneticmodificationscodesequence", 0x00100229},
+    {"geneticmodificationsdescription", 0x00100222},
+    {"geneticmodificationsnomenclature", 0x00100223},
+    {"geneticmodificationssequence", 0x00100221},
+    {"geometricalproperties", 0x00289444},
+    {"geometricmaximumdistortion", 0x00289445},
+    {"geometryfordisplay", 0x00701B08},
+    {"geometryofkspacetraversal", 0x00189032},
+    {"globalcrop", 0x0070120B},
+    {"globalcroppingspecificationindex", 0x0070120C},
+    {"globaldeviationfromnormal", 0x00240066},
+    {"globaldeviationprobability", 0x00240071},
+    {"globaldeviationprobabilitynormalsflag", 0x00240059},
+    {"globaldeviationprobabilitysequence", 0x00240083},
+    {"gradientechotrainlength", 0x00189241},
+    {"gradientoutput", 0x00189182},
+    {"gradientoutputtype", 0x00189180},
+    {"graphicannotationsequence", 0x00700001},
+    {"graphicannotationunits", 0x00700005},
+    {"graphiccoordinatesdatasequence", 0x00700318},
+    {"graphicdata", 0x00700022},
+    {"graphicdimensions", 0x00700020},
+    {"graphicfilled", 0x00700024},
+    {"graphicgroupdescription", 0x00700208},
+    {"graphicgroupid", 0x00700295},
+    {"graphicgrouplabel", 0x00700207},
+    {"graphicgroupsequence", 0x00700234},
+    {"graphiclayer", 0x00700002},
+    {"graphiclayerdescription", 0x00700068},
+    {"graphiclayerorder", 0x00700062},
+    {"graphiclayerrecommendeddisplaycielabvalue", 0x00700401},
+    {"graphiclayerrecommendeddisplaygrayscalevalue", 0x00700066},
+    {"graphiclayerrecommendeddisplayrgbvalue", 0x00700067},
+    {"graphiclayersequence", 0x00700060},
+    {"graphicobjectsequence", 0x00700009},
+    {"graphictype", 0x00700023},
+    {"graylookuptabledata", 0x00281200},
+    {"graylookuptabledescriptor", 0x00281100},
+    {"grayscale", 0x00281080},
+    {"greenpalettecolorlookuptabledata", 0x00281202},
+    {"greenpalettecolorlookuptabledescriptor", 0x00281102},
+    {"grid", 0x00181166},
+    {"gridabsorbingmaterial", 0x00187040},
+    {"gridaspectratio", 0x00187046},
+    {"griddimensions", 0x00640007},
+    {"gridfocaldistance", 0x0018704C},
+    {"gridframeoffsetvector", 0x3004000C},
+    {"gridid", 0x00181006},
+    {"gridperiod", 0x00187048},
+    {"gridpitch", 0x00187044},
+    {"gridresolution", 0x00640008},
+    {"gridspacingmaterial", 0x00187041},
+    {"gridthickness", 0x00187042},
+    {"groupofpatientsidentificationsequence", 0x00100027},
+    {"halfvaluelayer", 0x00400314},
+    {"hangingprotocolcreationdatetime", 0x0072000A},
+    {"hangingprotocolcreator", 0x00720008},
+    {"hangingprotocoldefinitionsequence", 0x0072000C},
+    {"hangingprotocoldescription", 0x00720004},
+    {"hangingprotocollevel", 0x00720006},
+    {"hangingprotocolname", 0x00720002},
+    {"hangingprotocolusergroupname", 0x00720010},
+    {"hangingprotocoluseridentificationcodesequence", 0x0072000E},
+    {"hardcopycreationdeviceid", 0x00181011},
+    {"hardcopydevicemanufacturer", 0x00181017},
+    {"hardcopydevicemanufacturermodelname", 0x0018101B},
+    {"hardcopydevicesoftwareversion", 0x0018101A},
+    {"headfixationangle", 0x300A0148},
+    {"headfixationangletolerance", 0x300A0152},
+    {"heartrate", 0x00181088},
+    {"highbit", 0x00280102},
+    {"highdosetechniquetype", 0x300A00C7},
+    {"highenergydetectors", 0x40100002},
+    {"highrrvalue", 0x00181082},
+    {"histogrambinwidth", 0x00603008},
+    {"histogramdata", 0x00603020},
+    {"histogramexplanation", 0x00603010},
+    {"histogramfirstbinvalue", 0x00603004},
+    {"histogramlastbinvalue", 0x00603006},
+    {"histogramnumberofbins", 0x00603002},
+    {"histogramsequence", 0x00603000},
+    {"hl7documenteffectivetime", 0x0040E004},
+    {"hl7documenttypecodesequence", 0x0040E006},
+    {"hl7instanceidentifier", 0x0040E001},
+    {"hl7structureddocumentreferencesequence", 0x0040A390},
+    {"homecommunityid", 0x0040E031},
+    {"horizontalalignment", 0x00700242},
+    {"horizontalfieldofview", 0x0022000C},
+    {"horizontaloffsetofsensor", 0x00143024},
+    {"horizontalprismbase", 0x00460032},
+    {"horizontalprismpower", 0x00460030},
+    {"hpglcontourpennumber", 0x00686310},
+    {"hpgldocument", 0x00686300},
+    {"hpgldocumentid", 0x006862D0},
+    {"hpgldocumentlabel", 0x006862D5},
+    {"hpgldocumentscaling", 0x006862F2},
+    {"hpgldocumentsequence", 0x006862C0},
+    {"hpglpendescription", 0x00686345},
+    {"hpglpenlabel", 0x00686340},
+    {"hpglpennumber", 0x00686330},
+    {"hpglpensequence", 0x00686320},
+    {"huffmantablesize", 0x10000002},
+    {"huffmantabletriplet", 0x10000003},
+    {"humanperformercodesequence", 0x00404009},
+    {"humanperformername", 0x00404037},
+    {"humanperformerorganization", 0x00404036},
+    {"iccprofile", 0x00282000},
+    {"iconimagesequence", 0x00880200},
+    {"identicaldocumentssequence", 0x0040A525},
+    {"identificationdescriptiontrial", 0x0040A224},
+    {"identifiercodesequencetrial", 0x0040A070},
+    {"identifiertypecode", 0x00400035},
+    {"identifyingcomments", 0x00084000},
+    {"identifyingprivateelements", 0x00080306},
+    {"illumination", 0x2010015E},
+    {"illuminationbandwidth", 0x00220057},
+    {"illuminationcolorcodesequence", 0x00480108},
+    {"illuminationpower", 0x00220056},
+    {"illuminationtypecodesequence", 0x00220016},
+    {"illuminationwavelength", 0x00220055},
+    {"illuminatortypecodesequence", 0x00480100},
+    {"imageandfluoroscopyareadoseproduct", 0x0018115E},
+    {"imageboxcontentsequence", 0x21300040},
+    {"imageboxessequence", 0x00720300},
+    {"imageboxlargescrollamount", 0x00720318},
+    {"imageboxlargescrolltype", 0x00720316},
+    {"imageboxlayouttype", 0x00720304},
+    {"imageboxnumber", 0x00720302},
+    {"imageboxoverlappriority", 0x00720320},
+    {"imageboxposition", 0x20200010},
+    {"imageboxpresentationlutflag", 0x2000006A},
+    {"imageboxscrolldirection", 0x00720310},
+    {"imageboxsmallscrollamount", 0x00720314},
+    {"imageboxsmallscrolltype", 0x00720312},
+    {"imageboxsynchronizationsequence", 0x00720430},
+    {"imageboxtilehorizontaldimension", 0x00720306},
+    {"imageboxtileverticaldimension", 0x00720308},
+    {"imagecenterpointcoordinatessequence", 0x0040071A},
+    {"imagecomments", 0x00204000},
+    {"imagedatalocation", 0x00280808},
+    {"imagedatatypesequence", 0x00189807},
+    {"imagedimensions", 0x00280005},
+    {"imagedisplayformat", 0x20100010},
+    {"imagednucleus", 0x00180085},
+    {"imagedvolumedepth", 0x00480003},
+    {"imagedvolumeheight", 0x00480002},
+    {"imagedvolumewidth", 0x00480001},
+    {"imagefilter", 0x00189320},
+    {"imagefilterdescription", 0x00189941},
+    {"imageformat", 0x00280040},
+    {"imageframeorigin", 0x60000051},
+    {"imagegeometrytype", 0x00200070},
+    {"imagehorizontalflip", 0x00700041},
+    {"imageid", 0x00540400},
+    {"imageindex", 0x00541330},
+    {"imagelaterality", 0x00200062},
+    {"imagelocation", 0x00280200},
+    {"imageorientation", 0x00200035},
+    {"imageorientationpatient", 0x00200037},
+    {"imageorientationslide", 0x00480102},
+    {"imageorientationvolume", 0x00209302},
+    {"imageoverlayboxcontentsequence", 0x21300060},
+    {"imageoverlayflag", 0x20000067},
+    {"imagepathfilterpassband", 0x00220004},
+    {"imagepathfilterpassthroughwavelength", 0x00220003},
+    {"imagepathfiltertypestackcodesequence", 0x00220018},
+    {"imageplanepixelspacing", 0x30020011},
+    {"imageposition", 0x00200030},
+    {"imagepositionpatient", 0x00200032},
+    {"imagepositionvolume", 0x00209301},
+    {"imagepresentationcomments", 0x00284000},
+    {"imageprocessingapplied", 0x00289446},
+    {"imagequalityindicatormaterial", 0x001440A1},
+    {"imagequalityindicatorsize", 0x001440A2},
+    {"imagequalityindicatortype", 0x001440A0},
+    {"imagerotation", 0x00700042},
+    {"imagerpixelspacing", 0x00181164},
+    {"imagescalerepresentation", 0x40101075},
+    {"imagesetlabel", 0x00720040},
+    {"imagesetnumber", 0x00720032},
+    {"imagesetselectorcategory", 0x00720034},
+    {"imagesetselectorsequence", 0x00720022},
+    {"imagesetselectorusageflag", 0x00720024},
+    {"imagesetssequence", 0x00720020},
+    {"imagesinacquisition", 0x00201002},
+    {"imagesinseries", 0x00201003},
+    {"imagesinstudy", 0x00201005},
+    {"imagetoequipmentmappingmatrix", 0x00289520},
+    {"imagetransformationmatrix", 0x00185210},
+    {"imagetranslationvector", 0x00185212},
+    {"imagetriggerdelay", 0x00181067},
+    {"imagetype", 0x00080008},
+    {"imagevolumegeometry", 0x00701208},
+    {"imagingdevicespecificacquisitionparameters", 0x300A00CC},
+    {"imagingfrequency", 0x00180084},
+    {"imagingservicerequestcomments", 0x00402400},
+    {"implantassemblytemplateissuer", 0x00760003},
+    {"implantassemblytemplatename", 0x00760001},
+    {"implantassemblytemplatetargetanatomysequence", 0x00760010},
+    {"implantassemblytemplatetype", 0x0076000A},
+    {"implantassemblytemplateversion", 0x00760006},
+    {"implantname", 0x00221095},
+    {"implantpartnumber", 0x00221097},
+    {"implantregulatorydisapprovalcodesequence", 0x006862A0},
+    {"implantsize", 0x00686210},
+    {"implanttargetanatomysequence", 0x00686230},
+    {"implanttemplate3dmodelsurfacenumber", 0x00686350},
+    {"implanttemplategroupdescription", 0x00780010},
+    {"implanttemplategroupissuer", 0x00780020},
+    {"implanttemplategroupmemberid", 0x0078002E},
+    {"implanttemplategroupmembermatching2dcoordinatessequence", 0x00780070},
+    {"implanttemplategroupmemberssequence", 0x0078002A},
+    {"implanttemplategroupname", 0x00780001},
+    {"implanttemplategrouptargetanatomysequence", 0x00780028},
+    {"implanttemplategroupvariationdimensionname", 0x007800B2},
+    {"implanttemplategroupvariationdimensionrank", 0x007800B8},
+    {"implanttemplategroupvariationdimensionranksequence", 0x007800B4},
+    {"implanttemplategroupvariationdimensionsequence", 0x007800B0},
+    {"implanttemplategroupversion", 0x00780024},
+    {"implanttemplateversion", 0x00686221},
+    {"implanttype", 0x00686223},
+    {"implanttypecodesequence", 0x006863A8},
+    {"implementationclassuid", 0x00020012},
+    {"implementationversionname", 0x00020013},
+    {"impressions", 0x40080300},
+    {"inboundarrivaltype", 0x40101056},
+    {"incidentangle", 0x00144052},
+    {"includedisplayapplication", 0x22000009},
+    {"includenondicomobjects", 0x22000008},
+    {"inconcatenationnumber", 0x00209162},
+    {"inconcatenationtotalnumber", 0x00209163},
+    {"indexnormalsflag", 0x00240338},
+    {"indexprobability", 0x00240341},
+    {"indexprobabilitysequence", 0x00240344},
+    {"indicationdescription", 0x00142018},
+    {"indicationdisposition", 0x0014201C},
+    {"indicationlabel", 0x00142016},
+    {"indicationnumber", 0x00142014},
+    {"indicationphysicalpropertysequence", 0x00142030},
+    {"indicationroisequence", 0x0014201E},
+    {"indicationsequence", 0x00142012},
+    {"indicationtype", 0x0014201A},
+    {"informationfrommanufacturersequence", 0x00686260},
+    {"informationissuedatetime", 0x00686270},
+    {"informationsummary", 0x00686280},
+    {"initialcinerunstate", 0x00180042},
+    {"initiator", 0x00000200},
+    {"innerdiameter", 0x00140056},
+    {"inplanephaseencodingdirection", 0x00181312},
+    {"inputavailabilityflag", 0x00404020},
+    {"inputinformationsequence", 0x00404021},
+    {"inputreadinessstate", 0x00404041},
+    {"inputsequencepositionindex", 0x00701203},
+    {"inspectionselectioncriteria", 0x4010107C},
+    {"instackpositionnumber", 0x00209057},
+    {"instanceavailability", 0x00080056},
+    {"instancecoerciondatetime", 0x00080015},
+    {"instancecreationdate", 0x00080012},
+    {"instancecreationtime", 0x00080013},
+    {"instancecreatoruid", 0x00080014},
+    {"instancenumber", 0x00200013},
+    {"institutionaddress", 0x00080081},
+    {"institutionaldepartmentname", 0x00081040},
+    {"institutioncodesequence", 0x00080082},
+    {"institutionname", 0x00080080},
+    {"instructiondescription", 0x00189917},
+    {"instructionindex", 0x00189915},
+    {"instructionperformancecomment", 0x0018991A},
+    {"instructionperformeddatetime", 0x00189919},
+    {"instructionperformedflag", 0x00189918},
+    {"instructionsequence", 0x00189914},
+    {"instructiontext", 0x00189916},
+    {"insuranceplanidentification", 0x00101050},
+    {"intendedrecipientsofresultsidentificationsequence", 0x00401011},
+    {"intensifieractivedimensions", 0x00189428},
+    {"intensifieractiveshape", 0x00189427},
+    {"intensifiersize", 0x00181162},
+    {"intermarkerdistance", 0x00500019},
+    {"intermediatepupillarydistance", 0x00460063},
+    {"internaldetectorframetime", 0x00143011},
+    {"internationalroutesegment", 0x40101028},
+    {"interpolationtype", 0x00520039},
+    {"interpretationapprovaldate", 0x40080112},
+    {"interpretationapprovaltime", 0x40080113},
+    {"interpretationapproversequence", 0x40080111},
+    {"interpretationauthor", 0x4008010C},
+    {"interpretationdiagnosiscodesequence", 0x40080117},
+    {"interpretationdiagnosisdescription", 0x40080115},
+    {"interpretationid", 0x40080200},
+    {"interpretationidissuer", 0x40080202},
+    {"interpretationrecordeddate", 0x40080100},
+    {"interpretationrecordedtime", 0x40080101},
+    {"interpretationrecorder", 0x40080102},
+    {"interpretationstatusid", 0x40080212},
+    {"interpretationtext", 0x4008010B},
+    {"interpretationtranscriber", 0x4008010A},
+    {"interpretationtranscriptiondate", 0x40080108},
+    {"interpretationtranscriptiontime", 0x40080109},
+    {"interpretationtypeid", 0x40080210},
+    {"intervalnumber", 0x00200016},
+    {"intervalsacquired", 0x00181083},
+    {"intervalsrejected", 0x00181084},
+    {"interventiondescription", 0x0018003A},
+    {"interventiondrugcodesequence", 0x00180029},
+    {"interventiondrugdose", 0x00180028},
+    {"interventiondruginformationsequence", 0x00180026},
+    {"interventiondrugname", 0x00180034},
+    {"interventiondrugstarttime", 0x00180035},
+    {"interventiondrugstoptime", 0x00180027},
+    {"interventionsequence", 0x00180036},
+    {"interventionstatus", 0x00180038},
+    {"intraocularlenscalculationslefteyesequence", 0x00221310},
+    {"intraocularlenscalculationsrighteyesequence", 0x00221300},
+    {"intraocularpressure", 0x0022000B},
+    {"intravascularframecontentsequence", 0x00520027},
+    {"intravascularlongitudinaldistance", 0x00520028},
+    {"intravascularoctframecontentsequence", 0x00520029},
+    {"intravascularoctframetypesequence", 0x00520025},
+    {"inversionrecovery", 0x00189009},
+    {"inversiontime", 0x00180082},
+    {"inversiontimes", 0x00189079},
+    {"iolformulacodesequence", 0x00221028},
+    {"iolformuladetail", 0x00221029},
+    {"iolmanufacturer", 0x00221093},
+    {"iolpower", 0x00221053},
+    {"iolpowerforexactemmetropia", 0x00221121},
+    {"iolpowerforexacttargetrefraction", 0x00221122},
+    {"iolpowersequence", 0x00221090},
+    {"ionbeamlimitingdevicesequence", 0x300A03A4},
+    {"ionbeamsequence", 0x300A03A2},
+    {"ionblocksequence", 0x300A03A6},
+    {"ioncontrolpointdeliverysequence", 0x30080041},
+    {"ioncontrolpointsequence", 0x300A03A8},
+    {"ioncontrolpointverificationsequence", 0x0074104E},
+    {"ionmachineverificationsequence", 0x00741046},
+    {"ionrangecompensatorsequence", 0x300A02EA},
+    {"iontolerancetablesequence", 0x300A03A0},
+    {"ionwedgepositionsequence", 0x300A03AC},
+    {"ionwedgesequence", 0x300A03AA},
+    {"irradiationeventidentificationsequence", 0x00189477},
+    {"irradiationeventuid", 0x00083010},
+    {"isocenterposition", 0x300A012C},
+    {"isocenterreferencesystemsequence", 0x00189462},
+    {"isocentertobeamlimitingdevicedistance", 0x300A00BB},
+    {"isocentertoblocktraydistance", 0x300A00F7},
+    {"isocentertocompensatordistances", 0x300A02E6},
+    {"isocentertocompensatortraydistance", 0x300A02E4},
+    {"isocentertolateralspreadingdevicedistance", 0x300A0374},
+    {"isocentertorangemodulatordistance", 0x300A038A},
+    {"isocentertorangeshifterdistance", 0x300A0364},
+    {"isocentertowedgetraydistance", 0x300A00D9},
+    {"isotopenumber", 0x00200014},
+    {"issuedateofimagingservicerequest", 0x00402004},
+    {"issuerofaccessionnumbersequence", 0x00080051},
+    {"issuerofadmissionid", 0x00380011},
+    {"issuerofadmissionidsequence", 0x00380014},
+    {"issuerofpatientid", 0x00100021},
+    {"issuerofpatientidqualifierssequence", 0x00100024},
+    {"issuerofserviceepisodeid", 0x00380061},
+    {"issuerofserviceepisodeidsequence", 0x00380064},
+    {"issuerofthecontaineridentifiersequence", 0x00400513},
+    {"issuerofthespecimenidentifiersequence", 0x00400562},
+    {"issuetimeofimagingservicerequest", 0x00402005},
+    {"italic", 0x00700250},
+    {"item", 0xFFFEE000},
+    {"itemdelimitationitem", 0xFFFEE00D},
+    {"itemnumber", 0x00200019},
+    {"iterativereconstructionmethod", 0x00189769},
+    {"itineraryid", 0x40101051},
+    {"itineraryidassigningauthority", 0x40101053},
+    {"itineraryidtype", 0x40101052},
+    {"ivusacquisition", 0x00183100},
+    {"ivusgatedrate", 0x00183102},
+    {"ivuspullbackrate", 0x00183101},
+    {"ivuspullbackstartframenumber", 0x00183103},
+    {"ivuspullbackstopframenumber", 0x00183104},
+    {"keratoconuspredictionindex", 0x00460236},
+    {"keratometerindex", 0x00221033},
+    {"keratometricaxis", 0x00460077},
+    {"keratometricpower", 0x00460076},
+    {"keratometrylefteyesequence", 0x00460071},
+    {"keratometrymeasurementtypecodesequence", 0x00221096},
+    {"keratometryrighteyesequence", 0x00460070},
+    {"kspacefiltering", 0x00189064},
+    {"kvp", 0x00180060},
+    {"kvusedingaincalibration", 0x00143071},
+    {"labelstyleselection", 0x22000003},
+    {"labeltext", 0x22000002},
+    {"labelusinginformationextractedfrominstances", 0x22000001},
+    {"languagecodesequence", 0x00080006},
+    {"languagecodesequencetrial", 0x0040A744},
+    {"largebluepalettecolorlookuptabledata", 0x00281213},
+    {"largebluepalettecolorlookuptabledescriptor", 0x00281113},
+    {"largegreenpalettecolorlookuptabledata", 0x00281212},
+    {"largegreenpalettecolorlookuptabledescriptor", 0x00281112},
+    {"largepalettecolorlookuptableuid", 0x00281214},
+    {"largeredpalettecolorlookuptabledata", 0x00281211},
+    {"largeredpalettecolorlookuptabledescriptor", 0x00281111},
+    {"largestimagepixelvalue", 0x00280107},
+    {"largestimagepixelvalueinplane", 0x00280111},
+    {"largestmonochromepixelvalue", 0x00289099},
+    {"largestpixelvalueinseries", 0x00280109},
+    {"largestvalidpixelvalue", 0x00280105},
+    {"lastmenstrualdate", 0x001021D0},
+    {"laterality", 0x00200060},
+    {"lateralspreadingdevicedescription", 0x300A033A},
+    {"lateralspreadingdeviceid", 0x300A0336},
+    {"lateralspreadingdevicenumber", 0x300A0334},
+    {"lateralspreadingdevicesequence", 0x300A0332},
+    {"lateralspreadingdevicesetting", 0x300A0372},
+    {"lateralspreadingdevicesettingssequence", 0x300A0370},
+    {"lateralspreadingdevicetype", 0x300A0338},
+    {"lateralspreadingdevicewaterequivalentthickness", 0x300A033C},
+    {"leafjawpositions", 0x300A011C},
+    {"leafpositionboundaries", 0x300A00BE},
+    {"leftimagesequence", 0x00220021},
+    {"leftlenssequence", 0x00460015},
+    {"lengthtoend", 0x00080001},
+    {"lensconstantdescription", 0x00221094},
+    {"lensconstantsequence", 0x00221092},
+    {"lensdescription", 0x00460012},
+    {"lensescodesequence", 0x00220019},
+    {"lenssegmenttype", 0x00460038},
+    {"lensstatuscodesequence", 0x00221024},
+    {"lensstatusdescription", 0x00221065},
+    {"lensthickness", 0x00221130},
+    {"lensthicknesssequence", 0x00221127},
+    {"lesionnumber", 0x00183105},
+    {"lightdirection", 0x00701703},
+    {"lightpathfilterpassband", 0x00220002},
+    {"lightpathfilterpassthroughwavelength", 0x00220001},
+    {"lightpathfiltertypestackcodesequence", 0x00220017},
+    {"linacenergy", 0x00145002},
+    {"linacoutput", 0x00145004},
+    {"linedashingstyle", 0x00700254},
+    {"linepattern", 0x00700255},
+    {"linesequence", 0x00660028},
+    {"linestylesequence", 0x00700232},
+    {"linethickness", 0x00700253},
+    {"listofmimetypes", 0x00420014},
+    {"localdeviationprobabilitynormalsflag", 0x00240072},
+    {"localizeddeviationfromnormal", 0x00240068},
+    {"localizeddeviationprobability", 0x00240073},
+    {"localizeddeviationprobabilitysequence", 0x00240085},
+    {"localizingcursorposition", 0x00182043},
+    {"localnamespaceentityid", 0x00400031},
+    {"location", 0x00200050},
+    {"locationofmeasuredbeamdiameter", 0x00144019},
+    {"longcodevalue", 0x00080119},
+    {"longedgepointindexlist", 0x00660042},
+    {"longitudinaltemporaleventtype", 0x00120053},
+    {"longitudinaltemporalinformationmodified", 0x00280303},
+    {"longitudinaltemporaloffsetfromevent", 0x00120052},
+    {"longprimitivepointindexlist", 0x00660040},
+    {"longtrianglepointindexlist", 0x00660041},
+    {"longvertexpointindexlist", 0x00660043},
+    {"lossyimagecompression", 0x00282110},
+    {"lossyimagecompressionmethod", 0x00282114},
+    {"lossyimagecompressionratio", 0x00282112},
+    {"lowenergydetectors", 0x40100001},
+    {"lowrrvalue", 0x00181081},
+    {"luminancecharacteristicsid", 0x00287009},
+    {"luminanceresponsedescription", 0x00287020},
+    {"luminanceresponsesequence", 0x0028701C},
+    {"luminanceresultsequence", 0x00287024},
+    {"luminanceuniformityresultsequence", 0x00287027},
+    {"luminancevalue", 0x0028701F},
+    {"lutdata", 0x00283006},
+    {"lutdescriptor", 0x00283002},
+    {"lutexplanation", 0x00283003},
+    {"lutframerange", 0x00289507},
+    {"lutfunction", 0x00289474},
+    {"lutlabel", 0x00409210},
+    {"lutnumber", 0x00200026},
+    {"mac", 0x04000404},
+    {"macalgorithm", 0x04000015},
+    {"maccalculationtransfersyntaxuid", 0x04000010},
+    {"macidnumber", 0x04000005},
+    {"macparameterssequence", 0x4FFE0001},
+    {"magneticfieldstrength", 0x00180087},
+    {"magnetizationtransfer", 0x00189020},
+    {"magnificationtype", 0x20100060},
+    {"magnifytonumberofcolumns", 0x20400074},
+    {"mainlobeangle", 0x00145103},
+    {"mainroofangle", 0x00145104},
+    {"majortickssequence", 0x00700287},
+    {"mandatorycomponenttype", 0x00760038},
+    {"manifold", 0x00660010},
+    {"manipulatedimage", 0x00280050},
+    {"manufacturer", 0x00080070},
+    {"manufacturermodelname", 0x00081090},
+    {"manufacturerrelatedmodelgroup", 0x00080222},
+    {"mappedpixelvalue", 0x00221452},
+    {"mappingresource", 0x00080105},
+    {"mappingresourceidentificationsequence", 0x00080124},
+    {"mappingresourcename", 0x00080122},
+    {"mappingresourceuid", 0x00080118},
+    {"maskframenumbers", 0x00286110},
+    {"maskingimage", 0x00200080},
+    {"maskoperation", 0x00286101},
+    {"maskoperationexplanation", 0x00286190},
+    {"maskpointers", 0x00286030},
+    {"maskselectionmode", 0x00289454},
+    {"masksubpixelshift", 0x00286114},
+    {"masksubtractionsequence", 0x00286100},
+    {"maskvisibilitypercentage", 0x00289478},
+    {"mass", 0x40101017},
+    {"materialgrade", 0x00140042},
+    {"materialid", 0x300A00E1},
+    {"materialisolationdiameter", 0x00140034},
+    {"materialnotes", 0x00140046},
+    {"materialpipediameter", 0x00140032},
+    {"materialpropertiesdescription", 0x00140044},
+    {"materialpropertiesfileformat", 0x00140045},
+    {"materialscodesequence", 0x006863A0},
+    {"materialthickness", 0x00140030},
+    {"matingfeaturedegreeoffreedomsequence", 0x00686400},
+    {"matingfeatureid", 0x006863F0},
+    {"matingfeaturesequence", 0x006863E0},
+    {"matingfeaturesetid", 0x006863C0},
+    {"matingfeaturesetlabel", 0x006863D0},
+    {"matingfeaturesetssequence", 0x006863B0},
+    {"matrixregistrationsequence", 0x00700309},
+    {"matrixsequence", 0x0070030A},
+    {"mausedingaincalibration", 0x00143072},
+    {"maxdensity", 0x20100130},
+    {"maximumacrossscandistortion", 0x00220049},
+    {"maximumalongscandistortion", 0x00220038},
+    {"maximumcollatedfilms", 0x20100154},
+    {"maximumcoordinatevalue", 0x50000105},
+    {"maximumcornealcurvature", 0x00460212},
+    {"maximumcornealcurvaturelocation", 0x00460213},
+    {"maximumcornealcurvaturesequence", 0x00460211},
+    {"maximumdepthdistortion", 0x00220036},
+    {"maximumfractionalvalue", 0x0062000E},
+    {"maximummemoryallocation", 0x20000061},
+    {"maximumpointdistance", 0x00660019},
+    {"maximumstimulusluminance", 0x00240018},
+    {"maximumstoredvaluemapped", 0x00281232},
+    {"meanpointdistance", 0x00660018},
+    {"measuredapdimension", 0x00101023},
+    {"measuredbandwidth", 0x0014401C},
+    {"measuredbeamdimensiona", 0x00144017},
+    {"measuredbeamdimensionb", 0x00144018},
+    {"measuredcenterfrequency", 0x0014401B},
+    {"measuredcharacteristics", 0x00287026},
+    {"measureddosedescription", 0x30080012},
+    {"measureddosereferencenumber", 0x30080064},
+    {"measureddosereferencesequence", 0x30080010},
+    {"measureddosetype", 0x30080014},
+    {"measureddosevalue", 0x30080016},
+    {"measuredlateraldimension", 0x00101024},
+    {"measuredvaluesequence", 0x0040A300},
+    {"measurementautomationtrial", 0x0040A194},
+    {"measurementequipmentsequence", 0x00287012},
+    {"measurementequipmenttype", 0x00287014},
+    {"measurementfunctions", 0x00287013},
+    {"measurementlaterality", 0x00240113},
+    {"measurementpatterncodesequence", 0x0028702D},
+    {"measurementprecisiondescriptiontrial", 0x0040A047},
+    {"measurementssequence", 0x00660121},
+    {"measurementunitscodesequence", 0x004008EA},
+    {"measurementvaluessequence", 0x00660132},
+    {"measuringunitssequence", 0x00400295},
+    {"mechanicalindex", 0x00185022},
+    {"mediadisposition", 0x22000004},
+    {"mediainstalledsequence", 0x200000A2},
+    {"mediastoragesopclassuid", 0x00020002},
+    {"mediastoragesopinstanceuid", 0x00020003},
+    {"medicalalerts", 0x00102000},
+    {"medicalrecordlocator", 0x00101090},
+    {"mediumtype", 0x20000030},
+    {"memoryallocation", 0x20000060},
+    {"memorybitdepth", 0x200000A0},
+    {"messageid", 0x00000110},
+    {"messageidbeingrespondedto", 0x00000120},
+    {"messagesetid", 0x00005010},
+    {"metabolitemapcodesequence", 0x00189083},
+    {"metabolitemapdescription", 0x00189080},
+    {"metersetexposure", 0x30020032},
+    {"metersetrate", 0x300A035A},
+    {"metersetratedelivered", 0x30080046},
+    {"metersetrateset", 0x30080045},
+    {"midslabposition", 0x00189106},
+    {"militaryrank", 0x00101080},
+    {"mimetypeofencapsulateddocument", 0x00420012},
+    {"mindensity", 0x20100120},
+    {"minimumcoordinatevalue", 0x50000104},
+    {"minimumkeratometricsequence", 0x00460215},
+    {"minimumsensitivityvalue", 0x00240105},
+    {"minimumstoredvaluemapped", 0x00281231},
+    {"modalitiesinstudy", 0x00080061},
+    {"modality", 0x00080060},
+    {"modalitylutsequence", 0x00283000},
+    {"modalityluttype", 0x00283004},
+    {"modelmirroring", 0x00687002},
+    {"modelmodification", 0x00687001},
+    {"modelspecificationsequence", 0x00189912},
+    {"modelusagecodesequence", 0x00687003},
+    {"modeofpercutaneousaccesssequence", 0x00520016},
+    {"modifiableconstraintflag", 0x00820038},
+    {"modifiedattributessequence", 0x04000550},
+    {"modifiedimagedate", 0x00203403},
+    {"modifiedimagedescription", 0x00203406},
+    {"modifiedimageid", 0x00203402},
+    {"modifiedimagetime", 0x00203405},
+    {"modifiercodesequence", 0x0040A195},
+    {"modifyingdeviceid", 0x00203401},
+    {"modifyingdevicemanufacturer", 0x00203404},
+    {"modifyingsystem", 0x04000563},
+    {"modulatedscanmodetype", 0x300A0309},
+    {"modulationtype", 0x00144026},
+    {"mostrecenttreatmentdate", 0x30080056},
+    {"motionsynchronizationsequence", 0x300A0410},
+    {"movedestination", 0x00000600},
+    {"moveoriginatorapplicationentitytitle", 0x00001030},
+    {"moveoriginatormessageid", 0x00001031},
+    {"mprslabthickness", 0x00701503},
+    {"mprthicknesstype", 0x00701502},
+    {"mprtoplefthandcorner", 0x00701505},
+    {"mprviewheight", 0x00701512},
+    {"mprviewheightdirection", 0x00701511},
+    {"mprviewwidth", 0x00701508},
+    {"mprviewwidthdirection", 0x00701507},
+    {"mracquisitionfrequencyencodingsteps", 0x00189058},
+    {"mracquisitionphaseencodingstepsinplane", 0x00189231},
+    {"mracquisitionphaseencodingstepsoutofplane", 0x00189232},
+    {"mracquisitiontype", 0x00180023},
+    {"mrarterialspinlabelingsequence", 0x00189251},
+    {"mraveragessequence", 0x00189119},
+    {"mrdiffusionsequence", 0x00189117},
+    {"mrdrdirectoryrecordoffset", 0x00041504},
+    {"mrechosequence", 0x00189114},
+    {"mrfovgeometrysequence", 0x00189125},
+    {"mrimageframetypesequence", 0x00189226},
+    {"mrimagingmodifiersequence", 0x00189006},
+    {"mrmetabolitemapsequence", 0x00189152},
+    {"mrmodifiersequence", 0x00189115},
+    {"mrreceivecoilsequence", 0x00189042},
+    {"mrspatialsaturationsequence", 0x00189107},
+    {"mrspectroscopyacquisitiontype", 0x00189200},
+    {"mrspectroscopyfovgeometrysequence", 0x00189103},
+    {"mrspectroscopyframetypesequence", 0x00189227},
+    {"mrtimingandrelatedparameterssequence", 0x00189112},
+    {"mrtransmitcoilsequence", 0x00189049},
+    {"mrvelocityencodingsequence", 0x00189197},
+    {"multicoilconfiguration", 0x00189046},
+    {"multicoildefinitionsequence", 0x00189045},
+    {"multicoilelementname", 0x00189047},
+    {"multicoilelementused", 0x00189048},
+    {"multiframepresentationsequence", 0x00289505},
+    {"multiframesourcesopinstanceuid", 0x00081167},
+    {"multiplanarexcitation", 0x00189012},
+    {"multiplanarreconstructionstyle", 0x00701501},
+    {"multiplecomponentapprovalsequence", 0x00140106},
+    {"multiplecopiesflag", 0x00404006},
+    {"multiplespinecho", 0x00189011},
+    {"multiplexedaudiochannelsdescriptioncodesequence", 0x003A0300},
+    {"multiplexgrouplabel", 0x003A0020},
+    {"multiplexgrouptimeoffset", 0x00181068},
+    {"mydriaticagentcodesequence", 0x0022001C},
+    {"mydriaticagentconcentration", 0x0022004E},
+    {"mydriaticagentconcentrationunitssequence", 0x00220042},
+    {"mydriaticagentsequence", 0x00220058},
+    {"nameofphysiciansreadingstudy", 0x00081060},
+    {"namesofintendedrecipientsofresults", 0x00401010},
+    {"navigationdisplayset", 0x00720216},
+    {"navigationindicatorsequence", 0x00720214},
+    {"nearpupillarydistance", 0x00460062},
+    {"negativecatchtrialsquantity", 0x00240048},
+    {"networkid", 0x00081000},
+    {"nominalbeamangle", 0x00145112},
+    {"nominalbeamenergy", 0x300A0114},
+    {"nominalbeamenergyunit", 0x300A0015},
+    {"nominalcardiactriggerdelaytime", 0x00209153},
+    {"nominalcardiactriggertimepriortorpeak", 0x00209154},
+    {"nominalfrequency", 0x0014401A},
+    {"nominalinterval", 0x00181062},
+    {"nominalpercentageofcardiacphase", 0x00209241},
+    {"nominalpercentageofrespiratoryphase", 0x00209245},
+    {"nominalpriordose", 0x300A001A},
+    {"nominalrangemodulatedregiondepths", 0x300A0504},
+    {"nominalrangemodulationfractions", 0x300A0503},
+    {"nominalrespiratorytriggerdelaytime", 0x00209255},
+    {"nominalscannedpixelspacing", 0x00182010},
+    {"nominalscreendefinitionsequence", 0x00720102},
+    {"nondicomoutputcodesequence", 0x00404032},
+    {"nonidentifyingprivateelements", 0x00080304},
+    {"nonuniformradialsamplingcorrected", 0x00189766},
+    {"normalizationfactorformat", 0x00280710},
+    {"normalizationpoint", 0x30040008},
+    {"normalreverse", 0x00005140},
+    {"notchfilterbandwidth", 0x003A0223},
+    {"notchfilterfrequency", 0x003A0222},
+    {"notificationfrommanufacturersequence", 0x00686265},
+    {"ntpsourceaddress", 0x00181803},
+    {"nuclearmedicineseriestype", 0x00080042},
+    {"numberofalarmobjects", 0x40101034},
+    {"numberofassessmentobservations", 0x00820006},
+    {"numberofaverages", 0x00180083},
+    {"numberofbeams", 0x300A0080},
+    {"numberofblocks", 0x300A00F0},
+    {"numberofblockslabitems", 0x300A0440},
+    {"numberofboli", 0x300A00ED},
+    {"numberofbrachyapplicationsetups", 0x300A00A0},
+    {"numberofbscansperframe", 0x00221642},
+    {"numberofchannels", 0x50002004},
+    {"numberofcompensators", 0x300A00E0},
+    {"numberofcompletedsuboperations", 0x00001021},
+    {"numberofcompletesuboperations", 0x00001021},
+    {"numberofcontourpoints", 0x30060046},
+    {"numberofcontrolpoints", 0x300A0110},
+    {"numberofcopies", 0x20000010},
+    {"numberofdetectors", 0x00540021},
+    {"numberofdisplaysubsystems", 0x00287001},
+    {"numberofelements", 0x00144012},
+    {"numberofenergywindows", 0x00540011},
+    {"numberofeventtimers", 0x00082129},
+    {"numberoffailedsuboperations", 0x00001022},
+    {"numberoffilms", 0x21000170},
+    {"numberoffocalplanes", 0x00480013},
+    {"numberoffractionpatterndigitsperday", 0x300A0079},
+    {"numberoffractionsdelivered", 0x3008005A},
+    {"numberoffractionsplanned", 0x300A0078},
+    {"numberofframes", 0x00280008},
+    {"numberofframesinoverlay", 0x60000015},
+    {"numberofframesinphase", 0x00540033},
+    {"numberofframesinrotation", 0x00540053},
+    {"numberofframesintegrated", 0x00143012},
+    {"numberofframesusedforintegration", 0x00143073},
+    {"numberofgraphicpoints", 0x00700021},
+    {"numberofhorizontalpixels", 0x00720106},
+    {"numberofiterations", 0x00189739},
+    {"numberofkspacetrajectories", 0x00189093},
+    {"numberoflateralspreadingdevices", 0x300A0330},
+    {"numberofleafjawpairs", 0x300A00BC},
+    {"numberofluminancepoints", 0x0028701B},
+    {"numberofmappoints", 0x00221530},
+    {"numberofmatches", 0x00000850},
+    {"numberofopticalpaths", 0x00480302},
+    {"numberofpaddedalines", 0x00520038},
+    {"numberofpaintings", 0x300A039A},
+    {"numberofpatientrelatedinstances", 0x00201204},
+    {"numberofpatientrelatedseries", 0x00201202},
+    {"numberofpatientrelatedstudies", 0x00201200},
+    {"numberofphaseencodingsteps", 0x00180089},
+    {"numberofphases", 0x00540031},
+    {"numberofpoints", 0x50000010},
+    {"numberofpriorsreferenced", 0x00720014},
+    {"numberofpulses", 0x300A028A},
+    {"numberofrangemodulators", 0x300A0340},
+    {"numberofrangeshifters", 0x300A0312},
+    {"numberofreferences", 0x00041600},
+    {"numberofremainingsuboperations", 0x00001020},
+    {"numberofrotations", 0x00540051},
+    {"numberofrrintervals", 0x00540061},
+    {"numberofsamples", 0x50002006},
+    {"numberofscanspotpositions", 0x300A0392},
+    {"numberofscreens", 0x00720100},
+    {"numberofseriesrelatedinstances", 0x00201209},
+    {"numberofslices", 0x00540081},
+    {"numberofstages", 0x00082124},
+    {"numberofstudyrelatedinstances", 0x00201208},
+    {"numberofstudyrelatedseries", 0x00201206},
+    {"numberofsubsets", 0x00189740},
+    {"numberofsurfacepoints", 0x00660015},
+    {"numberofsurfaces", 0x00660001},
+    {"numberoftablebreakpoints", 0x00186050},
+    {"numberoftableentries", 0x00186056},
+    {"numberoftables", 0x00280802},
+    {"numberoftemporalpositions", 0x00200105},
+    {"numberoftimeslices", 0x00540101},
+    {"numberoftimeslots", 0x00540071},
+    {"numberoftomosynthesissourceimages", 0x00181495},
+    {"numberoftotalobjects", 0x40101033},
+    {"numberoftriggersinphase", 0x00540211},
+    {"numberofvectors", 0x0066001E},
+    {"numberofverticalpixels", 0x00720104},
+    {"numberofviewsinstage", 0x0008212A},
+    {"numberofvisualstimuli", 0x00240038},
+    {"numberofvolumetriccurvepoints", 0x0070150C},
+    {"numberofwarningsuboperations", 0x00001023},
+    {"numberofwaveformchannels", 0x003A0005},
+    {"numberofwaveformsamples", 0x003A0010},
+    {"numberofwedges", 0x300A00D0},
+    {"numberofzerofills", 0x00189066},
+    {"numericvalue", 0x0040A30A},
+    {"numericvaluequalifiercodesequence", 0x0040A301},
+    {"objectbinaryidentifiertrial", 0x0040A074},
+    {"objectdirectorybinaryidentifiertrial", 0x0040A089},
+    {"objectivelensnumericalaperture", 0x00480113},
+    {"objectivelenspower", 0x00480112},
+    {"objectpixelspacingincenterofbeam", 0x00189404},
+    {"objectthicknesssequence", 0x00189456},
+    {"obliquecroppingplanesequence", 0x00701304},
+    {"observationbasiscodesequence", 0x00820022},
+    {"observationcategorycodesequencetrial", 0x0040A167},
+    {"observationdatetime", 0x0040A032},
+    {"observationdatetrial", 0x0040A192},
+    {"observationdescription", 0x0082000A},
+    {"observationnumber", 0x30060082},
+    {"observationsignificance", 0x00820008},
+    {"observationsubjectclasstrial", 0x0040A403},
+    {"observationsubjectcontextflagtrial", 0x0040A600},
+    {"observationsubjecttypecodesequencetrial", 0x0040A404},
+    {"observationsubjectuidtrial", 0x0040A402},
+    {"observationtimetrial", 0x0040A193},
+    {"observationuid", 0x0040A171},
+    {"observercontextflagtrial", 0x0040A601},
+    {"observertype", 0x0040A084},
+    {"occupation", 0x00102180},
+    {"octacquisitiondomain", 0x00520006},
+    {"octbscananalysisacquisitionparameterssequence", 0x00221640},
+    {"octfocaldistance", 0x00520002},
+    {"octopticalcenterwavelength", 0x00520007},
+    {"octzoffsetapplied", 0x00520026},
+    {"octzoffsetcorrection", 0x00520030},
+    {"offendingelement", 0x00000901},
+    {"offsetdirection", 0x00189905},
+    {"offsetdistance", 0x00189904},
+    {"offsetofreferencedlowerleveldirectoryentity", 0x00041420},
+    {"offsetofthefirstdirectoryrecordoftherootdirectoryentity", 0x00041200},
+    {"offsetofthelastdirectoryrecordoftherootdirectoryentity", 0x00041202},
+    {"offsetofthenextdirectoryrecord", 0x00041400},
+    {"omittedapplicationsetupsequence", 0x0074140E},
+    {"omittedbeamtasksequence", 0x300C0111},
+    {"omittedchannelsequence", 0x00741409},
+    {"onaxisbackgroundanatomicstructurecodesequencetrial", 0x0008225C},
+    {"ooiownercreationtime", 0x40101041},
+    {"ooiownersequence", 0x40101047},
+    {"ooiownertype", 0x40101009},
+    {"ooisize", 0x40101043},
+    {"ooitype", 0x40101042},
+    {"ooitypedescriptor", 0x40101068},
+    {"operatingmode", 0x00189178},
+    {"operatingmodesequence", 0x00189176},
+    {"operatingmodetype", 0x00189177},
+    {"operatoridentificationsequence", 0x00081072},
+    {"operatorsname", 0x00081070},
+    {"ophthalmicanatomicreferencepointxcoordinate", 0x00221624},
+    {"ophthalmicanatomicreferencepointycoordinate", 0x00221626},
+    {"ophthalmicaxiallength", 0x00221019},
+    {"ophthalmicaxiallengthacquisitionmethodcodesequence", 0x00221153},
+    {"ophthalmicaxiallengthdatasourcecodesequence", 0x00221150},
+    {"ophthalmicaxiallengthdatasourcedescription", 0x00221159},
+    {"ophthalmicaxiallengthmeasurementmodified", 0x00221140},
+    {"ophthalmicaxiallengthmeasurementslengthsummationsequence", 0x00221212},
+    {"ophthalmicaxiallengthmeasurementssegmentallengthsequence", 0x00221211},
+    {"ophthalmicaxiallengthmeasurementssegmentnamecodesequence", 0x00221101},
+    {"ophthalmicaxiallengthmeasurementssequence", 0x00221050},
+    {"ophthalmicaxiallengthmeasurementstotallengthsequence", 0x00221210},
+    {"ophthalmicaxiallengthmeasurementstype", 0x00221010},
+    {"ophthalmicaxiallengthmethod", 0x00221515},
+    {"ophthalmicaxiallengthqualitymetricsequence", 0x00221262},
+    {"ophthalmicaxiallengthqualitymetrictypecodesequence", 0x00221265},
+    {"ophthalmicaxiallengthqualitymetrictypedescription", 0x00221273},
+    {"ophthalmicaxiallengthselectionmethodcodesequence", 0x00221250},
+    {"ophthalmicaxiallengthsequence", 0x00221012},
+    {"ophthalmicaxiallengthvelocity", 0x00221059},
+    {"ophthalmicaxialmeasurementsdevicetype", 0x00221009},
+    {"ophthalmicaxialmeasurementslefteyesequence", 0x00221008},
+    {"ophthalmicaxialmeasurementsrighteyesequence", 0x00221007},
+    {"ophthalmicenfaceimagequalityratingsequence", 0x00221628},
+    {"ophthalmicfov", 0x00221517},
+    {"ophthalmicframelocationsequence", 0x00220031},
+    {"ophthalmicimageorientation", 0x00220039},
+    {"ophthalmicimagetypecodesequence", 0x00221615},
+    {"ophthalmicimagetypedescription", 0x00221616},
+    {"ophthalmicmappingdevicetype", 0x00221415},
+    {"ophthalmicpatientclinicalinformationlefteyesequence", 0x00240114},
+    {"ophthalmicpatientclinicalinformationrighteyesequence", 0x00240115},
+    {"ophthalmicthicknessmappingnormalssequence", 0x00221443},
+    {"ophthalmicthicknessmapqualityratingsequence", 0x00221470},
+    {"ophthalmicthicknessmapqualitythresholdsequence", 0x00221458},
+    {"ophthalmicthicknessmapthresholdqualityrating", 0x00221460},
+    {"ophthalmicthicknessmaptypecodesequence", 0x00221436},
+    {"ophthalmicultrasoundmethodcodesequence", 0x00221044},
+    {"ophthalmicvolumetricpropertiesflag", 0x00221622},
+    {"opticalophthalmicaxiallengthmeasurementssequence", 0x00221225},
+    {"opticalpathdescription", 0x00480107},
+    {"opticalpathidentificationsequence", 0x00480207},
+    {"opticalpathidentifier", 0x00480106},
+    {"opticalpathsequence", 0x00480105},
+    {"opticalselectedophthalmicaxiallengthsequence", 0x00221255},
+    {"opticaltransmittance", 0x00460040},
+    {"optotype", 0x00460094},
+    {"optotypedetaileddefinition", 0x00460139},
+    {"optotypepresentation", 0x00460095},
+    {"ordercallbackphonenumber", 0x00402010},
+    {"ordercallbacktelecominformation", 0x00402011},
+    {"orderenteredby", 0x00402008},
+    {"orderentererlocation", 0x00402009},
+    {"orderfilleridentifiersequence", 0x00400027},
+    {"orderplaceridentifiersequence", 0x00400026},
+    {"organatriskfullvolumedose", 0x300A002A},
+    {"organatrisklimitdose", 0x300A002B},
+    {"organatriskmaximumdose", 0x300A002C},
+    {"organatriskoverdosevolumefraction", 0x300A002D},
+    {"organdose", 0x00400316},
+    {"organexposed", 0x00400318},
+    {"organizationalrolecodesequence", 0x0044010A},
+    {"originalattributessequence", 0x04000561},
+    {"originalimageidentification", 0x00205000},
+    {"originalimageidentificationnomenclature", 0x00205002},
+    {"originalimagesequence", 0x213000C0},
+    {"originalimplantassemblytemplatesequence", 0x0076000C},
+    {"originalimplanttemplatesequence", 0x00686225},
+    {"originalspecializedsopclassuid", 0x0008001B},
+    {"originator", 0x21000070},
+    {"otherapprovalstatus", 0x00140107},
+    {"otherfailuressequence", 0x0008119A},
+    {"othermagnificationtypesavailable", 0x201000A7},
+    {"othermediaavailablesequence", 0x200000A4},
+    {"otherpatientids", 0x00101000},
+    {"otherpatientidssequence", 0x00101002},
+    {"otherpatientnames", 0x00101001},
+    {"otherpupillarydistance", 0x00460064},
+    {"othersecondaryapprovalstatus", 0x00140108},
+    {"othersmoothingtypesavailable", 0x201000A9},
+    {"otherstudynumbers", 0x00201070},
+    {"outerdiameter", 0x00140054},
+    {"outputdestinationsequence", 0x00404070},
+    {"outputinformationsequence", 0x00404033},
+    {"outputpower", 0x00185000},
+    {"overalltemplatespatialtolerance", 0x006862A5},
+    {"overlayactivationlayer", 0x60001001},
+    {"overlaybackgrounddensity", 0x20400082},
+    {"overlaybitposition", 0x60000102},
+    {"overlaybitsallocated", 0x60000100},
+    {"overlaybitsforcodeword", 0x60000804},
+    {"overlaybitsgrouped", 0x60000069},
+    {"overlaycodelabel", 0x60000800},
+    {"overlaycodetablelocation", 0x60000803},
+    {"overlaycolumns", 0x60000011},
+    {"overlaycomments", 0x60004000},
+    {"overlaycompressioncode", 0x60000060},
+    {"overlaycompressiondescription", 0x60000063},
+    {"overlaycompressionlabel", 0x60000062},
+    {"overlaycompressionoriginator", 0x60000061},
+    {"overlaycompressionsteppointers", 0x60000066},
+    {"overlaydata", 0x60003000},
+    {"overlaydate", 0x00080024},
+    {"overlaydescription", 0x60000022},
+    {"overlaydescriptorblue", 0x60001103},
+    {"overlaydescriptorgray", 0x60001100},
+    {"overlaydescriptorgreen", 0x60001102},
+    {"overlaydescriptorred", 0x60001101},
+    {"overlayforegrounddensity", 0x20400080},
+    {"overlayformat", 0x60000110},
+    {"overlaylabel", 0x60001500},
+    {"overlaylocation", 0x60000200},
+    {"overlaymagnificationtype", 0x20400060},
+    {"overlaymode", 0x20400090},
+    {"overlaynumber", 0x00200022},
+    {"overlaynumberoftables", 0x60000802},
+    {"overlayorigin", 0x60000050},
+    {"overlayorimagemagnification", 0x20400072},
+    {"overlaypixeldatasequence", 0x20400020},
+    {"overlayplaneorigin", 0x60000052},
+    {"overlayplanes", 0x60000012},
+    {"overlayrepeatinterval", 0x60000068},
+    {"overlayrows", 0x60000010},
+    {"overlays", 0x000051B0},
+    {"overlaysblue", 0x60001203},
+    {"overlaysgray", 0x60001200},
+    {"overlaysgreen", 0x60001202},
+    {"overlaysmoothingtype", 0x20400070},
+    {"overlaysred", 0x60001201},
+    {"overlaysubtype", 0x60000045},
+    {"overlaytime", 0x00080034},
+    {"overlaytype", 0x60000040},
+    {"overriddenattributessequence", 0x0074104A},
+    {"overrideparameterpointer", 0x30080062},
+    {"overridereason", 0x30080066},
+    {"overridesequence", 0x30080060},
+    {"oversamplingphase", 0x00189029},
+    {"ownerid", 0x21000160},
+    {"paddledescription", 0x001811A4},
+    {"pagenumbervector", 0x00182001},
+    {"pagepositionid", 0x00005120},
+    {"palettecolorlookuptablesequence", 0x00480120},
+    {"palettecolorlookuptableuid", 0x00281199},
+    {"parallelacquisition", 0x00189077},
+    {"parallelacquisitiontechnique", 0x00189078},
+    {"parallelreductionfactorinplane", 0x00189069},
+    {"parallelreductionfactoroutofplane", 0x00189155},
+    {"parallelreductionfactorsecondinplane", 0x00189168},
+    {"parameteritemindex", 0x30080063},
+    {"parameterpointer", 0x30080065},
+    {"parametersequencepointer", 0x30080061},
+    {"parametersspecificationsequence", 0x00189913},
+    {"parametervaluenumber", 0x30080067},
+    {"parametricmapframetypesequence", 0x00409092},
+    {"partialdatadisplayhandling", 0x00720208},
+    {"partialfourier", 0x00189081},
+    {"partialfourierdirection", 0x00189036},
+    {"partialview", 0x00281350},
+    {"partialviewcodesequence", 0x00281352},
+    {"partialviewdescription", 0x00281351},
+    {"participantsequence", 0x0040A07A},
+    {"participationdatetime", 0x0040A082},
+    {"participationtype", 0x0040A080},
+    {"patientadditionalposition", 0x300A0184},
+    {"patientaddress", 0x00101040},
+    {"patientage", 0x00101010},
+    {"patientalternativecalendar", 0x00100035},
+    {"patientbirthdate", 0x00100030},
+    {"patientbirthdateinalternativecalendar", 0x00100033},
+    {"patientbirthname", 0x00101005},
+    {"patientbirthtime", 0x00100032},
+    {"patientbodymassindex", 0x00101022},
+    {"patientbreedcodesequence", 0x00102293},
+    {"patientbreeddescription", 0x00102292},
+    {"patientclinicaltrialparticipationsequence", 0x00380502},
+    {"patientcomments", 0x00104000},
+    {"patientdeathdateinalternativecalendar", 0x00100034},
+    {"patienteyemovementcommandcodesequence", 0x00220006},
+    {"patienteyemovementcommanded", 0x00220005},
+    {"patientframeofreferencesource", 0x0020930C},
+    {"patientgantryrelationshipcodesequence", 0x00540414},
+    {"patientid", 0x00100020},
+    {"patientidentityremoved", 0x00120062},
+    {"patientinstitutionresidence", 0x00380400},
+    {"patientinsuranceplancodesequence", 0x00100050},
+    {"patientmotherbirthname", 0x00101060},
+    {"patientmotioncorrected", 0x00189763},
+    {"patientname", 0x00100010},
+    {"patientnotproperlyfixatedquantity", 0x00240036},
+    {"patientorientation", 0x00200020},
+    {"patientorientationcodesequence", 0x00540410},
+    {"patientorientationinframesequence", 0x00209450},
+    {"patientorientationmodifiercodesequence", 0x00540412},
+    {"patientphysiologicalstatecodesequence", 0x00189772},
+    {"patientphysiologicalstatesequence", 0x00189771},
+    {"patientposition", 0x00185100},
+    {"patientpositioninginstructionsequence", 0x0018991B},
+    {"patientprimarylanguagecodesequence", 0x00100101},
+    {"patientprimarylanguagemodifiercodesequence", 0x00100102},
+    {"patientreliabilityindicator", 0x00240069},
+    {"patientreligiouspreference", 0x001021F0},
+    {"patientsetuplabel", 0x300A0183},
+    {"patientsetupnumber", 0x300A0182},
+    {"patientsetupsequence", 0x300A0180},
+    {"patientsex", 0x00100040},
+    {"patientsexneutered", 0x00102203},
+    {"patientsize", 0x00101020},
+    {"patientsizecodesequence", 0x00101021},
+    {"patientspeciescodesequence", 0x00102202},
+    {"patientspeciesdescription", 0x00102201},
+    {"patientspecificationsequence", 0x00189911},
+    {"patientstate", 0x00380500},
+    {"patientsupportaccessorycode", 0x300A0354},
+    {"patientsupportadjustedangle", 0x0074102A},
+    {"patientsupportangle", 0x300A0122},
+    {"patientsupportangletolerance", 0x300A004C},
+    {"patientsupportid", 0x300A0352},
+    {"patientsupportrotationdirection", 0x300A0123},
+    {"patientsupporttype", 0x300A0350},
+    {"patienttelecominformation", 0x00102155},
+    {"patienttelephonenumbers", 0x00102154},
+    {"patienttransportarrangements", 0x00401004},
+    {"patientweight", 0x00101030},
+    {"patternoffcolorcielabvalue", 0x00700252},
+    {"patternoffopacity", 0x00700285},
+    {"patternoncolorcielabvalue", 0x00700251},
+    {"patternonopacity", 0x00700284},
+    {"pausebetweenframes", 0x00540038},
+    {"percentphasefieldofview", 0x00180094},
+    {"percentsampling", 0x00180093},
+    {"performedlocation", 0x00400243},
+    {"performedprocedurecodesequence", 0x0040A372},
+    {"performedprocedurestepdescription", 0x00400254},
+    {"performedprocedurestepdiscontinuationreasoncodesequence", 0x00400281},
+    {"performedprocedurestependdate", 0x00400250},
+    {"performedprocedurestependdatetime", 0x00404051},
+    {"performedprocedurestependtime", 0x00400251},
+    {"performedprocedurestepid", 0x00400253},
+    {"performedprocedurestepstartdate", 0x00400244},
+    {"performedprocedurestepstartdatetime", 0x00404050},
+    {"performedprocedurestepstarttime", 0x00400245},
+    {"performedprocedurestepstatus", 0x00400252},
+    {"performedproceduretypedescription", 0x00400255},
+    {"performedprocessingapplicationscodesequence", 0x00404007},
+    {"performedprocessingparameterssequence", 0x00741212},
+    {"performedprotocolcodesequence", 0x00400260},
+    {"performedprotocoltype", 0x00400261},
+    {"performedseriessequence", 0x00400340},
+    {"performedstationaetitle", 0x00400241},
+    {"performedstationclasscodesequence", 0x00404029},
+    {"performedstationgeographiclocationcodesequence", 0x00404030},
+    {"performedstationname", 0x00400242},
+    {"performedstationnamecodesequence", 0x00404028},
+    {"performedworkitemcodesequence", 0x00404019},
+    {"performingphysicianidentificationsequence", 0x00081052},
+    {"performingphysicianname", 0x00081050},
+    {"perframefunctionalgroupssequence", 0x52009230},
+    {"perimetertable", 0x00280070},
+    {"perimetervalue", 0x00280071},
+    {"perprojectionacquisitionsequence", 0x00189538},
+    {"personaddress", 0x00401102},
+    {"personidentificationcodesequence", 0x00401101},
+    {"personname", 0x0040A123},
+    {"persontelecominformation", 0x00401104},
+    {"persontelephonenumbers", 0x00401103},
+    {"pertinentdocumentssequence", 0x00380100},
+    {"pertinentotherevidencesequence", 0x0040A385},
+    {"pertinentresourcessequence", 0x00380101},
+    {"petdetectormotiondetailssequence", 0x00189733},
+    {"petframeacquisitionsequence", 0x00189732},
+    {"petframecorrectionfactorssequence", 0x00189736},
+    {"petframetypesequence", 0x00189751},
+    {"petpositionsequence", 0x00189735},
+    {"petreconstructionsequence", 0x00189749},
+    {"pettabledynamicssequence", 0x00189734},
+    {"phantomtype", 0x40101046},
+    {"phasecontrast", 0x00189014},
+    {"phasedelay", 0x00540036},
+    {"phasedescription", 0x00540039},
+    {"phaseinformationsequence", 0x00540032},
+    {"phasenumber", 0x00200015},
+    {"phasevector", 0x00540030},
+    {"phosphortype", 0x00181261},
+    {"photometricinterpretation", 0x00280004},
+    {"phototimersetting", 0x00187065},
+    {"physicaldeltax", 0x0018602C},
+    {"physicaldeltay", 0x0018602E},
+    {"physicaldetectorsize", 0x00189429},
+    {"physicalunitsxdirection", 0x00186024},
+    {"physicalunitsydirection", 0x00186026},
+    {"physicianapprovinginterpretation", 0x40080114},
+    {"physiciansofrecord", 0x00081048},
+    {"physiciansofrecordidentificationsequence", 0x00081049},
+    {"physiciansreadingstudyidentificationsequence", 0x00081062},
+    {"pixelaspectratio", 0x00280034},
+    {"pixelbandwidth", 0x00180095},
+    {"pixelcomponentdatatype", 0x0018604E},
+    {"pixelcomponentmask", 0x00186046},
+    {"pixelcomponentorganization", 0x00186044},
+    {"pixelcomponentphysicalunits", 0x0018604C},
+    {"pixelcomponentrangestart", 0x00186048},
+    {"pixelcomponentrangestop", 0x0018604A},
+    {"pixelcoordinatessettrial", 0x0040A29A},
+    {"pixeldata", 0x7FE00010},
+    {"pixeldataareaoriginrelativetofov", 0x00187036},
+    {"pixeldataarearotationanglerelativetofov", 0x00187038},
+    {"pixeldataproviderurl", 0x00287FE0},
+    {"pixelintensityrelationship", 0x00281040},
+    {"pixelintensityrelationshiplutsequence", 0x00289422},
+    {"pixelintensityrelationshipsign", 0x00281041},
+    {"pixelmeasuressequence", 0x00289110},
+    {"pixelorigininterpretation", 0x00480301},
+    {"pixelpaddingrangelimit", 0x00280121},
+    {"pixelpaddingvalue", 0x00280120},
+    {"pixelpresentation", 0x00089205},
+    {"pixelrepresentation", 0x00280103},
+    {"pixelshiftframerange", 0x00289506},
+    {"pixelshiftsequence", 0x00289501},
+    {"pixelspacing", 0x00280030},
+    {"pixelspacingcalibrationdescription", 0x00280A04},
+    {"pixelspacingcalibrationtype", 0x00280A02},
+    {"pixelspacingsequence", 0x004008D8},
+    {"pixelvaluemappingcodesequence", 0x00409098},
+    {"pixelvaluemappingexplanation", 0x00221454},
+    {"pixelvaluemappingtocodedconceptsequence", 0x00221450},
+    {"pixelvaluetransformationsequence", 0x00289145},
+    {"placerordernumberimagingservicerequest", 0x00402016},
+    {"placerordernumberprocedure", 0x00401006},
+    {"planarconfiguration", 0x00280006},
+    {"plane", 0x00701305},
+    {"planeidentification", 0x00189457},
+    {"planenormal", 0x00701306},
+    {"planeorientationsequence", 0x00209116},
+    {"planeorientationvolumesequence", 0x0020930F},
+    {"planepositionsequence", 0x00209113},
+    {"planepositionslidesequence", 0x0048021A},
+    {"planepositionvolumesequence", 0x0020930E},
+    {"planes", 0x00280012},
+    {"planesinacquisition", 0x00189410},
+    {"planintent", 0x300A000A},
+    {"plannedverificationimagesequence", 0x300A00CA},
+    {"planninglandmarkdescription", 0x00686540},
+    {"planninglandmarkid", 0x00686530},
+    {"planninglandmarkidentificationcodesequence", 0x00686545},
+    {"planninglandmarklinesequence", 0x00686510},
+    {"planninglandmarkplanesequence", 0x00686520},
+    {"planninglandmarkpointsequence", 0x00686500},
+    {"plateid", 0x00181004},
+    {"platetype", 0x00181260},
+    {"pointcoordinatesdata", 0x00660016},
+    {"pointpositionaccuracy", 0x00660017},
+    {"pointsboundingboxcoordinates", 0x0066001A},
+    {"polarity", 0x20200020},
+    {"positionerisocenterdetectorrotationangle", 0x00189465},
+    {"positionerisocenterprimaryangle", 0x00189463},
+    {"positionerisocentersecondaryangle", 0x00189464},
+    {"positionermotion", 0x00181500},
+    {"positionerpositionsequence", 0x00189405},
+    {"positionerprimaryangle", 0x00181510},
+    {"positionerprimaryangledirection", 0x00189559},
+    {"positionerprimaryangleincrement", 0x00181520},
+    {"positionersecondaryangle", 0x00181511},
+    {"positionersecondaryangleincrement", 0x00181521},
+    {"positionertype", 0x00181508},
+    {"positioninglandmarksequence", 0x0018991D},
+    {"positioningmethodcodesequence", 0x0018991C},
+    {"positionmeasuringdeviceused", 0x0018980C},
+    {"positionofisocenterprojection", 0x00189430},
+    {"positionreferenceindicator", 0x00201040},
+    {"positivecatchtrialsquantity", 0x00240056},
+    {"postdeformationmatrixregistrationsequence", 0x00640010},
+    {"postprocessingfunction", 0x00185021},
+    {"potentialdiagnostictasks", 0x0018990A},
+    {"potentialreasonsforprocedure", 0x00189908},
+    {"potentialreasonsforprocedurecodesequence", 0x00189909},
+    {"potentialrequestedprocedurecodesequence", 0x00189907},
+    {"potentialscheduledprotocolcodesequence", 0x00189906},
+    {"potentialthreatobjectid", 0x40101010},
+    {"prcstorcsorientation", 0x4010107E},
+    {"preamplifierequipmentsequence", 0x0014400E},
+    {"preamplifiernotes", 0x0014400F},
+    {"preamplifiersettingssequence", 0x00144040},
+    {"predecessordocumentssequence", 0x0040A360},
+    {"predecessorprotocolsequence", 0x0018990E},
+    {"predecessorstructuresetsequence", 0x30060018},
+    {"predeformationmatrixregistrationsequence", 0x0064000F},
+    {"predictedrefractiveerror", 0x00221054},
+    {"predictorcolumns", 0x00280081},
+    {"predictorconstants", 0x00280082},
+    {"predictorrows", 0x00280080},
+    {"preferredplaybacksequencing", 0x00181244},
+    {"pregnancystatus", 0x001021C0},
+    {"preliminaryflag", 0x0040A496},
+    {"premedication", 0x00400012},
+    {"prescriptiondescription", 0x300A000E},
+    {"presentationanimationstyle", 0x00701A01},
+    {"presentationcreationdate", 0x00700082},
+    {"presentationcreationtime", 0x00700083},
+    {"presentationdisplaycollectionuid", 0x00701101},
+    {"presentationgroupnumber", 0x003A0241},
+    {"presentationinputtype", 0x00701202},
+    {"presentationintenttype", 0x00080068},
+    {"presentationlutcontentsequence", 0x21300080},
+    {"presentationlutflag", 0x20000069},
+    {"presentationlutsequence", 0x20500010},
+    {"presentationlutshape", 0x20500020},
+    {"presentationpixelaspectratio", 0x00700102},
+    {"presentationpixelmagnificationratio", 0x00700103},
+    {"presentationpixelspacing", 0x00700101},
+    {"presentationsequencecollectionuid", 0x00701102},
+    {"presentationsequencepositionindex", 0x00701103},
+    {"presentationsizemode", 0x00700100},
+    {"presentationstateclassificationcomponentsequence", 0x00701801},
+    {"presentationstatecompositorcomponentsequence", 0x00701805},
+    {"presentedvisualstimulidataflag", 0x00240037},
+    {"preservecompositeinstancesaftermediacreation", 0x2200000A},
+    {"primaryanatomicstructuremodifiersequence", 0x00082230},
+    {"primaryanatomicstructuresequence", 0x00082228},
+    {"primarydosimeterunit", 0x300A00B3},
+    {"primaryfluencemodesequence", 0x30020050},
+    {"primarypositionerincrement", 0x00189514},
+    {"primarypositionerincrementsign", 0x00189518},
+    {"primarypositionerscanarc", 0x00189508},
+    {"primarypositionerscanstartangle", 0x00189510},
+    {"primarypromptscountsaccumulated", 0x00541310},
+    {"primitivepointindexlist", 0x00660029},
+    {"print", 0x000051A0},
+    {"printercharacteristicssequence", 0x21300015},
+    {"printerconfigurationsequence", 0x2000001E},
+    {"printername", 0x21100030},
+    {"printerpixelspacing", 0x20100376},
+    {"printerresolutionid", 0x20100052},
+    {"printerstatus", 0x21100010},
+    {"printerstatusinfo", 0x21100020},
+    {"printingbitdepth", 0x200000A1},
+    {"printjobdescriptionsequence", 0x21200050},
+    {"printjobid", 0x21000010},
+    {"printmanagementcapabilitiessequence", 0x21300010},
+    {"printpriority", 0x20000020},
+    {"printqueueid", 0x21100099},
+    {"priority", 0x00000700},
+    {"prismsequence", 0x00460028},
+    {"privatecreatorreference", 0x00080302},
+    {"privatedataelement", 0x00080308},
+    {"privatedataelementcharacteristicssequence", 0x00080300},
+    {"privatedataelementdefinitionsequence", 0x00080310},
+    {"privatedataelementdescription", 0x0008030E},
+    {"privatedataelementencoding", 0x0008030F},
+    {"privatedataelementkeyword", 0x0008030D},
+    {"privatedataelementname", 0x0008030C},
+    {"privatedataelementnumberofitems", 0x0008030B},
+    {"privatedataelementvaluemultiplicity", 0x00080309},
+    {"privatedataelementvaluerepresentation", 0x0008030A},
+    {"privategroupreference", 0x00080301},
+    {"privateinformation", 0x00020102},
+    {"privateinformationcreatoruid", 0x00020100},
+    {"privaterecorduid", 0x00041432},
+    {"probecenterlocationx", 0x00144058},
+    {"probecenterlocationz", 0x00144059},
+    {"probedriveequipmentsequence", 0x00144080},
+    {"probedrivenotes", 0x00144082},
+    {"probedrivesettingssequence", 0x00144087},
+    {"probeinductance", 0x00144084},
+    {"probeorientationangle", 0x00144089},
+    {"proberesistance", 0x00144085},
+    {"procedurecodesequence", 0x00081032},
+    {"procedurecontextflagtrial", 0x0040A603},
+    {"procedurecontextsequencetrial", 0x0040A340},
+    {"procedurecreationdate", 0x00144076},
+    {"procedureexpirationdate", 0x00144078},
+    {"procedureidentifiercodesequencetrial", 0x0040A085},
+    {"procedurelastmodifieddate", 0x0014407A},
+    {"procedurestepcancellationdatetime", 0x00404052},
+    {"procedurestepcommunicationsurisequence", 0x00741008},
+    {"procedurestepdiscontinuationreasoncodesequence", 0x0074100E},
+    {"proceduresteplabel", 0x00741204},
+    {"procedurestepprogress", 0x00741004},
+    {"procedurestepprogressdescription", 0x00741006},
+    {"procedurestepprogressinformationsequence", 0x00741002},
+    {"procedurestepprogressparameterssequence", 0x00741007},
+    {"proceduresteprelationshiptype", 0x00741222},
+    {"procedurestepstate", 0x00741000},
+    {"proceduretypecodesequence", 0x00760020},
+    {"procedureversion", 0x00144074},
+    {"processingfunction", 0x00185020},
+    {"productdescription", 0x00440009},
+    {"productexpirationdatetime", 0x0044000B},
+    {"productlotidentifier", 0x0044000A},
+    {"productname", 0x00440008},
+    {"productpackageidentifier", 0x00440001},
+    {"productparametersequence", 0x00440013},
+    {"producttypecodesequence", 0x00440007},
+    {"projectioneponymousnamecodesequence", 0x00185104},
+    {"projectionpixelcalibrationsequence", 0x00189401},
+    {"propertylabel", 0x00142032},
+    {"proposedstudysequence", 0x213000A0},
+    {"protocolcontextsequence", 0x00400440},
+    {"protocoldefinedpatientposition", 0x00189947},
+    {"protocoldesignrationale", 0x00189910},
+    {"protocolelementcharacteristicssummary", 0x00189923},
+    {"protocolelementname", 0x00189922},
+    {"protocolelementnumber", 0x00189921},
+    {"protocolelementpurpose", 0x00189924},
+    {"protocolname", 0x00181030},
+    {"protocolplanninginformation", 0x0018990F},
+    {"pseudocolorpaletteinstancereferencesequence", 0x00720705},
+    {"pseudocolortype", 0x00720704},
+    {"ptolocationdescription", 0x40101078},
+    {"ptoregionsequence", 0x4010107B},
+    {"ptorepresentationsequence", 0x40101037},
+    {"pulsenumber", 0x30080172},
+    {"pulserepetitionfrequency", 0x00186032},
+    {"pulserepetitioninterval", 0x300A028C},
+    {"pulserequipmentsequence", 0x00144002},
+    {"pulsernotes", 0x00144006},
+    {"pulsersettingssequence", 0x00144020},
+    {"pulsertype", 0x00144004},
+    {"pulsesequencename", 0x00189005},
+    {"pulsespecificbrachycontrolpointdeliveredsequence", 0x30080171},
+    {"pulsewidth", 0x00144022},
+    {"pupilcentroidxcoordinate", 0x00460203},
+    {"pupilcentroidycoordinate", 0x00460204},
+    {"pupildilated", 0x0022000D},
+    {"pupilsize", 0x00460044},
+    {"purposeofreferencecodesequence", 0x0040A170},
+    {"pvcrejection", 0x00181085},
+    {"qaresultssequence", 0x0028700F},
+    {"qrmeasurementssequence", 0x40101071},
+    {"quadraturereceivecoil", 0x00189044},
+    {"qualitycontrolimage", 0x00280300},
+    {"qualitycontrolsubject", 0x00100200},
+    {"qualitycontrolsubjecttypecodesequence", 0x00100201},
+    {"qualitythreshold", 0x00221630},
+    {"quantifieddefect", 0x00240098},
+    {"quantity", 0x00400294},
+    {"quantitydefinitionsequence", 0x00409220},
+    {"quantitysequence", 0x00400293},
+    {"queryretrievelevel", 0x00080052},
+    {"queryretrieveview", 0x00080053},
+    {"queuestatus", 0x21200010},
+    {"radialposition", 0x00181142},
+    {"radiationatomicnumber", 0x300A0304},
+    {"radiationchargestate", 0x300A0306},
+    {"radiationmachinename", 0x30020020},
+    {"radiationmachinesad", 0x30020022},
+    {"radiationmachinessd", 0x30020024},
+    {"radiationmassnumber", 0x300A0302},
+    {"radiationmode", 0x0018115A},
+    {"radiationsetting", 0x00181155},
+    {"radiationtype", 0x300A00C6},
+    {"radionuclide", 0x00180030},
+    {"radionuclidecodesequence", 0x00540300},
+    {"radionuclidehalflife", 0x00181075},
+    {"radionuclidepositronfraction", 0x00181076},
+    {"radionuclidetotaldose", 0x00181074},
+    {"radiopharmaceutical", 0x00180031},
+    {"radiopharmaceuticaladministrationeventuid", 0x00083012},
+    {"radiopharmaceuticalagentnumber", 0x00189729},
+    {"radiopharmaceuticalcodesequence", 0x00540304},
+    {"radiopharmaceuticalinformationsequence", 0x00540016},
+    {"radiopharmaceuticalroute", 0x00181070},
+    {"radiopharmaceuticalspecificactivity", 0x00181077},
+    {"radiopharmaceuticalstartdatetime", 0x00181078},
+    {"radiopharmaceuticalstarttime", 0x00181072},
+    {"radiopharmaceuticalstopdatetime", 0x00181079},
+    {"radiopharmaceuticalstoptime", 0x00181073},
+    {"radiopharmaceuticalusagesequence", 0x00189737},
+    {"radiopharmaceuticalvolume", 0x00181071},
+    {"radiusalongwedge", 0x0014511F},
+    {"radiusofcircularcollimator", 0x00181712},
+    {"radiusofcircularexposurecontrolsensingregion", 0x00189441},
+    {"radiusofcircularshutter", 0x00181612},
+    {"radiusofcurvature", 0x00460075},
+    {"randomscorrected", 0x00189765},
+    {"randomscorrectionmethod", 0x00541100},
+    {"rangemodulatordescription", 0x300A034A},
+    {"rangemodulatorgatingstartvalue", 0x300A0382},
+    {"rangemodulatorgatingstartwaterequivalentthickness", 0x300A0386},
+    {"rangemodulatorgatingstopvalue", 0x300A0384},
+    {"rangemodulatorgatingstopwaterequivalentthickness", 0x300A0388},
+    {"rangemodulatorid", 0x300A0346},
+    {"rangemodulatornumber", 0x300A0344},
+    {"rangemodulatorsequence", 0x300A0342},
+    {"rangemodulatorsettingssequence", 0x300A0380},
+    {"rangemodulatortype", 0x300A0348},
+    {"rangeoffreedom", 0x006864A0},
+    {"rangeshifterdescription", 0x300A0322},
+    {"rangeshifterid", 0x300A0318},
+    {"rangeshifternumber", 0x300A0316},
+    {"rangeshiftersequence", 0x300A0314},
+    {"rangeshiftersetting", 0x300A0362},
+    {"rangeshiftersettingssequence", 0x300A0360},
+    {"rangeshiftertype", 0x300A0320},
+    {"rangeshifterwaterequivalentthickness", 0x300A0366},
+    {"rangingdepth", 0x00520009},
+    {"rationaldenominatorvalue", 0x0040A163},
+    {"rationalnumeratorvalue", 0x0040A162},
+    {"rawdatahandling", 0x00404040},
+    {"realworldvaluefirstvaluemapped", 0x00409216},
+    {"realworldvalueintercept", 0x00409224},
+    {"realworldvaluelastvaluemapped", 0x00409211},
+    {"realworldvaluelutdata", 0x00409212},
+    {"realworldvaluemappingsequence", 0x00409096},
+    {"realworldvalueslope", 0x00409225},
+    {"reasonforcancellation", 0x00741238},
+    {"reasonforchannelomission", 0x0074140A},
+    {"reasonforchannelomissiondescription", 0x0074140B},
+    {"reasonforomission", 0x300C0112},
+    {"reasonforomissiondescription", 0x300C0113},
+    {"reasonforperformedprocedurecodesequence", 0x00401012},
+    {"reasonforrequestedprocedurecodesequence", 0x0040100A},
+    {"reasonforstudy", 0x00321030},
+    {"reasonfortheattributemodification", 0x04000565},
+    {"reasonfortheimagingservicerequest", 0x00402001},
+    {"reasonfortherequestedprocedure", 0x00401002},
+    {"receivecoilmanufacturername", 0x00189041},
+    {"receivecoilname", 0x00181250},
+    {"receivecoiltype", 0x00189043},
+    {"receiveprobesequence", 0x00144086},
+    {"receiver", 0x00000300},
+    {"receiverequipmentsequence", 0x00144008},
+    {"receivernotes", 0x0014400C},
+    {"receiversettingssequence", 0x00144030},
+    {"receivetransducersequence", 0x00144011},
+    {"receivetransducersettingssequence", 0x00144051},
+    {"receivingae", 0x00741234},
+    {"receivingapplicationentitytitle", 0x00020018},
+    {"recognitioncode", 0x00080010},
+    {"recognizablevisualfeatures", 0x00280302},
+    {"recommendedabsentpixelcielabvalue", 0x00480015},
+    {"recommendedanimationrate", 0x00701A03},
+    {"recommendeddefaultvaluesequence", 0x00820035},
+    {"recommendeddisplaycielabvalue", 0x0062000D},
+    {"recommendeddisplaycielabvaluelist", 0x00660103},
+    {"recommendeddisplayframerate", 0x00082144},
+    {"recommendeddisplayframerateinfloat", 0x00089459},
+    {"recommendeddisplaygrayscalevalue", 0x0062000C},
+    {"recommendedlinethickness", 0x00660038},
+    {"recommendedpointradius", 0x00660037},
+    {"recommendedpresentationopacity", 0x0066000C},
+    {"recommendedpresentationtype", 0x0066000D},
+    {"recommendedrotationpoint", 0x00686346},
+    {"recommendedviewingmode", 0x00281090},
+    {"reconstructionalgorithm", 0x00189315},
+    {"reconstructionalgorithmsequence", 0x0018993D},
+    {"reconstructionangle", 0x00189319},
+    {"reconstructiondescription", 0x00189531},
+    {"reconstructiondiameter", 0x00181100},
+    {"reconstructionendlocationsequence", 0x0018993C},
+    {"reconstructionfieldofview", 0x00189317},
+    {"reconstructionindex", 0x00209536},
+    {"reconstructionmethod", 0x00541103},
+    {"reconstructionpixelspacing", 0x00189322},
+    {"reconstructionprotocolelementsequence", 0x00189934},
+    {"reconstructionprotocolelementspecificationsequence", 0x00189933},
+    {"reconstructionstartlocationsequence", 0x0018993B},
+    {"reconstructiontargetcenterlocationsequence", 0x0018993E},
+    {"reconstructiontargetcenterpatient", 0x00189318},
+    {"reconstructiontype", 0x00189756},
+    {"recordedblocksequence", 0x300800D0},
+    {"recordedbrachyaccessorydevicesequence", 0x30080120},
+    {"recordedchannelsequence", 0x30080130},
+    {"recordedchannelshieldsequence", 0x30080150},
+    {"recordedcompensatorsequence", 0x300800C0},
+    {"recordedlateralspreadingdevicesequence", 0x300800F4},
+    {"recordedrangemodulatorsequence", 0x300800F6},
+    {"recordedrangeshiftersequence", 0x300800F2},
+    {"recordedsnoutsequence", 0x300800F0},
+    {"recordedsourceapplicatorsequence", 0x30080140},
+    {"recordedsourcesequence", 0x30080100},
+    {"recordedwedgesequence", 0x300800B0},
+    {"recordinuseflag", 0x00041410},
+    {"rectificationtype", 0x00181156},
+    {"rectifiersmoothing", 0x00144034},
+    {"rectilinearphaseencodereordering", 0x00189034},
+    {"redpalettecolorlookuptabledata", 0x00281201},
+    {"redpalettecolorlookuptabledescriptor", 0x00281101},
+    {"reference", 0x00201020},
+    {"referenceairkermarate", 0x300A022A},
+    {"referencebasiscodesequence", 0x00189902},
+    {"referencecoordinates", 0x00220032},
+    {"referencedaccessionsequencetrial", 0x0040A313},
+    {"referencedassertionuid", 0x00440108},
+    {"referencedbasicannotationboxsequence", 0x20100520},
+    {"referencedbeamnumber", 0x300C0006},
+    {"referencedbeamsequence", 0x300C0004},
+    {"referencedblocknumber", 0x300C00E0},
+    {"referencedbolussequence", 0x300C00B0},
+    {"referencedbrachyaccessorydevicenumber", 0x30080122},
+    {"referencedbrachyapplicationsetupnumber", 0x300C000C},
+    {"referencedbrachyapplicationsetupsequence", 0x300C000A},
+    {"referencedcalculateddosereferencenumber", 0x30080092},
+    {"referencedcalculateddosereferencesequence", 0x30080090},
+    {"referencedchannelnumber", 0x00741406},
+    {"referencedchannelshieldnumber", 0x30080152},
+    {"referencedcolorpaletteinstanceuid", 0x00280304},
+    {"referencedcomparisonsopinstancesequence", 0x00820005},
+    {"referencedcompensatornumber", 0x300C00D0},
+    {"referencedcontentitem", 0x00701904},
+    {"referencedcontentitemidentifier", 0x0040DB73},
+    {"referencedcontrolpointindex", 0x300C00F0},
+    {"referencedcontrolpointsequence", 0x300C00F2},
+    {"referencedcurvesequence", 0x00081145},
+    {"referenceddatetime", 0x0040A13A},
+    {"referenceddefinedprotocolsequence", 0x0018990C},
+    {"referenceddigitalsignaturesequence", 0x04000402},
+    {"referenceddosereferencenumber", 0x300C0051},
+    {"referenceddosereferencesequence", 0x300C0050},
+    {"referenceddosereferenceuid", 0x300A0083},
+    {"referenceddosesequence", 0x300C0080},
+    {"referencedfiducialuid", 0x0070031B},
+    {"referencedfileid", 0x00041500},
+    {"referencedfilmboxsequence", 0x20000500},
+    {"referencedfilmsessionsequence", 0x20100500},
+    {"referencedfindingsgroupuidtrial", 0x0040A022},
+    {"referencedfirstframesequence", 0x00720427},
+    {"referencedfractiongroupnumber", 0x300C0022},
+    {"referencedfractiongroupsequence", 0x300C0020},
+    {"referencedfractionnumber", 0x30080223},
+    {"referencedframenumber", 0x00081160},
+    {"referencedframenumbers", 0x0040A136},
+    {"referencedframeofreferencesequence", 0x30060010},
+    {"referencedframeofreferenceuid", 0x30060024},
+    {"referencedgeneralpurposescheduledprocedurestepsequence", 0x00404016},
+    {"referencedgeneralpurposescheduledproceduresteptransactionuid", 0x00404023},
+    {"referencedhpgldocumentid", 0x00686440},
+    {"referencedimageboxsequence", 0x20100510},
+    {"referencedimageevidencesequence", 0x00089092},
+    {"referencedimagenavigationsequence", 0x00480200},
+    {"referencedimageoverlayboxsequence", 0x20200130},
+    {"referencedimagerealworldvaluemappingsequence", 0x00409094},
+    {"referencedimagesequence", 0x00081140},
+    {"referencedimplanttemplategroupmemberid", 0x007800B6},
+    {"referencedinstancesequence", 0x0008114A},
+    {"referencedinterpretationsequence", 0x40080050},
+    {"referencedisplaysets", 0x00720218},
+    {"referencedlateralspreadingdevicenumber", 0x300C0102},
+    {"referencedmeasureddosereferencenumber", 0x30080082},
+    {"referencedmeasureddosereferencesequence", 0x30080080},
+    {"referencednonimagecompositesopinstancesequence", 0x00400220},
+    {"referencedobjectobservationclasstrial", 0x0040A174},
+    {"referencedobservationclasstrial", 0x0040A173},
+    {"referencedobservationuidtrial", 0x0040A172},
+    {"referencedophthalmicaxiallengthmeasurementqcimagesequence", 0x00221330},
+    {"referencedophthalmicaxialmeasurementssequence", 0x00221100},
+    {"referencedosedefinition", 0x300A0512},
+    {"referencedotherplanesequence", 0x00089410},
+    {"referencedoverlayplanegroups", 0x20400011},
+    {"referencedoverlayplanesequence", 0x20400010},
+    {"referencedoverlaysequence", 0x00081130},
+    {"referencedpatientaliassequence", 0x00380004},
+    {"referencedpatientphotosequence", 0x00101100},
+    {"referencedpatientsequence", 0x00081120},
+    {"referencedpatientsetupnumber", 0x300C006A},
+    {"referencedperformedprocedurestepsequence", 0x00081111},
+    {"referencedperformedprotocolsequence", 0x0018990D},
+    {"referencedpresentationlutsequence", 0x20500500},
+    {"referencedpresentationstatesequence", 0x00089237},
+    {"referencedprintjobsequence", 0x21200070},
+    {"referencedprintjobsequencepullstoredprint", 0x21000500},
+    {"referencedprocedurestepsequence", 0x00400330},
+    {"referencedptosequence", 0x40101076},
+    {"referencedrangemodulatornumber", 0x300C0104},
+    {"referencedrangeshifternumber", 0x300C0100},
+    {"referencedrawdatasequence", 0x00089121},
+    {"referencedrealworldvaluemappinginstancesequence", 0x0008114B},
+    {"referencedreferenceimagenumber", 0x300C0007},
+    {"referencedreferenceimagesequence", 0x300C0042},
+    {"referencedrefractivemeasurementssequence", 0x00460145},
+    {"referencedrelatedgeneralsopclassuidinfile", 0x0004151A},
+    {"referencedrequestsequence", 0x0040A370},
+    {"referencedresultssequence", 0x00081100},
+    {"referencedroinumber", 0x30060084},
+    {"referencedrtplansequence", 0x300C0002},
+    {"referencedsamplepositions", 0x0040A132},
+    {"referencedsegmentnumber", 0x0062000B},
+    {"referencedseriessequence", 0x00081115},
+    {"referencedsetupimagesequence", 0x300A0401},
+    {"referencedsopclassuid", 0x00081150},
+    {"referencedsopclassuidinfile", 0x00041510},
+    {"referencedsopinstancemacsequence", 0x04000403},
+    {"referencedsopinstanceuid", 0x00081155},
+    {"referencedsopinstanceuidinfile", 0x00041511},
+    {"referencedsopsequence", 0x00081199},
+    {"referencedsourceapplicatornumber", 0x30080142},
+    {"referencedsourcenumber", 0x300C000E},
+    {"referencedspatialregistrationsequence", 0x00700404},
+    {"referencedstartcontrolpointindex", 0x300C00F4},
+    {"referencedstereometricinstancesequence", 0x00081134},
+    {"referencedstopcontrolpointindex", 0x300C00F6},
+    {"referencedstoragemediasequence", 0x2200000D},
+    {"referencedstoredprintsequence", 0x20000510},
+    {"referencedstructuredcontextsequence", 0x00701903},
+    {"referencedstructuresetsequence", 0x300C0060},
+    {"referencedstudysequence", 0x00081110},
+    {"referencedsurfacedatasequence", 0x00800013},
+    {"referencedsurfacemeshidentificationsequence", 0x00221620},
+    {"referencedsurfacenumber", 0x0066002C},
+    {"referencedsurfacesequence", 0x0066002B},
+    {"referencedtargetluminancecharacteristicsid", 0x0028700E},
+    {"referencedtdrinstancesequence", 0x40101077},
+    {"referencedtexturesequence", 0x00800012},
+    {"referencedtimeoffsets", 0x0040A138},
+    {"referencedtolerancetablenumber", 0x300C00A0},
+    {"referencedtransfersyntaxuidinfile", 0x00041512},
+    {"referencedtreatmentrecordsequence", 0x30080030},
+    {"referencedverificationimagesequence", 0x300C0040},
+    {"referencedvisitsequence", 0x00081125},
+    {"referencedvoilutboxsequence", 0x20200140},
+    {"referencedwaveformchannels", 0x0040A0B0},
+    {"referencedwaveformsequence", 0x0008113A},
+    {"referencedwedgenumber", 0x300C00C0},
+    {"referencegeometrycodesequence", 0x00189903},
+    {"referenceimagenumber", 0x300A00C8},
+    {"referencelocationdescription", 0x00189901},
+    {"referencelocationlabel", 0x00189900},
+    {"referencepixelphysicalvaluex", 0x00186028},
+    {"referencepixelphysicalvaluey", 0x0018602A},
+    {"referencepixelx0", 0x00186020},
+    {"referencepixely0", 0x00186022},
+    {"referencetorecordedsound", 0x40080103},
+    {"referringphysicianaddress", 0x00080092},
+    {"referringphysicianidentificationsequence", 0x00080096},
+    {"referringphysicianname", 0x00080090},
+    {"referringphysiciantelephonenumbers", 0x00080094},
+    {"reflectedambientlight", 0x20100160},
+    {"reformattinginterval", 0x00720514},
+    {"reformattingoperationinitialviewdirection", 0x00720516},
+    {"reformattingoperationtype", 0x00720510},
+    {"reformattingthickness", 0x00720512},
+    {"refractiveerrorbeforerefractivesurgerycodesequence", 0x00221103},
+    {"refractiveindexapplied", 0x0052003A},
+    {"refractiveparametersusedonpatientsequence", 0x00240112},
+    {"refractivepower", 0x00460251},
+    {"refractiveprocedureoccurred", 0x00221039},
+    {"refractivestatesequence", 0x0022001B},
+    {"refractivesurgerytypecodesequence", 0x00221040},
+    {"regiondatatype", 0x00186014},
+    {"regionflags", 0x00186016},
+    {"regionlocationmaxx1", 0x0018601C},
+    {"regionlocationmaxy1", 0x0018601E},
+    {"regionlocationminx0", 0x00186018},
+    {"regionlocationminy0", 0x0018601A},
+    {"regionofresidence", 0x00102152},
+    {"regionpixelshiftsequence", 0x00289502},
+    {"regionspatialformat", 0x00186012},
+    {"registeredlocalizerbottomrighthandcorner", 0x00221468},
+    {"registeredlocalizertoplefthandcorner", 0x00221467},
+    {"registeredlocalizerunits", 0x00221466},
+    {"registrationmethodcodesequence", 0x00800003},
+    {"registrationsequence", 0x00700308},
+    {"registrationtolocalizersequence", 0x00221465},
+    {"registrationtypecodesequence", 0x0070030D},
+    {"relatedassertionsequence", 0x00440107},
+    {"relatedframeofreferenceuid", 0x300600C2},
+    {"relatedgeneralsopclassuid", 0x0008001A},
+    {"relatedprocedurestepsequence", 0x00741220},
+    {"relatedreferencertimagesequence", 0x00741040},
+    {"relatedrtroiobservationssequence", 0x300600A0},
+    {"relatedseriessequence", 0x00081250},
+    {"relationshipsequencetrial", 0x0040A731},
+    {"relationshiptype", 0x0040A010},
+    {"relationshiptypecodesequencetrial", 0x0040A732},
+    {"relativeelevation", 0x00460252},
+    {"relativeimagepositioncodesequence", 0x0022001D},
+    {"relativeopacity", 0x00700403},
+    {"relativetime", 0x00720038},
+    {"relativetimeunits", 0x0072003A},
+    {"relativexrayexposure", 0x00181405},
+    {"relevantinformationsequence", 0x00404022},
+    {"relevantoptattributessequence", 0x00221472},
+    {"renderedimagereferencesequence", 0x00701104},
+    {"renderfieldofview", 0x00701606},
+    {"renderingmethod", 0x0070120D},
+    {"renderprojection", 0x00701602},
+    {"repairid", 0x00140105},
+    {"repeatfractioncyclelength", 0x300A007A},
+    {"repeatinterval", 0x00280068},
+    {"repetitiontime", 0x00180080},
+    {"replacedimplantassemblytemplatesequence", 0x00760008},
+    {"replacedimplanttemplategroupsequence", 0x00780026},
+    {"replacedimplanttemplatesequence", 0x00686222},
+    {"replacedprocedurestepsequence", 0x00741224},
+    {"reportdetailsequencetrial", 0x0040A380},
+    {"reportedvaluesorigin", 0x3002000A},
+    {"reportingpriority", 0x00401009},
+    {"reportnumber", 0x002000AA},
+    {"reportproductionstatustrial", 0x400800FF},
+    {"reportstatuscommenttrial", 0x0040A33A},
+    {"reportstatusidtrial", 0x0040A125},
+    {"repositoryuniqueid", 0x0040E030},
+    {"representativeframenumber", 0x00286010},
+    {"reprojectionmethod", 0x00541004},
+    {"requestattributessequence", 0x00400275},
+    {"requestedcontrastagent", 0x00321070},
+    {"requesteddecimatecropbehavior", 0x20200040},
+    {"requestedimagesize", 0x20200030},
+    {"requestedimagesizeflag", 0x202000A0},
+    {"requestedmediaapplicationprofile", 0x2200000C},
+    {"requestedprocedurecodesequence", 0x00321064},
+    {"requestedprocedurecomments", 0x00401400},
+    {"requestedproceduredescription", 0x00321060},
+    {"requestedproceduredescriptiontrial", 0x00401060},
+    {"requestedprocedureid", 0x00401001},
+    {"requestedprocedurelocation", 0x00401005},
+    {"requestedprocedurepriority", 0x00401003},
+    {"requestedresolutionid", 0x20200050},
+    {"requestedseriesdescription", 0x00189937},
+    {"requestedsopclassuid", 0x00000003},
+    {"requestedsopinstanceuid", 0x00001001},
+    {"requestedsubsequentworkitemcodesequence", 0x00404031},
+    {"requestingae", 0x00741236},
+    {"requestingphysician", 0x00321032},
+    {"requestingphysicianidentificationsequence", 0x00321031},
+    {"requestingservice", 0x00321033},
+    {"requestingservicecodesequence", 0x00321034},
+    {"requestpriority", 0x22000020},
+    {"rescaleintercept", 0x00281052},
+    {"rescaleslope", 0x00281053},
+    {"rescaletype", 0x00281054},
+    {"residualsyringecounts", 0x00540017},
+    {"resonantnucleus", 0x00189100},
+    {"resourcedescription", 0x00380102},
+    {"respiratorycycleposition", 0x00189214},
+    {"respiratoryintervaltime", 0x00209254},
+    {"respiratorymotioncompensationtechnique", 0x00189170},
+    {"respiratorymotioncompensationtechniquedescription", 0x00189185},
+    {"respiratorysignalsource", 0x00189171},
+    {"respiratorysignalsourceid", 0x00189186},
+    {"respiratorysynchronizationsequence", 0x00209253},
+    {"respiratorytriggerdelaythreshold", 0x00209256},
+    {"respiratorytriggertype", 0x00209250},
+    {"responsesequencenumber", 0x00000860},
+    {"responsiblegroupcodesequence", 0x00080220},
+    {"responsibleorganization", 0x00102299},
+    {"responsibleperson", 0x00102297},
+    {"responsiblepersonrole", 0x00102298},
+    {"resultinggeneralpurposeperformedprocedurestepssequence", 0x00404015},
+    {"resultscomments", 0x40084000},
+    {"resultsdistributionlistsequence", 0x40080118},
+    {"resultsid", 0x40080040},
+    {"resultsidissuer", 0x40080042},
+    {"resultsnormalssequence", 0x00240064},
+    {"retestsensitivityvalue", 0x00240096},
+    {"reteststimulusseen", 0x00240095},
+    {"retinalthicknessdefinitioncodesequence", 0x00221445},
+    {"retrieveaetitle", 0x00080054},
+    {"retrievelocationuid", 0x0040E011},
+    {"retrieveuri", 0x0040E010},
+    {"retrieveurl", 0x00081190},
+    {"reviewdate", 0x300E0004},
+    {"reviewername", 0x300E0008},
+    {"reviewtime", 0x300E0005},
+    {"revolutiontime", 0x00189305},
+    {"rfechotrainlength", 0x00189240},
+    {"rgbatransferfunctiondescription", 0x00701A09},
+    {"rgbluttransferfunction", 0x0028140F},
+    {"rightimagesequence", 0x00220022},
+    {"rightlenssequence", 0x00460014},
+    {"roiarea", 0x60001301},
+    {"roicontoursequence", 0x30060039},
+    {"roidescription", 0x30060028},
+    {"roidisplaycolor", 0x3006002A},
+    {"roielementalcompositionatomicmassfraction", 0x300600B8},
+    {"roielementalcompositionatomicnumber", 0x300600B7},
+    {"roielementalcompositionsequence", 0x300600B6},
+    {"roigenerationalgorithm", 0x30060036},
+    {"roigenerationdescription", 0x30060038},
+    {"roiinterpreter", 0x300600A6},
+    {"roimean", 0x60001302},
+    {"roiname", 0x30060026},
+    {"roinumber", 0x30060022},
+    {"roiobservationdescription", 0x30060088},
+    {"roiobservationlabel", 0x30060085},
+    {"roiphysicalpropertiessequence", 0x300600B0},
+    {"roiphysicalproperty", 0x300600B2},
+    {"roiphysicalpropertyvalue", 0x300600B4},
+    {"roistandarddeviation", 0x60001303},
+    {"roivolume", 0x3006002C},
+    {"rotationangle", 0x00700230},
+    {"rotationdirection", 0x00181140},
+    {"rotationinformationsequence", 0x00540052},
+    {"rotationoffset", 0x00181146},
+    {"rotationofscannedfilm", 0x00182030},
+    {"rotationpoint", 0x00700273},
+    {"rotationvector", 0x00540050},
+    {"routeid", 0x40101054},
+    {"routeidassigningauthority", 0x40101055},
+    {"routeofadmissions", 0x00380016},
+    {"routesegmentendlocationid", 0x4010101F},
+    {"routesegmentendtime", 0x40101026},
+    {"routesegmentid", 0x40101007},
+    {"routesegmentlocationidtype", 0x40101020},
+    {"routesegmentsequence", 0x4010100A},
+    {"routesegmentstartlocationid", 0x4010101E},
+    {"routesegmentstarttime", 0x40101025},
+    {"rowoverlap", 0x00280093},
+    {"rowpositionintotalimagepixelmatrix", 0x0048021F},
+    {"rows", 0x00280010},
+    {"rowsfornthordercoefficients", 0x00280400},
+    {"rrintervaltimenominal", 0x00209251},
+    {"rrintervalvector", 0x00540060},
+    {"rtbeamlimitingdevicetype", 0x300A00B8},
+    {"rtdoseroisequence", 0x30040010},
+    {"rtimagedescription", 0x30020004},
+    {"rtimagelabel", 0x30020002},
+    {"rtimagename", 0x30020003},
+    {"rtimageorientation", 0x30020010},
+    {"rtimageplane", 0x3002000C},
+    {"rtimageposition", 0x30020012},
+    {"rtimagesid", 0x30020026},
+    {"rtplandate", 0x300A0006},
+    {"rtplandescription", 0x300A0004},
+    {"rtplangeometry", 0x300A000C},
+    {"rtplanlabel", 0x300A0002},
+    {"rtplanname", 0x300A0003},
+    {"rtplanrelationship", 0x300A0055},
+    {"rtplantime", 0x300A0007},
+    {"rtreferencedseriessequence", 0x30060014},
+    {"rtreferencedstudysequence", 0x30060012},
+    {"rtrelatedroisequence", 0x30060030},
+    {"rtroiidentificationcodesequence", 0x30060086},
+    {"rtroiinterpretedtype", 0x300600A4},
+    {"rtroiobservationssequence", 0x30060080},
+    {"rtroirelationship", 0x30060033},
+    {"runlengthtriplet", 0x10000001},
+    {"rwavepointer", 0x00286040},
+    {"rwavetimevector", 0x00186060},
+    {"safepositionexitdate", 0x30080162},
+    {"safepositionexittime", 0x30080164},
+    {"safepositionreturndate", 0x30080166},
+    {"safepositionreturntime", 0x30080168},
+    {"samplerate", 0x50002008},
+    {"samplesperpixel", 0x00280002},
+    {"samplesperpixelused", 0x00280003},
+    {"samplingfrequency", 0x003A001A},
+    {"samplingstepsize", 0x00701607},
+    {"sar", 0x00181316},
+    {"saturationrecovery", 0x00189024},
+    {"scanarc", 0x00181143},
+    {"scanlength", 0x00181302},
+    {"scanmode", 0x300A0308},
+    {"scannersettingssequence", 0x0014409A},
+    {"scanningsequence", 0x00180020},
+    {"scanningspotsize", 0x300A0398},
+    {"scanoptions", 0x00180022},
+    {"scanpatterntypecodesequence", 0x00221618},
+    {"scanprocedure", 0x0014409B},
+    {"scanprogressiondirection", 0x00540501},
+    {"scanspotmetersetsdelivered", 0x30080047},
+    {"scanspotmetersetweights", 0x300A0396},
+    {"scanspotpositionmap", 0x300A0394},
+    {"scanspotprescribedindices", 0x300A0391},
+    {"scanspotreordered", 0x300A0393},
+    {"scanspotreorderingallowed", 0x300A0395},
+    {"scanspottimeoffset", 0x300A038F},
+    {"scanspottuneid", 0x300A0390},
+    {"scantype", 0x40101048},
+    {"scanvelocity", 0x00181300},
+    {"scattercorrected", 0x00189760},
+    {"scattercorrectionmethod", 0x00541105},
+    {"scatterfractionfactor", 0x00541323},
+    {"scheduledadmissiondate", 0x0038001A},
+    {"scheduledadmissiontime", 0x0038001B},
+    {"scheduleddischargedate", 0x0038001C},
+    {"scheduleddischargetime", 0x0038001D},
+    {"scheduledhumanperformerssequence", 0x00404034},
+    {"scheduledpatientinstitutionresidence", 0x0038001E},
+    {"scheduledperformingphysicianidentificationsequence", 0x0040000B},
+    {"scheduledperformingphysicianname", 0x00400006},
+    {"scheduledprocedurestepdescription", 0x00400007},
+    {"scheduledprocedurestependdate", 0x00400004},
+    {"scheduledprocedurestependtime", 0x00400005},
+    {"scheduledprocedurestepexpirationdatetime", 0x00404008},
+    {"scheduledprocedurestepid", 0x00400009},
+    {"scheduledproceduresteplocation", 0x00400011},
+    {"scheduledprocedurestepmodificationdatetime", 0x00404010},
+    {"scheduledproceduresteppriority", 0x00741200},
+    {"scheduledprocedurestepsequence", 0x00400100},
+    {"scheduledprocedurestepstartdate", 0x00400002},
+    {"scheduledprocedurestepstartdatetime", 0x00404005},
+    {"scheduledprocedurestepstarttime", 0x00400003},
+    {"scheduledprocedurestepstatus", 0x00400020},
+    {"scheduledprocessingapplicationscodesequence", 0x00404004},
+    {"scheduledprocessingparameterssequence", 0x00741210},
+    {"scheduledprotocolcodesequence", 0x00400008},
+    {"scheduledspecimensequence", 0x00400500},
+    {"scheduledstationaetitle", 0x00400001},
+    {"scheduledstationclasscodesequence", 0x00404026},
+    {"scheduledstationgeographiclocationcodesequence", 0x00404027},
+    {"scheduledstationname", 0x00400010},
+    {"scheduledstationnamecodesequence", 0x00404025},
+    {"scheduledstepattributessequence", 0x00400270},
+    {"scheduledstudylocation", 0x00321020},
+    {"scheduledstudylocationaetitle", 0x00321021},
+    {"scheduledstudystartdate", 0x00321000},
+    {"scheduledstudystarttime", 0x00321001},
+    {"scheduledstudystopdate", 0x00321010},
+    {"scheduledstudystoptime", 0x00321011},
+    {"scheduledworkitemcodesequence", 0x00404018},
+    {"scpstatus", 0x00741242},
+    {"screeningbaselinemeasured", 0x00240120},
+    {"screeningbaselinemeasuredsequence", 0x00240122},
+    {"screeningbaselinetype", 0x00240124},
+    {"screeningbaselinevalue", 0x00240126},
+    {"screeningtestmodecodesequence", 0x00240016},
+    {"screenminimumcolorbitdepth", 0x0072010C},
+    {"screenminimumgrayscalebitdepth", 0x0072010A},
+    {"seamlineindex", 0x00520036},
+    {"seamlinelocation", 0x00520033},
+    {"secondaryapprovalstatus", 0x00140101},
+    {"secondarycapturedeviceid", 0x00181010},
+    {"secondarycapturedevicemanufacturer", 0x00181016},
+    {"secondarycapturedevicemanufacturermodelname", 0x00181018},
+    {"secondarycapturedevicesoftwareversions", 0x00181019},
+    {"secondarycountsaccumulated", 0x00541311},
+    {"secondarycountstype", 0x00541220},
+    {"secondaryinspectionmethodsequence", 0x4010107D},
+    {"secondarypositionerincrement", 0x00189515},
+    {"secondarypositionerincrementsign", 0x00189519},
+    {"secondarypositionerscanarc", 0x00189509},
+    {"secondarypositionerscanstartangle", 0x00189511},
+    {"secondaryreviewdate", 0x00140102},
+    {"secondaryreviewername", 0x00140104},
+    {"secondaryreviewtime", 0x00140103},
+    {"segmentalgorithmname", 0x00620009},
+    {"segmentalgorithmtype", 0x00620008},
+    {"segmentationalgorithmidentificationsequence", 0x00620007},
+    {"segmentationfractionaltype", 0x00620010},
+    {"segmentationtype", 0x00620001},
+    {"segmentdescription", 0x00620006},
+    {"segmentedalphapalettecolorlookuptabledata", 0x00281224},
+    {"segmentedbluepalettecolorlookuptabledata", 0x00281223},
+    {"segmentedgreenpalettecolorlookuptabledata", 0x00281222},
+    {"segmentedkspacetraversal", 0x00189033},
+    {"segmentedpropertycategorycodesequence", 0x00620003},
+    {"segmentedpropertytypecodesequence", 0x0062000F},
+    {"segmentedpropertytypemodifiercodesequence", 0x00620011},
+    {"segmentedredpalettecolorlookuptabledata", 0x00281221},
+    {"segmentidentificationsequence", 0x0062000A},
+    {"segmentlabel", 0x00620005},
+    {"segmentnumber", 0x00620004},
+    {"segmentsequence", 0x00620002},
+    {"segmentsurfacegenerationalgorithmidentificationsequence", 0x0066002D},
+    {"segmentsurfacesourceinstancesequence", 0x0066002E},
+    {"selectedsegmentalophthalmicaxiallengthsequence", 0x00221257},
+    {"selectedtotalophthalmicaxiallengthsequence", 0x00221260},
+    {"selectoraevalue", 0x0072005E},
+    {"selectorasvalue", 0x0072005F},
+    {"selectorattribute", 0x00720026},
+    {"selectorattributekeyword", 0x00820019},
+    {"selectorattributename", 0x00820018},
+    {"selectorattributeprivatecreator", 0x00720056},
+    {"selectorattributevr", 0x00720050},
+    {"selectoratvalue", 0x00720060},
+    {"selectorcodesequencevalue", 0x00720080},
+    {"selectorcsvalue", 0x00720062},
+    {"selectordavalue", 0x00720061},
+    {"selectordsvalue", 0x00720072},
+    {"selectordtvalue", 0x00720063},
+    {"selectorfdvalue", 0x00720074},
+    {"selectorflvalue", 0x00720076},
+    {"selectorisvalue", 0x00720064},
+    {"selectorlovalue", 0x00720066},
+    {"selectorltvalue", 0x00720068},
+    {"selectorobvalue", 0x00720065},
+    {"selectorodvalue", 0x00720073},
+    {"selectorofvalue", 0x00720067},
+    {"selectorolvalue", 0x00720075},
+    {"selectorowvalue", 0x00720069},
+    {"selectorpnvalue", 0x0072006A},
+    {"selectorsequencepointer", 0x00720052},
+    {"selectorsequencepointeritems", 0x00741057},
+    {"selectorsequencepointerprivatecreator", 0x00720054},
+    {"selectorshvalue", 0x0072006C},
+    {"selectorslvalue", 0x0072007C},
+    {"selectorssvalue", 0x0072007E},
+    {"selectorstvalue", 0x0072006E},
+    {"selectortmvalue", 0x0072006B},
+    {"selectorucvalue", 0x0072006F},
+    {"selectoruivalue", 0x0072007F},
+    {"selectorulvalue", 0x00720078},
+    {"selectorunvalue", 0x0072006D},
+    {"selectorurvalue", 0x00720071},
+    {"selectorusvalue", 0x0072007A},
+    {"selectorutvalue", 0x00720070},
+    {"selectorvaluenumber", 0x00720028},
+    {"sendingapplicationentitytitle", 0x00020017},
+    {"sensitivity", 0x00186000},
+    {"sensitivitycalibrated", 0x00189767},
+    {"sensitivityvalue", 0x00240094},
+    {"sensorname", 0x00143022},
+    {"sensortemperature", 0x00143028},
+    {"sequencedelimitationitem", 0xFFFEE0DD},
+    {"sequencename", 0x00180024},
+    {"sequenceofultrasoundregions", 0x00186011},
+    {"sequencevariant", 0x00180021},
+    {"sequencingindicatortrial", 0x0040A060},
+    {"seriesdate", 0x00080021},
+    {"seriesdescription", 0x0008103E},
+    {"seriesdescriptioncodesequence", 0x0008103F},
+    {"seriesinstanceuid", 0x0020000E},
+    {"seriesinstudy", 0x00201000},
+    {"seriesnumber", 0x00200011},
+    {"seriestime", 0x00080031},
+    {"seriestype", 0x00541000},
+    {"serviceepisodedescription", 0x00380062},
+    {"serviceepisodeid", 0x00380060},
+    {"settlingphaseframe", 0x00189624},
+    {"setupdevicedescription", 0x300A01BA},
+    {"setupdevicelabel", 0x300A01B8},
+    {"setupdeviceparameter", 0x300A01BC},
+    {"setupdevicesequence", 0x300A01B4},
+    {"setupdevicetype", 0x300A01B6},
+    {"setupimagecomment", 0x300A0402},
+    {"setupreferencedescription", 0x300A01D0},
+    {"setuptechnique", 0x300A01B0},
+    {"setuptechniquedescription", 0x300A01B2},
+    {"shadingstyle", 0x00701701},
+    {"shadowcolorcielabvalue", 0x00700247},
+    {"shadowoffsetx", 0x00700245},
+    {"shadowoffsety", 0x00700246},
+    {"shadowopacity", 0x00700258},
+    {"shadowstyle", 0x00700244},
+    {"shapetype", 0x00700306},
+    {"sharedfunctionalgroupssequence", 0x52009229},
+    {"shieldingdevicedescription", 0x300A01A6},
+    {"shieldingdevicelabel", 0x300A01A4},
+    {"shieldingdeviceposition", 0x300A01A8},
+    {"shieldingdevicesequence", 0x300A01A0},
+    {"shieldingdevicetype", 0x300A01A2},
+    {"shifttablesize", 0x10000004},
+    {"shifttabletriplet", 0x10000005},
+    {"shininess", 0x00701706},
+    {"shorttermfluctuation", 0x00240075},
+    {"shorttermfluctuationcalculated", 0x00240074},
+    {"shorttermfluctuationprobability", 0x00240077},
+    {"shorttermfluctuationprobabilitycalculated", 0x00240076},
+    {"shotdurationtime", 0x00800004},
+    {"shotoffsettime", 0x00800005},
+    {"showacquisitiontechniquesflag", 0x00720716},
+    {"showgraphicannotationflag", 0x00720712},
+    {"showgrayscaleinverted", 0x00720706},
+    {"showimagetruesizeflag", 0x00720710},
+    {"showpatientdemographicsflag", 0x00720714},
+    {"showticklabel", 0x00700278},
+    {"shutterleftverticaledge", 0x00181602},
+    {"shutterlowerhorizontaledge", 0x00181608},
+    {"shutteroverlaygroup", 0x00181623},
+    {"shutterpresentationcolorcielabvalue", 0x00181624},
+    {"shutterpresentationvalue", 0x00181622},
+    {"shutterrightverticaledge", 0x00181604},
+    {"shuttershape", 0x00181600},
+    {"shutterupperhorizontaledge", 0x00181606},
+    {"signaldomaincolumns", 0x00289003},
+    {"signaldomainrows", 0x00289235},
+    {"signaltonoiseratio", 0x00221155},
+    {"signature", 0x04000120},
+    {"simpleframelist", 0x00081161},
+    {"simulatedkeratometriccylindersequence", 0x00460218},
+    {"singlecollimationwidth", 0x00189306},
+    {"skipbeats", 0x00181086},
+    {"skipframerangeflag", 0x00089460},
+    {"slaborientation", 0x00189105},
+    {"slabthickness", 0x00189104},
+    {"slicelocation", 0x00201041},
+    {"slicelocationvector", 0x00182005},
+    {"sliceprogressiondirection", 0x00540500},
+    {"slicesensitivityfactor", 0x00541320},
+    {"slicethickness", 0x00180050},
+    {"slicevector", 0x00540080},
+    {"slideidentifier", 0x004006FA},
+    {"smallestimagepixelvalue", 0x00280106},
+    {"smallestimagepixelvalueinplane", 0x00280110},
+    {"smallestpixelvalueinseries", 0x00280108},
+    {"smallestvalidpixelvalue", 0x00280104},
+    {"smokingstatus", 0x001021A0},
+    {"smoothingtype", 0x20100080},
+    {"snoutid", 0x300A030F},
+    {"snoutposition", 0x300A030D},
+    {"snoutpositiontolerance", 0x300A004B},
+    {"snoutsequence", 0x300A030C},
+    {"snrthreshold", 0x40101073},
+    {"softcopyvoilutsequence", 0x00283110},
+    {"softtissuefocusthermalindex", 0x00185028},
+    {"softtissuesurfacethermalindex", 0x00185029},
+    {"softtissuethermalindex", 0x00185027},
+    {"softwareversions", 0x00181020},
+    {"sopauthorizationcomment", 0x01000424},
+    {"sopauthorizationdatetime", 0x01000420},
+    {"sopclassesinstudy", 0x00080062},
+    {"sopclassessupported", 0x0008115A},
+    {"sopclassuid", 0x00080016},
+    {"sopinstancestatus", 0x01000410},
+    {"sopinstanceuid", 0x00080018},
+    {"sopinstanceuidofconcatenationsource", 0x00200242},
+    {"sortbycategory", 0x00720602},
+    {"sortingdirection", 0x00720604},
+    {"sortingoperationssequence", 0x00720600},
+    {"soundpathlength", 0x0014405A},
+    {"sourceacquisitionbeamnumber", 0x00189939},
+    {"sourceacquisitionprotocolelementnumber", 0x00189938},
+    {"sourceapplicationentitytitle", 0x00020016},
+    {"sourceapplicatorid", 0x300A0291},
+    {"sourceapplicatorlength", 0x300A0296},
+    {"sourceapplicatormanufacturer", 0x300A0298},
+    {"sourceapplicatorname", 0x300A0294},
+    {"sourceapplicatornumber", 0x300A0290},
+    {"sourceapplicatorstepsize", 0x300A02A0},
+    {"sourceapplicatortiplength", 0x300A0274},
+    {"sourceapplicatortype", 0x300A0292},
+    {"sourceapplicatorwallnominalthickness", 0x300A029C},
+    {"sourceapplicatorwallnominaltransmission", 0x300A029E},
+    {"sourceaxisdistance", 0x300A00B4},
+    {"sourcedescription", 0x300A021C},
+    {"sourceencapsulationnominalthickness", 0x300A0222},
+    {"sourceencapsulationnominaltransmission", 0x300A0224},
+    {"sourceframeofreferenceuid", 0x00640003},
+    {"sourcehangingprotocolsequence", 0x00720012},
+    {"sourceimagecornealprocesseddatasequence", 0x00460244},
+    {"sourceimageevidencesequence", 0x00089154},
+    {"sourceimageids", 0x00203100},
+    {"sourceimagesequence", 0x00082112},
+    {"sourceinstancesequence", 0x00420013},
+    {"sourceirradiationeventsequence", 0x00083011},
+    {"sourceisotopehalflife", 0x300A0228},
+    {"sourceisotopename", 0x300A0226},
+    {"sourcemanufacturer", 0x300A0216},
+    {"sourcemodelid", 0x300A021B},
+    {"sourcemovementtype", 0x300A0288},
+    {"sourcenumber", 0x300A0212},
+    {"sourceofanteriorchamberdepthdatacodesequence", 0x00221133},
+    {"sourceoflensthicknessdatacodesequence", 0x00221132},
+    {"sourceofophthalmicaxiallengthcodesequence", 0x00221035},
+    {"sourceofpreviousvalues", 0x04000564},
+    {"sourceofrefractivemeasurementscodesequence", 0x00221135},
+    {"sourceofrefractivemeasurementssequence", 0x00221134},
+    {"sourceorientation", 0x40101060},
+    {"sourcepatientgroupidentificationsequence", 0x00100026},
+    {"sourceposition", 0x40101061},
+    {"sourcereconstructionprotocolelementnumber", 0x0018993A},
+    {"sourcesequence", 0x300A0210},
+    {"sourceserialnumber", 0x30080105},
+    {"sourcestrength", 0x300A022B},
+    {"sourcestrengthreferencedate", 0x300A022C},
+    {"sourcestrengthreferencetime", 0x300A022E},
+    {"sourcestrengthunits", 0x300A0229},
+    {"sourcetoapplicatormountingpositiondistance", 0x300A0436},
+    {"sourcetobeamlimitingdevicedistance", 0x300A00BA},
+    {"sourcetoblocktraydistance", 0x300A00F6},
+    {"sourcetocompensatordistance", 0x300A02E2},
+    {"sourcetocompensatortraydistance", 0x300A00E6},
+    {"sourcetoexternalcontourdistance", 0x300A0132},
+    {"sourcetogeneralaccessorydistance", 0x300A0425},
+    {"sourcetoreferenceobjectdistance", 0x30020028},
+    {"sourcetosurfacedistance", 0x300A0130},
+    {"sourcetowedgetraydistance", 0x300A00DA},
+    {"sourcetype", 0x300A0214},
+    {"sourcewaveformsequence", 0x003A020A},
+    {"spacingbetweenslices", 0x00180088},
+    {"spatiallocationspreserved", 0x0028135A},
+    {"spatialpresaturation", 0x00189027},
+    {"spatialresolution", 0x00181050},
+    {"spatialtransformofdose", 0x30040005},
+    {"specialneeds", 0x00380050},
+    {"specificabsorptionratedefinition", 0x00189179},
+    {"specificabsorptionratesequence", 0x00189239},
+    {"specificabsorptionratevalue", 0x00189181},
+    {"specificationselectionguidance", 0x00820033},
+    {"specificcharacterset", 0x00080005},
+    {"specificcharactersetoffilesetdescriptorfile", 0x00041142},
+    {"specifiedchanneltotaltime", 0x30080132},
+    {"specifiedmeterset", 0x30080042},
+    {"specifiednumberofpulses", 0x30080136},
+    {"specifiedprimarymeterset", 0x30080032},
+    {"specifiedpulserepetitioninterval", 0x3008013A},
+    {"specifiedsecondarymeterset", 0x30080033},
+    {"specifiedtreatmenttime", 0x3008003A},
+    {"specimenaccessionnumber", 0x0040050A},
+    {"specimendescriptionsequence", 0x00400560},
+    {"specimendescriptionsequencetrial", 0x00400552},
+    {"specimendescriptiontrial", 0x00400553},
+    {"specimendetaileddescription", 0x00400602},
+    {"specimenidentifier", 0x00400551},
+    {"specimenlabelinimage", 0x00480010},
+    {"specimenlocalizationcontentitemsequence", 0x00400620},
+    {"specimenpreparationsequence", 0x00400610},
+    {"specimenpreparationstepcontentitemsequence", 0x00400612},
+    {"specimenreferencesequence", 0x00480110},
+    {"specimensequence", 0x00400550},
+    {"specimenshortdescription", 0x00400600},
+    {"specimentypecodesequence", 0x0040059A},
+    {"specimenuid", 0x00400554},
+    {"spectrallyselectedexcitation", 0x00189026},
+    {"spectrallyselectedsuppression", 0x00189025},
+    {"spectralwidth", 0x00189052},
+    {"spectroscopyacquisitiondatacolumns", 0x00189127},
+    {"spectroscopyacquisitionoutofplanephasesteps", 0x00189159},
+    {"spectroscopyacquisitionphasecolumns", 0x00189234},
+    {"spectroscopyacquisitionphaserows", 0x00189095},
+    {"spectroscopydata", 0x56000020},
+    {"specularreflectionintensity", 0x00701705},
+    {"spherepower", 0x00460146},
+    {"sphericallenspower", 0x00220007},
+    {"spiralpitchfactor", 0x00189311},
+    {"spoiling", 0x00189016},
+    {"stackid", 0x00209056},
+    {"stagecodesequence", 0x0040000A},
+    {"stagename", 0x00082120},
+    {"stagenumber", 0x00082122},
+    {"startacquisitiondatetime", 0x00189516},
+    {"startangle", 0x00540200},
+    {"startcardiactriggercountthreshold", 0x00189717},
+    {"startcumulativemetersetweight", 0x300C0008},
+    {"startcumulativetimeweight", 0x00741407},
+    {"startdensitythreshold", 0x00189715},
+    {"startingrespiratoryamplitude", 0x00209246},
+    {"startingrespiratoryphase", 0x00209247},
+    {"startmeterset", 0x30080078},
+    {"startrelativedensitydifferencethreshold", 0x00189716},
+    {"startrespiratorytriggercountthreshold", 0x00189718},
+    {"starttrim", 0x00082142},
+    {"stationaetitle", 0x00080055},
+    {"stationname", 0x00081010},
+    {"status", 0x00000900},
+    {"steadystatepulsesequence", 0x00189017},
+    {"steepkeratometricaxissequence", 0x00460074},
+    {"steeringangle", 0x00186036},
+    {"stereobaselineangle", 0x00220010},
+    {"stereobaselinedisplacement", 0x00220011},
+    {"stereohorizontalpixeloffset", 0x00220012},
+    {"stereopairspresent", 0x00220028},
+    {"stereopairssequence", 0x00220020},
+    {"stereorotation", 0x00220014},
+    {"stereoverticalpixeloffset", 0x00220013},
+    {"stimuliretestingquantity", 0x00240042},
+    {"stimulusarea", 0x00240025},
+    {"stimuluscolorcodesequence", 0x00240021},
+    {"stimuluspresentationtime", 0x00240028},
+    {"stimulusresults", 0x00240093},
+    {"stoptrim", 0x00082143},
+    {"storagemediafilesetid", 0x00880130},
+    {"storagemediafilesetuid", 0x00880140},
+    {"storageprotocolelementsequence", 0x00189936},
+    {"storageprotocolelementspecificationsequence", 0x00189935},
+    {"storageurl", 0x00404073},
+    {"storedvaluecolorrangesequence", 0x00281230},
+    {"stowrsstoragesequence", 0x00404072},
+    {"strainadditionalinformation", 0x00100218},
+    {"straincodesequence", 0x00100219},
+    {"straindescription", 0x00100212},
+    {"strainnomenclature", 0x00100213},
+    {"strainsource", 0x00100217},
+    {"strainsourceregistrycodesequence", 0x00100215},
+    {"strainstocknumber", 0x00100214},
+    {"strainstocksequence", 0x00100216},
+    {"structuredconstraintobservationsequence", 0x0082000C},
+    {"structureddisplaybackgroundcielabvalue", 0x00720420},
+    {"structureddisplayimageboxsequence", 0x00720422},
+    {"structureddisplaytextboxsequence", 0x00720424},
+    {"structuresetdate", 0x30060008},
+    {"structuresetdescription", 0x30060006},
+    {"structuresetlabel", 0x30060002},
+    {"structuresetname", 0x30060004},
+    {"structuresetroisequence", 0x30060020},
+    {"structuresettime", 0x30060009},
+    {"studiescontainingotherreferencedinstancessequence", 0x00081200},
+    {"studyarrivaldate", 0x00321040},
+    {"studyarrivaltime", 0x00321041},
+    {"studycomments", 0x00324000},
+    {"studycompletiondate", 0x00321050},
+    {"studycompletiontime", 0x00321051},
+    {"studycomponentstatusid", 0x00321055},
+    {"studydate", 0x00080020},
+    {"studydescription", 0x00081030},
+    {"studyid", 0x00200010},
+    {"studyidissuer", 0x00320012},
+    {"studyinstanceuid", 0x0020000D},
+    {"studypriorityid", 0x0032000C},
+    {"studyreaddate", 0x00320034},
+    {"studyreadtime", 0x00320035},
+    {"studystatusid", 0x0032000A},
+    {"studytime", 0x00080030},
+    {"studyverifieddate", 0x00320032},
+    {"studyverifiedtime", 0x00320033},
+    {"subjectiverefractionlefteyesequence", 0x00460098},
+    {"subjectiverefractionrighteyesequence", 0x00460097},
+    {"subjectrelativepositioninimage", 0x00100028},
+    {"subscriptionliststatus", 0x00741244},
+    {"substanceadministrationapproval", 0x00440002},
+    {"substanceadministrationdatetime", 0x00440010},
+    {"substanceadministrationdeviceid", 0x00440012},
+    {"substanceadministrationnotes", 0x00440011},
+    {"substanceadministrationparametersequence", 0x00440019},
+    {"subtractionitemid", 0x00289416},
+    {"supportedimagedisplayformatssequence", 0x200000A8},
+    {"surfaceasymmetryindex", 0x00460232},
+    {"surfacecomments", 0x00660004},
+    {"surfacecount", 0x0066002A},
+    {"surfaceentrypoint", 0x300A012E},
+    {"surfacemeshprimitivessequence", 0x00660013},
+    {"surfacemeshzpixeloffset", 0x00221658},
+    {"surfacemodeldescriptionsequence", 0x00686360},
+    {"surfacemodellabel", 0x00686380},
+    {"surfacemodelscalingfactor", 0x00686390},
+    {"surfacenumber", 0x00660003},
+    {"surfacepointcolorcielabvaluedata", 0x00800007},
+    {"surfacepointpresentationvaluedata", 0x00800006},
+    {"surfacepointsnormalssequence", 0x00660012},
+    {"surfacepointssequence", 0x00660011},
+    {"surfaceprocessing", 0x00660009},
+    {"surfaceprocessingalgorithmidentificationsequence", 0x00660035},
+    {"surfaceprocessingdescription", 0x0066000B},
+    {"surfaceprocessingratio", 0x0066000A},
+    {"surfaceregularityindex", 0x00460230},
+    {"surfacescanacquisitiontypecodesequence", 0x00800001},
+    {"surfacescanmodecodesequence", 0x00800002},
+    {"surfacesequence", 0x00660002},
+    {"surgicaltechnique", 0x00760030},
+    {"suvtype", 0x00541006},
+    {"swivelrange", 0x00701A06},
+    {"synchronizationchannel", 0x0018106C},
+    {"synchronizationframeofreferenceuid", 0x00200200},
+    {"synchronizationtrigger", 0x0018106A},
+    {"synchronizedimageboxlist", 0x00720432},
+    {"synchronizedscrollingsequence", 0x00720210},
+    {"syringecounts", 0x00181045},
+    {"systemstatus", 0x00287006},
+    {"systemstatuscomment", 0x00287007},
+    {"t2preparation", 0x00189021},
+    {"tableangle", 0x00181138},
+    {"tablecradletiltangle", 0x00189471},
+    {"tablefeedperrotation", 0x00189310},
+    {"tableframeofreferenceuid", 0x00209313},
+    {"tableheadtiltangle", 0x00189470},
+    {"tableheight", 0x00181130},
+    {"tablehorizontalrotationangle", 0x00189469},
+    {"tablelateralincrement", 0x00181136},
+    {"tablelongitudinalincrement", 0x00181137},
+    {"tablemotion", 0x00181134},
+    {"tableofparametervalues", 0x0018605A},
+    {"tableofpixelvalues", 0x00186058},
+    {"tableofxbreakpoints", 0x00186052},
+    {"tableofybreakpoints", 0x00186054},
+    {"tableposition", 0x00189327},
+    {"tablepositionsequence", 0x00189406},
+    {"tablespeed", 0x00189309},
+    {"tabletopeccentricadjustedangle", 0x0074102B},
+    {"tabletopeccentricangle", 0x300A0125},
+    {"tabletopeccentricangletolerance", 0x300A004E},
+    {"tabletopeccentricaxisdistance", 0x300A0124},
+    {"tabletopeccentricrotationdirection", 0x300A0126},
+    {"tabletoplateraladjustedposition", 0x00741028},
+    {"tabletoplateralposition", 0x300A012A},
+    {"tabletoplateralpositiontolerance", 0x300A0053},
+    {"tabletoplateralsetupdisplacement", 0x300A01D6},
+    {"tabletoplongitudinaladjustedposition", 0x00741027},
+    {"tabletoplongitudinalposition", 0x300A0129},
+    {"tabletoplongitudinalpositiontolerance", 0x300A0052},
+    {"tabletoplongitudinalsetupdisplacement", 0x300A01D4},
+    {"tabletoppitchadjustedangle", 0x0074102C},
+    {"tabletoppitchangle", 0x300A0140},
+    {"tabletoppitchangletolerance", 0x300A004F},
+    {"tabletoppitchrotationdirection", 0x300A0142},
+    {"tabletoprolladjustedangle", 0x0074102D},
+    {"tabletoprollangle", 0x300A0144},
+    {"tabletoprollangletolerance", 0x300A0050},
+    {"tabletoprollrotationdirection", 0x300A0146},
+    {"tabletopverticaladjustedposition", 0x00741026},
+    {"tabletopverticalposition", 0x300A0128},
+    {"tabletopverticalpositiontolerance", 0x300A0051},
+    {"tabletopverticalsetupdisplacement", 0x300A01D2},
+    {"tabletraverse", 0x00181131},
+    {"tabletype", 0x0018113A},
+    {"tableverticalincrement", 0x00181135},
+    {"tablexpositiontoisocenter", 0x00189466},
+    {"tableypositiontoisocenter", 0x00189467},
+    {"tablezpositiontoisocenter", 0x00189468},
+    {"taganglefirstaxis", 0x00189019},
+    {"taganglesecondaxis", 0x00189219},
+    {"tagging", 0x00189028},
+    {"taggingdelay", 0x00189184},
+    {"tagspacingfirstdimension", 0x00189030},
+    {"tagspacingseconddimension", 0x00189218},
+    {"tagthickness", 0x00189035},
+    {"tangentialpower", 0x00460250},
+    {"targetexposureindex", 0x00181412},
+    {"targetframeofreferenceuid", 0x0018991E},
+    {"targetlabel", 0x00182045},
+    {"targetluminancecharacteristicssequence", 0x00287008},
+    {"targetmaterialsequence", 0x40101072},
+    {"targetmaximumdose", 0x300A0027},
+    {"targetmaximumluminance", 0x0028701E},
+    {"targetminimumdose", 0x300A0025},
+    {"targetminimumluminance", 0x0028701D},
+    {"targetpositionreferenceindicator", 0x0020103F},
+    {"targetprescriptiondose", 0x300A0026},
+    {"targetrefraction", 0x00221037},
+    {"targetuid", 0x00182042},
+    {"targetunderdosevolumefraction", 0x300A0028},
+    {"tdrtype", 0x40101027},
+    {"telephonenumbertrial", 0x0040A354},
+    {"templateextensioncreatoruid", 0x0040DB0D},
+    {"templateextensionflag", 0x0040DB0B},
+    {"templateextensionorganizationuid", 0x0040DB0C},
+    {"templateidentifier", 0x0040DB00},
+    {"templatelocalversion", 0x0040DB07},
+    {"templatename", 0x300A0244},
+    {"templatenumber", 0x300A0240},
+    {"templatetype", 0x300A0242},
+    {"templateversion", 0x0040DB06},
+    {"temporalpositionidentifier", 0x00200100},
+    {"temporalpositionindex", 0x00209128},
+    {"temporalpositionsequence", 0x00209310},
+    {"temporalpositiontimeoffset", 0x0020930D},
+    {"temporalrangetype", 0x0040A130},
+    {"temporalresolution", 0x00200110},
+    {"terminaltype", 0x00004010},
+    {"terminationcardiactriggercountthreshold", 0x00189723},
+    {"terminationcountsthreshold", 0x00189719},
+    {"terminationdensitythreshold", 0x00189720},
+    {"terminationrelativedensitythreshold", 0x00189721},
+    {"terminationrespiratorytriggercountthreshold", 0x00189724},
+    {"terminationtimethreshold", 0x00189722},
+    {"testimagevalidation", 0x0028702B},
+    {"testpatterncodesequence", 0x0028702C},
+    {"testpointnormalsdataflag", 0x00240057},
+    {"testpointnormalssequence", 0x00240058},
+    {"testresult", 0x00287029},
+    {"testresultcomment", 0x0028702A},
+    {"textcolorcielabvalue", 0x00700241},
+    {"textcomments", 0x40004000},
+    {"textformatid", 0x00005130},
+    {"textobjectsequence", 0x00700008},
+    {"textstring", 0x20300020},
+    {"textstylesequence", 0x00700231},
+    {"texturelabel", 0x00800009},
+    {"textvalue", 0x0040A160},
+    {"therapydescription", 0x00180039},
+    {"therapytype", 0x00180037},
+    {"threatcategory", 0x40101012},
+    {"threatcategorydescription", 0x40101013},
+    {"threatdetectionalgorithmandversion", 0x40101029},
+    {"threatroibase", 0x40101004},
+    {"threatroibitmap", 0x40101006},
+    {"threatroiextents", 0x40101005},
+    {"threatroivoxelsequence", 0x40101001},
+    {"threatsequence", 0x40101011},
+    {"threeddegreeoffreedomaxis", 0x00686490},
+    {"threedimplanttemplategroupmembermatchingaxes", 0x00780060},
+    {"threedimplanttemplategroupmembermatchingpoint", 0x00780050},
+    {"threedlinecoordinates", 0x006865D0},
+    {"threedmatingaxes", 0x006864D0},
+    {"threedmatingpoint", 0x006864C0},
+    {"threedplanenormal", 0x00686620},
+    {"threedplaneorigin", 0x00686610},
+    {"threedpointcoordinates", 0x00686590},
+    {"threedrenderingtype", 0x00720520},
+    {"thresholddensity", 0x20400100},
+    {"thresholdsequence", 0x00701B11},
+    {"thresholdtype", 0x00701B13},
+    {"thresholdvalue", 0x00701B14},
+    {"thresholdvaluesequence", 0x00701B12},
+    {"tickalignment", 0x00700274},
+    {"ticklabel", 0x00700289},
+    {"ticklabelalignment", 0x00700279},
+    {"tickposition", 0x00700288},
+    {"tidoffset", 0x00286120},
+    {"time", 0x0040A122},
+    {"timebasedimagesetssequence", 0x00720030},
+    {"timedistributionprotocol", 0x00181802},
+    {"timedomainfiltering", 0x00189065},
+    {"timeofdocumentcreationorverbaltransactiontrial", 0x0040A112},
+    {"timeofflightcontrast", 0x00189015},
+    {"timeofflightinformationused", 0x00189755},
+    {"timeofgaincalibration", 0x00143077},
+    {"timeoflastcalibration", 0x00181201},
+    {"timeoflastdetectorcalibration", 0x0018700E},
+    {"timeofsecondarycapture", 0x00181014},
+    {"timerange", 0x00081163},
+    {"timeseriesblending", 0x00701B07},
+    {"timeslicevector", 0x00540100},
+    {"timeslotinformationsequence", 0x00540072},
+    {"timeslotnumber", 0x00200017},
+    {"timeslottime", 0x00540073},
+    {"timeslotvector", 0x00540070},
+    {"timesource", 0x00181801},
+    {"timezoneoffsetfromutc", 0x00080201},
+    {"tiptype", 0x40101039},
+    {"tissueheterogeneitycorrection", 0x30040014},
+    {"tmlinepositionx0", 0x0018603D},
+    {"tmlinepositionx1", 0x00186041},
+    {"tmlinepositiony0", 0x0018603F},
+    {"tmlinepositiony1", 0x00186043},
+    {"tolerancetablelabel", 0x300A0043},
+    {"tolerancetablenumber", 0x300A0042},
+    {"tolerancetablesequence", 0x300A0040},
+    {"tomoangle", 0x00181470},
+    {"tomoclass", 0x00181491},
+    {"tomolayerheight", 0x00181460},
+    {"tomotime", 0x00181480},
+    {"tomotype", 0x00181490},
+    {"topicauthor", 0x00880910},
+    {"topickeywords", 0x00880912},
+    {"topicsubject", 0x00880906},
+    {"topictitle", 0x00880904},
+    {"toplefthandcorneroflocalizerarea", 0x00480201},
+    {"totalaperture", 0x00145101},
+    {"totalblocktrayfactor", 0x300A00F2},
+    {"totalblocktraywaterequivalentthickness", 0x300A00F3},
+    {"totalcollimationwidth", 0x00189307},
+    {"totalcompensatortrayfactor", 0x300A00E2},
+    {"totalcompensatortraywaterequivalentthickness", 0x300A02E3},
+    {"totalgain", 0x00185040},
+    {"totalnumberofexposures", 0x00400301},
+    {"totalnumberofpiecesofmediacreated", 0x2200000B},
+    {"totalpixelmatrixcolumns", 0x00480006},
+    {"totalpixelmatrixfocalplanes", 0x00480303},
+    {"totalpixelmatrixoriginsequence", 0x00480008},
+    {"totalpixelmatrixrows", 0x00480007},
+    {"totalprocessingtime", 0x40101069},
+    {"totalreferenceairkerma", 0x300A0250},
+    {"totaltime", 0x5000200A},
+    {"totaltimeoffluoroscopy", 0x00400300},
+    {"totalwedgetraywaterequivalentthickness", 0x300A00D7},
+    {"trackingalgorithmidentificationsequence", 0x00660104},
+    {"trackingid", 0x00620020},
+    {"trackinguid", 0x00620021},
+    {"trackpointindexlist", 0x00660129},
+    {"tracksequence", 0x00660102},
+    {"tracksetanatomicaltypecodesequence", 0x00660108},
+    {"tracksetdescription", 0x00660107},
+    {"tracksetlabel", 0x00660106},
+    {"tracksetnumber", 0x00660105},
+    {"tracksetsequence", 0x00660101},
+    {"tracksetstatisticssequence", 0x00660124},
+    {"trackstatisticssequence", 0x00660130},
+    {"transactionuid", 0x00081195},
+    {"transducerapplicationcodesequence", 0x0018980F},
+    {"transducerbeamsteeringcodesequence", 0x0018980E},
+    {"transducerdata", 0x00185010},
+    {"transducerfrequency", 0x00186030},
+    {"transducergeometrycodesequence", 0x0018980D},
+    {"transducerorientation", 0x00082204},
+    {"transducerorientationmodifiersequence", 0x00082246},
+    {"transducerorientationsequence", 0x00082244},
+    {"transducerposition", 0x00082200},
+    {"transducerpositionmodifiersequence", 0x00082242},
+    {"transducerpositionsequence", 0x00082240},
+    {"transducerscanpatterncodesequence", 0x00189809},
+    {"transducertype", 0x00186031},
+    {"transfersyntaxuid", 0x00020010},
+    {"transfertubelength", 0x300A02A4},
+    {"transfertubenumber", 0x300A02A2},
+    {"transformationalgorithmsequence", 0x00221513},
+    {"transformationmethodcodesequence", 0x00221512},
+    {"transformdescription", 0x00142222},
+    {"transformedaxisunits", 0x00142228},
+    {"transformnumberofaxes", 0x00142224},
+    {"transformorderofaxes", 0x00142226},
+    {"translationratex", 0x0014409C},
+    {"translationratey", 0x0014409D},
+    {"transmitcoilmanufacturername", 0x00189050},
+    {"transmitcoilname", 0x00181251},
+    {"transmitcoiltype", 0x00189051},
+    {"transmitterfrequency", 0x00189098},
+    {"transmittransducersequence", 0x00144010},
+    {"transmittransducersettingssequence", 0x00144050},
+    {"transportclassification", 0x40101067},
+    {"transversedetectorseparation", 0x00189726},
+    {"transversemash", 0x00541202},
+    {"trayaccessorycode", 0x300A0355},
+    {"treatmentcontrolpointdate", 0x30080024},
+    {"treatmentcontrolpointtime", 0x30080025},
+    {"treatmentdate", 0x30080250},
+    {"treatmentdeliverytype", 0x300A00CE},
+    {"treatmentmachinename", 0x300A00B2},
+    {"treatmentmachinesequence", 0x300A0206},
+    {"treatmentprotocols", 0x300A0009},
+    {"treatmentsessionapplicationsetupsequence", 0x30080110},
+    {"treatmentsessionbeamsequence", 0x30080020},
+    {"treatmentsessionionbeamsequence", 0x30080021},
+    {"treatmentsites", 0x300A000B},
+    {"treatmentstatuscomment", 0x30080202},
+    {"treatmentsummarycalculateddosereferencesequence", 0x30080050},
+    {"treatmentsummarymeasureddosereferencesequence", 0x300800E0},
+    {"treatmentterminationcode", 0x3008002B},
+    {"treatmentterminationstatus", 0x3008002A},
+    {"treatmenttime", 0x30080251},
+    {"treatmentverificationstatus", 0x3008002C},
+    {"trianglefansequence", 0x00660027},
+    {"trianglepointindexlist", 0x00660023},
+    {"trianglestripsequence", 0x00660026},
+    {"triggersampleposition", 0x0018106E},
+    {"triggersourceortype", 0x00181061},
+    {"triggertime", 0x00181060},
+    {"triggertimeoffset", 0x00181069},
+    {"triggervector", 0x00540210},
+    {"triggerwindow", 0x00181094},
+    {"trim", 0x20100140},
+    {"tubeangle", 0x00189303},
+    {"twoddegreeoffreedomaxis", 0x006864F0},
+    {"twoddegreeoffreedomsequence", 0x00686470},
+    {"twodimensionaltothreedimensionalmapdata", 0x00221531},
+    {"twodimensionaltothreedimensionalmapsequence", 0x00221518},
+    {"twodimplanttemplategroupmembermatchingaxes", 0x007800A0},
+    {"twodimplanttemplategroupmembermatchingpoint", 0x00780090},
+    {"twodlinecoordinates", 0x006865B0},
+    {"twodlinecoordinatessequence", 0x006865A0},
+    {"twodmatingaxes", 0x00686460},
+    {"twodmatingfeaturecoordinatessequence", 0x00686430},
+    {"twodmatingpoint", 0x00686450},
+    {"twodplanecoordinatessequence", 0x006865E0},
+    {"twodplaneintersection", 0x006865F0},
+    {"twodpointcoordinates", 0x00686560},
+    {"twodpointcoordinatessequence", 0x00686550},
+    {"typeofdata", 0x50000020},
+    {"typeofdetectormotion", 0x00540202},
+    {"typeoffilters", 0x00181161},
+    {"typeofinstances", 0x0040E020},
+    {"typeofpatientid", 0x00100022},
+    {"typeofsynchronization", 0x00720434},
+    {"udisequence", 0x0018100A},
+    {"uid", 0x0040A124},
+    {"ultrasoundacquisitiongeometry", 0x00209307},
+    {"ultrasoundcolordatapresent", 0x00280014},
+    {"ultrasoundophthalmicaxiallengthmeasurementssequence", 0x00221220},
+    {"ultrasoundselectedophthalmicaxiallengthsequence", 0x00221230},
+    {"unassignedperframeconvertedattributessequence", 0x00209171},
+    {"unassignedsharedconvertedattributessequence", 0x00209170},
+    {"underlined", 0x00700248},
+    {"unformattedtextvalue", 0x00700006},
+    {"unifiedprocedurestepliststatus", 0x00741246},
+    {"unifiedprocedurestepperformedproceduresequence", 0x00741216},
+    {"uniformresourcelocatortrial", 0x0040A992},
+    {"uniquedeviceidentifier", 0x00181009},
+    {"units", 0x00541001},
+    {"universalentityid", 0x00400032},
+    {"universalentityidtype", 0x00400033},
+    {"unspecifiedlateralitylenssequence", 0x00460016},
+    {"upperlowerpixelvalues", 0x00181240},
+    {"urgencyorpriorityalertstrial", 0x0040A057},
+    {"urncodevalue", 0x00080120},
+    {"usedfiducialssequence", 0x00700314},
+    {"usedsegmentssequence", 0x00620012},
+    {"userselectedgainy", 0x0014408B},
+    {"userselectedoffsetx", 0x0014408D},
+    {"userselectedoffsety", 0x0014408E},
+    {"userselectedphase", 0x0014408C},
+    {"usimagedescriptionsequence", 0x00189806},
+    {"uvaluedata", 0x00800010},
+    {"uvmappingsequence", 0x00800008},
+    {"valuetype", 0x0040A040},
+    {"variablecoefficientssddn", 0x7F000040},
+    {"variablecoefficientssdhn", 0x7F000030},
+    {"variablecoefficientssdvn", 0x7F000020},
+    {"variableflipangleflag", 0x00181315},
+    {"variablenextdatagroup", 0x7F000011},
+    {"variablepixeldata", 0x7F000010},
+    {"vectoraccuracy", 0x00660020},
+    {"vectorcoordinatedata", 0x00660021},
+    {"vectordimensionality", 0x0066001F},
+    {"vectorgriddata", 0x00640009},
+    {"velocityencodingacquisitionsequence", 0x00189092},
+    {"velocityencodingdirection", 0x00189090},
+    {"velocityencodingmaximumvalue", 0x00189217},
+    {"velocityencodingminimumvalue", 0x00189091},
+    {"velocityofsound", 0x00144064},
+    {"verbalsourceidentifiercodesequencetrial", 0x0040A358},
+    {"verbalsourcetrial", 0x0040A352},
+    {"verificationdatetime", 0x0040A030},
+    {"verificationflag", 0x0040A493},
+    {"verificationimagetiming", 0x00741032},
+    {"verifyingobserveridentificationcodesequence", 0x0040A088},
+    {"verifyingobservername", 0x0040A075},
+    {"verifyingobserversequence", 0x0040A073},
+    {"verifyingorganization", 0x0040A027},
+    {"vertexpointindexlist", 0x00660025},
+    {"verticalalignment", 0x00700243},
+    {"verticaloffsetofsensor", 0x00143026},
+    {"verticalprismbase", 0x00460036},
+    {"verticalprismpower", 0x00460034},
+    {"verticesoftheoutlineofpupil", 0x00460208},
+    {"verticesofthepolygonalcollimator", 0x00181720},
+    {"verticesofthepolygonalexposurecontrolsensingregion", 0x00189442},
+    {"verticesofthepolygonalshutter", 0x00181620},
+    {"verticesoftheregion", 0x00289503},
+    {"videoimageformatacquired", 0x00181022},
+    {"viewcodesequence", 0x00540220},
+    {"viewingdistance", 0x00460106},
+    {"viewingdistancetype", 0x00460125},
+    {"viewmodifiercodesequence", 0x00540222},
+    {"viewname", 0x00082127},
+    {"viewnumber", 0x00082128},
+    {"vieworientationcodesequence", 0x006862E0},
+    {"vieworientationmodifiercodesequence", 0x006862F0},
+    {"viewpointlookatpoint", 0x00701604},
+    {"viewpointposition", 0x00701603},
+    {"viewpointupdirection", 0x00701605},
+    {"viewposition", 0x00185101},
+    {"virtualsourceaxisdistances", 0x300A030A},
+    {"visitcomments", 0x00384000},
+    {"visitstatusid", 0x00380008},
+    {"visualacuitybotheyesopensequence", 0x00460124},
+    {"visualacuitylefteyesequence", 0x00460123},
+    {"visualacuitymeasurementsequence", 0x00240110},
+    {"visualacuitymodifiers", 0x00460135},
+    {"visualacuityrighteyesequence", 0x00460122},
+    {"visualacuitytypecodesequence", 0x00460121},
+    {"visualevaluationmethodcodesequence", 0x0028702E},
+    {"visualevaluationresultsequence", 0x00287015},
+    {"visualevaluationtestsequence", 0x00287028},
+    {"visualfieldcatchtrialsequence", 0x00240034},
+    {"visualfieldglobalresultsindexsequence", 0x00240320},
+    {"visualfieldhorizontalextent", 0x00240010},
+    {"visualfieldmeansensitivity", 0x00240070},
+    {"visualfieldshape", 0x00240012},
+    {"visualfieldtestduration", 0x00240088},
+    {"visualfieldtestnormalsflag", 0x00240063},
+    {"visualfieldtestpointnormalssequence", 0x00240097},
+    {"visualfieldtestpointsequence", 0x00240089},
+    {"visualfieldtestpointxcoordinate", 0x00240090},
+    {"visualfieldtestpointycoordinate", 0x00240091},
+    {"visualfieldtestreliabilityglobalindexsequence", 0x00240317},
+    {"visualfieldverticalextent", 0x00240011},
+    {"vitalstaincodesequencetrial", 0x004009F8},
+    {"vitreousstatuscodesequence", 0x00221025},
+    {"vitreousstatusdescription", 0x00221066},
+    {"voilutfunction", 0x00281056},
+    {"voilutsequence", 0x00283010},
+    {"voitype", 0x00720702},
+    {"volumebasedcalculationtechnique", 0x00089207},
+    {"volumecroppingmethod", 0x00701302},
+    {"volumecroppingsequence", 0x00701301},
+    {"volumeframeofreferenceuid", 0x00209312},
+    {"volumelocalizationsequence", 0x00189126},
+    {"volumelocalizationtechnique", 0x00189054},
+    {"volumeofpto", 0x40101023},
+    {"volumestreamsequence", 0x00701A08},
+    {"volumetotablemappingmatrix", 0x0020930A},
+    {"volumetotransducermappingmatrix", 0x00209309},
+    {"volumetotransducerrelationship", 0x0020930B},
+    {"volumetricannotationsequence", 0x00701901},
+    {"volumetriccurvepoints", 0x0070150D},
+    {"volumetriccurveupdirections", 0x00701A07},
+    {"volumetricpresentationinputannotationsequence", 0x00701905},
+    {"volumetricpresentationinputindex", 0x00701804},
+    {"volumetricpresentationinputnumber", 0x00701207},
+    {"volumetricpresentationinputsetsequence", 0x0070120A},
+    {"volumetricpresentationinputsetuid", 0x00701209},
+    {"volumetricpresentationstateinputsequence", 0x00701201},
+    {"volumetricproperties", 0x00089206},
+    {"vvaluedata", 0x00800011},
+    {"wadoretrievalsequence", 0x0040E023},
+    {"wadorsretrievalsequence", 0x0040E025},
+    {"warningreason", 0x00081196},
+    {"waterequivalentdiameter", 0x00181271},
+    {"waterequivalentdiametercalculationmethodcodesequence", 0x00181272},
+    {"waterreferenceacquisition", 0x00189297},
+    {"waterreferencedphasecorrection", 0x00189199},
+    {"waveformannotationsequence", 0x0040B020},
+    {"waveformbitsallocated", 0x54001004},
+    {"waveformbitsstored", 0x003A021A},
+    {"waveformchannelnumber", 0x003A0202},
+    {"waveformdata", 0x54001010},
+    {"waveformdatadisplayscale", 0x003A0230},
+    {"waveformdisplaybackgroundcielabvalue", 0x003A0231},
+    {"waveformoriginality", 0x003A0004},
+    {"waveformpaddingvalue", 0x5400100A},
+    {"waveformpresentationgroupsequence", 0x003A0240},
+    {"waveformsampleinterpretation", 0x54001006},
+    {"waveformsequence", 0x54000100},
+    {"wedgeangle", 0x300A00D5},
+    {"wedgeanglefloat", 0x00145107},
+    {"wedgechamferheight", 0x0014511D},
+    {"wedgecurve", 0x0014511E},
+    {"wedgedescription", 0x00145111},
+    {"wedgeelement1position", 0x00145109},
+    {"wedgefactor", 0x300A00D6},
+    {"wedgefrontgap", 0x00145117},
+    {"wedgefrontheight", 0x00145119},
+    {"wedgeid", 0x300A00D4},
+    {"wedgeincontactlength", 0x00145116},
+    {"wedgeincontactwidth", 0x0014511C},
+    {"wedgemanufacturername", 0x00145110},
+    {"wedgematerial", 0x0014510B},
+    {"wedgematerialvelocity", 0x0014510A},
+    {"wedgemodelnumber", 0x00145106},
+    {"wedgename", 0x0014510F},
+    {"wedgenumber", 0x300A00D2},
+    {"wedgeoffsetx", 0x00145113},
+    {"wedgeoffsety", 0x00145114},
+    {"wedgeoffsetz", 0x0014510C},
+    {"wedgeorientation", 0x300A00D8},
+    {"wedgeoriginoffsetx", 0x0014510D},
+    {"wedgeposition", 0x300A0118},
+    {"wedgepositionsequence", 0x300A0116},
+    {"wedgerearheight", 0x0014511A},
+    {"wedgeroofangle", 0x00145108},
+    {"wedgesequence", 0x300A00D1},
+    {"wedgethinedgeposition", 0x300A00DB},
+    {"wedgetimedelay", 0x0014510E},
+    {"wedgetotalheight", 0x00145118},
+    {"wedgetotallength", 0x00145115},
+    {"wedgetotalwidth", 0x0014511B},
+    {"wedgetype", 0x300A00D3},
+    {"weightinglookuptabledata", 0x00701808},
+    {"weightinglookuptabledescriptor", 0x00701807},
+    {"weightingtransferfunctionsequence", 0x00701806},
+    {"whitepointflag", 0x00287021},
+    {"wholebodytechnique", 0x00181301},
+    {"wholeslidemicroscopyimageframetypesequence", 0x00400710},
+    {"widefieldophthalmicphotographyqualityratingsequence", 0x00221525},
+    {"widefieldophthalmicphotographyqualitythresholdsequence", 0x00221526},
+    {"widefieldophthalmicphotographythresholdqualityrating", 0x00221527},
+    {"windowcenter", 0x00281050},
+    {"windowcenterwidthexplanation", 0x00281055},
+    {"windowwidth", 0x00281051},
+    {"worklistlabel", 0x00741202},
+    {"xaxrfframecharacteristicssequence", 0x00189412},
+    {"xcoordinatescenterpixelviewangle", 0x00221528},
+    {"xdsretrievalsequence", 0x0040E024},
+    {"xdsstoragesequence", 0x00404074},
+    {"xfocuscenter", 0x00181183},
+    {"xoffsetinslidecoordinatesystem", 0x0040072A},
+    {"xray3dacquisitionsequence", 0x00189507},
+    {"xray3dframetypesequence", 0x00189504},
+    {"xray3dreconstructionsequence", 0x00189530},
+    {"xrayacquisitiondosesequence", 0x00189542},
+    {"xrayfiltersequence", 0x00189556},
+    {"xraygeometrysequence", 0x00189476},
+    {"xraygridsequence", 0x00189555},
+    {"xrayimagereceptorangle", 0x3002000E},
+    {"xrayimagereceptortranslation", 0x3002000D},
+    {"xrayoutput", 0x00400312},
+    {"xrayreceptortype", 0x00189420},
+    {"xraysourceisocenterprimaryangle", 0x00189543},
+    {"xraysourceisocentersecondaryangle", 0x00189544},
+    {"xraytubecurrent", 0x00181151},
+    {"xraytubecurrentinma", 0x00189330},
+    {"xraytubecurrentinua", 0x00188151},
+    {"ycoordinatescenterpixelviewangle", 0x00221529},
+    {"yfocuscenter", 0x00181184},
+    {"yoffsetinslidecoordinatesystem", 0x0040073A},
+    {"zeffective", 0x40101019},
+    {"zerovelocitypixelvalue", 0x00189810},
+    {"zoffsetinslidecoordinatesystem", 0x0040074A},
+    {"zonalmap", 0x10100000},
+    {"zonalmapformat", 0x00280722},
+    {"zonalmaplocation", 0x00280721},
+    {"zonalmapnumberformat", 0x00280720},
+    {"zoomcenter", 0x00280032},
+    {"zoomfactor", 0x00280031}
+};
+
+#endif
@@ -0,0 +1,1159 @@
+/* --------------------------------------------------------------------------------
+ #
+ #	imebra_core_tests.cpp
+ #	the parsers and encoders of the core, on hand-built DICOM bytes
+ #	Project : Imebra
+ #
+ # --------------------------------------------------------------------------------*/
+
+#include "core/imebra_core.h"
+#include "core/tag_keywords.h"
+
+/* CHECK is also called from the threads of the session and job tests */
+static std::atomic<int> checks_failed(0);
+static std::atomic<int> checks_count(0);
+
+#define CHECK(condition) check((condition), #condition, __LINE__)
+
+static void check(bool condition, const char *text, int line){
+    
+    checks_count++;
+    
+    if(!condition)
+    {
+        checks_failed++;
+        fprintf(stderr, "line %d: CHECK(%s) failed\n", line, text);
+    }
+}
+
+#pragma mark -
+
+/* explicit VR little endian unless vr is NULL (implicit) or big_endian */
+
+static void put_u16(std::string& s, std::uint16_t value, bool big_endian){
+    
+    if(big_endian)
+    {
+        s += (char)(value >> 8);
+        s += (char)(value & 0xFF);
+    }else
+    {
+        s += (char)(value & 0xFF);
+        s += (char)(value >> 8);
+    }
+}
+
+static void put_u32(std::string& s, std::uint32_t value, bool big_endian){
+    
+    if(big_endian)
+    {
+        put_u16(s, (std::uint16_t)(value >> 16), true);
+        put_u16(s, (std::uint16_t)(value & 0xFFFF), true);
+    }else
+    {
+        put_u16(s, (std::uint16_t)(value & 0xFFFF), false);
+        put_u16(s, (std::uint16_t)(value >> 16), false);
+    }
+}
+
+static void put_header(std::string& s, std::uint32_t tag, const char *vr, std::uint32_t length, bool big_endian = false){
+    
+    put_u16(s, (std::uint16_t)(tag >> 16), big_endian);
+    put_u16(s, (std::uint16_t)(tag & 0xFFFF), big_endian);
+    
+    if(((tag >> 16) == 0xFFFE) || (!vr))
+    {
+        put_u32(s, length, big_endian);
+        return;
+    }
+    
+    s += vr;
+    
+    if((!strcmp(vr, "OB")) || (!strcmp(vr, "OW")) || (!strcmp(vr, "SQ")) || (!strcmp(vr, "UN")) || (!strcmp(vr, "UT")))
+    {
+        put_u16(s, 0, big_endian);
+        put_u32(s, length, big_endian);
+    }else
+    {
+        put_u16(s, (std::uint16_t)length, big_endian);
+    }
+}
+
+static void put_element(std::string& s, std::uint32_t tag, const char *vr, const std::string& value, bool big_endian = false){
+    
+    put_header(s, tag, vr, (std::uint32_t)value.size(), big_endian);
+    s += value;
+}
+
+static std::string padded(const char *value){
+    
+    std::string s(value);
+    
+    if(s.size() % 2)
+    {
+        s += '\0';
+    }
+    
+    return s;
+}
+
+/* preamble, DICM and the meta information group, which is always explicit little endian */
+
+static std::string fixture_meta(const char *transfer_syntax){
+    
+    std::string group;
+    put_element(group, 0x00020010, "UI", padded(transfer_syntax));
+    
+    std::string length;
+    put_u32(length, (std::uint32_t)group.size(), false);
+    
+    std::string s(128, '\0');
+    s += "DICM";
+    put_element(s, 0x00020000, "UL", length);
+    
+    return s + group;
+}
+
+static const char *explicit_little = "1.2.840.10008.1.2.1";
+
+#pragma mark -
+
+static void test_find_pixel_data_offset(){
+    
+    std::string s = fixture_meta(explicit_little);
+    put_element(s, 0x00080018, "UI", padded("1.2.34"));
+    put_element(s, 0x00280010, "US", std::string("\x02\x00", 2));
+    size_t pixel_data = s.size();
+    put_element(s, 0x7FE00010, "OW", std::string(16, '\x7F'));
+    const unsigned char *p = (const unsigned char *)s.data();
+    
+    CHECK(find_pixel_data_offset(p, s.size()) == pixel_data);
+    
+    /* truncated in a value before the pixel data, and in the pixel data header */
+    CHECK(find_pixel_data_offset(p, pixel_data - 1) == pixel_data - 1);
+    CHECK(find_pixel_data_offset(p, pixel_data + 4) == pixel_data + 4);
+    CHECK(find_pixel_data_offset(p, 100) == 100);
+    CHECK(find_pixel_data_offset(p, 0) == 0);
+    
+    /* a length past the end of the data */
+    std::string overrun = fixture_meta(explicit_little);
+    put_header(overrun, 0x00080018, "UI", 1000);
+    overrun += padded("1.2.34");
+    put_element(overrun, 0x7FE00010, "OW", std::string(16, '\x7F'));
+    CHECK(find_pixel_data_offset((const unsigned char *)overrun.data(), overrun.size()) == overrun.size());
+    
+    /* odd length: walked as written, not rounded up */
+    std::string odd = fixture_meta(explicit_little);
+    put_element(odd, 0x00080018, "UI", "1.2.3.4");
+    size_t odd_pixel_data = odd.size();
+    put_element(odd, 0x7FE00010, "OW", std::string(16, '\x7F'));
+    CHECK(find_pixel_data_offset((const unsigned char *)odd.data(), odd.size()) == odd_pixel_data);
+    
+    /* no pixel data, and a later element in its place */
+    std::string missing = fixture_meta(explicit_little);
+    put_element(missing, 0x00080018, "UI", padded("1.2.34"));
+    CHECK(find_pixel_data_offset((const unsigned char *)missing.data(), missing.size()) == missing.size());
+    put_element(missing, 0x7FE00020, "OW", std::string(4, '\0'));
+    CHECK(find_pixel_data_offset((const unsigned char *)missing.data(), missing.size()) == missing.size());
+}
+
+static void test_find_pixel_data_offset_sequences(){
+    
+    /* undefined length sequence: an item of defined length, then one of undefined length with a nested sequence */
+    std::string s = fixture_meta(explicit_little);
+    put_header(s, 0x00081140, "SQ", 0xFFFFFFFF);
+    
+    std::string item;
+    put_element(item, 0x00081155, "UI", padded("1.2.34"));
+    put_header(s, 0xFFFEE000, NULL, (std::uint32_t)item.size());
+    s += item;
+    
+    put_header(s, 0xFFFEE000, NULL, 0xFFFFFFFF);
+    put_element(s, 0x00081150, "UI", padded("1.2.3"));
+    put_header(s, 0x00082112, "SQ", 0xFFFFFFFF);
+    put_header(s, 0xFFFEE000, NULL, 0xFFFFFFFF);
+    put_element(s, 0x00081155, "UI", padded("1.2.35"));
+    put_header(s, 0xFFFEE00D, NULL, 0);
+    put_header(s, 0xFFFEE0DD, NULL, 0);
+    put_header(s, 0xFFFEE00D, NULL, 0);
+    
+    put_header(s, 0xFFFEE0DD, NULL, 0);
+    
+    put_element(s, 0x00280010, "US", std::string("\x02\x00", 2));
+    size_t pixel_data = s.size();
+    put_element(s, 0x7FE00010, "OW", std::string(16, '\x7F'));
+    
+    CHECK(find_pixel_data_offset((const unsigned char *)s.data(), s.size()) == pixel_data);
+    
+    /* no sequence delimitation item: the walk runs out of data */
+    std::string open = s.substr(0, s.find(std::string("\xFE\xFF\xDD\xE0", 4)));
+    put_element(open, 0x7FE00010, "OW", std::string(16, '\x7F'));
+    CHECK(find_pixel_data_offset((const unsigned char *)open.data(), open.size()) == open.size());
+    
+    /* something other than an item inside the sequence */
+    std::string bad = fixture_meta(explicit_little);
+    put_header(bad, 0x00081140, "SQ", 0xFFFFFFFF);
+    put_element(bad, 0x00081155, "UI", padded("1.2.34"));
+    put_header(bad, 0xFFFEE0DD, NULL, 0);
+    put_element(bad, 0x7FE00010, "OW", std::string(16, '\x7F'));
+    CHECK(find_pixel_data_offset((const unsigned char *)bad.data(), bad.size()) == bad.size());
+}
+
+static void test_find_pixel_data_offset_syntaxes(){
+    
+    /* implicit VR without preamble or meta information */
+    std::string implicit;
+    put_element(implicit, 0x00080018, NULL, padded("1.2.34"));
+    put_element(implicit, 0x00280010, NULL, std::string("\x02\x00", 2));
+    size_t pixel_data = implicit.size();
+    put_element(implicit, 0x7FE00010, NULL, std::string(16, '\x7F'));
+    CHECK(find_pixel_data_offset((const unsigned char *)implicit.data(), implicit.size()) == pixel_data);
+    
+    /* implicit VR named in the meta information */
+    std::string meta = fixture_meta("1.2.840.10008.1.2");
+    size_t offset = meta.size();
+    meta += implicit;
+    CHECK(find_pixel_data_offset((const unsigned char *)meta.data(), meta.size()) == offset + pixel_data);
+    
+    /* explicit VR big endian */
+    std::string big = fixture_meta("1.2.840.10008.1.2.2");
+    put_element(big, 0x00080018, "UI", padded("1.2.34"), true);
+    put_element(big, 0x00280010, "US", std::string("\x00\x02", 2), true);
+    size_t big_pixel_data = big.size();
+    put_element(big, 0x7FE00010, "OW", std::string(16, '\x7F'), true);
+    CHECK(find_pixel_data_offset((const unsigned char *)big.data(), big.size()) == big_pixel_data);
+    
+    /* deflated: nothing to walk */
+    std::string deflated = fixture_meta("1.2.840.10008.1.2.1.99");
+    deflated += std::string(32, '\x55');
+    CHECK(find_pixel_data_offset((const unsigned char *)deflated.data(), deflated.size()) == deflated.size());
+}
+
+static void test_get_instance_key(){
+    
+    std::string s = fixture_meta(explicit_little);
+    put_element(s, 0x00080016, "UI", padded("1.2.840.10008.5.1.4.1.1.7"));
+    put_element(s, 0x00080018, "UI", padded("1.2.345"));
+    put_element(s, 0x7FE00010, "OW", std::string(16, '\x7F'));
+    
+    element_source_t source = {(const unsigned char *)s.data(), NULL, s.size()};
+    std::string key;
+    get_instance_key(source, key);
+    CHECK(key == ":1.2.345:1.2.840.10008.1.2.1");
+    
+    std::string implicit;
+    put_element(implicit, 0x00080018, NULL, "1.2.34  ");
+    element_source_t implicit_source = {(const unsigned char *)implicit.data(), NULL, implicit.size()};
+    get_instance_key(implicit_source, key);
+    CHECK(key == ":1.2.34:");
+    
+    std::string none = fixture_meta(explicit_little);
+    put_element(none, 0x7FE00010, "OW", std::string(16, '\x7F'));
+    element_source_t none_source = {(const unsigned char *)none.data(), NULL, none.size()};
+    get_instance_key(none_source, key);
+    CHECK(key == "::1.2.840.10008.1.2.1");
+}
+
+#pragma mark -
+
+static const char *fixture_file = "imebra_core_tests.dcm";
+
+static bool write_fixture(const std::string& s){
+    
+    FILE *f = fopen(fixture_file, "wb");
+    
+    if(!f)
+        return false;
+    
+    bool written = fwrite(s.data(), 1, s.size(), f) == s.size();
+    
+    return (fclose(f) == 0) && written;
+}
+
+static bool read_prefix(std::uint32_t tag, size_t buffer, size_t limit, std::string& bytes){
+    
+    std::string name(fixture_file);
+    
+    return read_element_prefix(path_t(name.begin(), name.end()), tag, buffer, limit, bytes);
+}
+
+static void test_read_element_prefix(){
+    
+    std::string bytes;
+    
+    std::string s = fixture_meta(explicit_little);
+    put_element(s, 0x00080018, "UI", padded("1.2.34"));
+    put_element(s, 0x00420011, "OB", "0123456789ab");
+    put_element(s, 0x7FE00010, "OW", "pixels");
+    CHECK(write_fixture(s));
+    
+    CHECK(read_prefix(0x00420011, 0, 4, bytes) && (bytes == "0123"));
+    CHECK(read_prefix(0x00420011, 0, 100, bytes) && (bytes == "0123456789ab"));
+    CHECK(read_prefix(0x00420011, 0, 0, bytes) && (bytes.empty()));
+    CHECK(read_prefix(0x7FE00010, 0, 100, bytes) && (bytes == "pixels"));
+    CHECK(!read_prefix(0x00420011, 1, 100, bytes));
+    CHECK(!read_prefix(0x00100010, 0, 100, bytes));
+    
+    /* encapsulated: buffer 0 is the offset table, the fragments follow */
+    std::string encapsulated = fixture_meta("1.2.840.10008.1.2.4.50");
+    put_header(encapsulated, 0x7FE00010, "OB", 0xFFFFFFFF);
+    put_header(encapsulated, 0xFFFEE000, NULL, 0);
+    put_element(encapsulated, 0xFFFEE000, NULL, "ABCD");
+    put_element(encapsulated, 0xFFFEE000, NULL, "EFGH");
+    put_header(encapsulated, 0xFFFEE0DD, NULL, 0);
+    CHECK(write_fixture(encapsulated));
+    
+    CHECK(read_prefix(0x7FE00010, 0, 100, bytes) && (bytes.empty()));
+    CHECK(read_prefix(0x7FE00010, 1, 2, bytes) && (bytes == "AB"));
+    CHECK(read_prefix(0x7FE00010, 2, 100, bytes) && (bytes == "EFGH"));
+    CHECK(!read_prefix(0x7FE00010, 3, 100, bytes));
+    
+    /* big endian values are swapped by imebra, not here */
+    std::string big = fixture_meta("1.2.840.10008.1.2.2");
+    put_element(big, 0x00420011, "OB", "0123", true);
+    CHECK(write_fixture(big));
+    CHECK(!read_prefix(0x00420011, 0, 100, bytes));
+    
+    remove(fixture_file);
+    
+    CHECK(!read_prefix(0x00420011, 0, 100, bytes));
+}
+
+/* path, size and dates; the instance only while the dates are too recent to tell two versions apart */
+
+static void test_get_cache_key(){
+    
+    std::string s = fixture_meta(explicit_little);
+    put_element(s, 0x00080018, "UI", padded("1.2.345"));
+    put_element(s, 0x7FE00010, "OW", std::string(16, '\x7F'));
+    CHECK(write_fixture(s));
+    
+    std::string name(fixture_file);
+    path_t path(name.begin(), name.end());
+    std::string key, again;
+    
+    get_cache_key(path, key);
+    CHECK((key.find("file:" + name + ":") == 0) && (key.find(":1.2.345:") != std::string::npos));
+    get_cache_key(path, again);
+    CHECK(again == key);
+    
+    std::this_thread::sleep_for(std::chrono::seconds(CACHE_KEY_SETTLED));
+    
+    /* settled: the file is not opened any more */
+    get_cache_key(path, again);
+    CHECK((again.length()) && (again.find("1.2.345") == std::string::npos) && (key.find(again) == 0));
+    
+#if !defined(_WIN32)
+    /* replaced by another file of the same size: another inode */
+    std::string other = fixture_meta(explicit_little);
+    put_element(other, 0x00080018, "UI", padded("1.2.346"));
+    put_element(other, 0x7FE00010, "OW", std::string(16, '\x7F'));
+    FILE *f = fopen("imebra_core_tests.tmp", "wb");
+    CHECK(f != NULL);
+    if(f)
+    {
+        CHECK((fwrite(other.data(), 1, other.size(), f) == other.size()) && (fclose(f) == 0));
+        CHECK(rename("imebra_core_tests.tmp", fixture_file) == 0);
+        std::string replaced;
+        get_cache_key(path, replaced);
+        CHECK((replaced.length()) && (replaced.find(again) != 0));
+    }
+#endif
+    
+    remove(fixture_file);
+    
+    get_cache_key(path, key);
+    CHECK(key.empty());
+}
+
+#pragma mark -
+
+/* 3 frames in 4 fragments, at 0, 12, 24 and 36 from the first fragment item; the second frame has 2 */
+
+static std::string fixture_fragments(const std::string& offset_table, bool third_is_codestream){
+    
+    std::string s = fixture_meta("1.2.840.10008.1.2.4.50");
+    put_element(s, 0x00280008, "IS", "3 ");
+    put_header(s, 0x7FE00010, "OB", 0xFFFFFFFF);
+    put_element(s, 0xFFFEE000, NULL, offset_table);
+    put_element(s, 0xFFFEE000, NULL, std::string("\xFF\xD8\x00\x01", 4));
+    put_element(s, 0xFFFEE000, NULL, std::string("\xFF\xD8\x00\x02", 4));
+    put_element(s, 0xFFFEE000, NULL, third_is_codestream ? std::string("\xFF\xD8\x00\x03", 4) : std::string("\x00\x03\x00\x03", 4));
+    put_element(s, 0xFFFEE000, NULL, std::string("\xFF\xD8\x00\x04", 4));
+    put_header(s, 0xFFFEE0DD, NULL, 0);
+    
+    return s;
+}
+
+static std::string offset_table(const std::uint32_t *offsets, size_t count){
+    
+    std::string s;
+    
+    for(size_t i = 0; i < count; ++i)
+    {
+        put_u32(s, offsets[i], false);
+    }
+    
+    return s;
+}
+
+/* "first-end" of each frame, "" when there is no index */
+
+static std::string get_fragments(const std::string& bytes, const std::string& extended_offset_table){
+    
+    imebra::ReadMemory mem(bytes.data(), bytes.size());
+    std::unique_ptr<imebra::DataSet> data(load_dataset(mem));
+    
+    if(extended_offset_table.size())
+    {
+        std::unique_ptr<imebra::WritingDataHandlerNumeric> handler(data->getWritingDataHandlerRaw(imebra::TagId(0x7FE0, 0x0001), 0, imebra::tagVR_t::OB));
+        handler->assign(extended_offset_table.data(), extended_offset_table.size());
+    }
+    
+    windowing_t windowing;
+    windowing.fragments = std::make_shared<fragment_index_t>();
+    windowing.fragments->ready = false;
+    
+    std::string frames;
+    size_t first, last;
+    
+    for(size_t page = 0; get_frame_fragments(data.get(), page, windowing, &first, &last); ++page)
+    {
+        char range[32];
+        snprintf(range, sizeof(range), "%s%lu-%lu", page ? "," : "", (unsigned long)first, (unsigned long)last);
+        frames += range;
+    }
+    
+    return frames;
+}
+
+static void test_fragment_index(){
+    
+    static const std::uint32_t valid[] = {0, 12, 36};
+    static const std::uint32_t unaligned[] = {0, 13, 36};
+    static const std::uint32_t unordered[] = {0, 36, 12};
+    static const std::uint64_t extended[] = {0, 12, 36};
+    
+    const std::string expected = "1-2,2-4,4-5";
+    
+    /* empty table: the first bytes of each fragment */
+    CHECK(get_fragments(fixture_fragments(std::string(), false), std::string()) == expected);
+    CHECK(get_fragments(fixture_fragments(std::string(), true), std::string()) == "");
+    
+    /* basic offset table, also where a scan would find 4 codestreams */
+    CHECK(get_fragments(fixture_fragments(offset_table(valid, 3), true), std::string()) == expected);
+    
+    /* corrupt or short table: the scan */
+    CHECK(get_fragments(fixture_fragments(offset_table(unaligned, 3), false), std::string()) == expected);
+    CHECK(get_fragments(fixture_fragments(offset_table(unordered, 3), false), std::string()) == expected);
+    CHECK(get_fragments(fixture_fragments(offset_table(valid, 2), false), std::string()) == expected);
+    CHECK(get_fragments(fixture_fragments(offset_table(unaligned, 3), true), std::string()) == "");
+    
+    /* extended offset table first, checked like the basic one */
+    std::string eot;
+    for(size_t i = 0; i < 3; ++i)
+    {
+        put_u32(eot, (std::uint32_t)(extended[i] & 0xFFFFFFFF), false);
+        put_u32(eot, (std::uint32_t)(extended[i] >> 32), false);
+    }
+    CHECK(get_fragments(fixture_fragments(std::string(), true), eot) == expected);
+    CHECK(get_fragments(fixture_fragments(offset_table(unaligned, 3), true), eot) == expected);
+    CHECK(get_fragments(fixture_fragments(std::string(), true), eot.substr(0, 16)) == "");
+    CHECK(get_fragments(fixture_fragments(offset_table(valid, 3), true), eot.substr(0, 16)) == expected);
+}
+
+#pragma mark -
+
+static void test_tag_path(){
+    
+    std::uint32_t tag = 0;
+    
+    CHECK(get_tag_keyword("PatientName", &tag) && (tag == 0x00100010));
+    CHECK(get_tag_keyword("PATIENTNAME", &tag) && (tag == 0x00100010));
+    CHECK(get_tag_keyword("abortflag", &tag) && (tag == 0x40101024));
+    CHECK(!get_tag_keyword("PatientNam", &tag));
+    CHECK(!get_tag_keyword("", &tag));
+    
+    /* the table must stay sorted for the binary search */
+    bool sorted = true;
+    for(size_t i = 1; i < sizeof(tag_keywords) / sizeof(tag_keywords[0]); ++i)
+    {
+        sorted = sorted && (strcmp(tag_keywords[i - 1].keyword, tag_keywords[i].keyword) < 0);
+    }
+    CHECK(sorted);
+    
+    tag_path_t path;
+    
+    CHECK(get_tag_path("(0008,1140)[2].ReferencedSOPInstanceUID", &path));
+    CHECK(path.size() == 2);
+    if(path.size() == 2)
+    {
+        CHECK(path[0].name == "(0008,1140)");
+        CHECK((path[0].group == 0x0008) && (path[0].element == 0x1140) && (path[0].item == 2));
+        CHECK(path[1].name == "ReferencedSOPInstanceUID");
+        CHECK((path[1].group == 0x0008) && (path[1].element == 0x1155) && (path[1].item == -1));
+    }
+    
+    CHECK(get_tag_path("00081140[*].0008,1155", &path) && (path.size() == 2) && (path[0].item == -1) && (path[1].element == 0x1155));
+    CHECK(get_tag_path("referencedimagesequence[].7fe00010", &path) && (path.size() == 2) && (path[0].item == -1) && (path[1].group == 0x7FE0));
+    
+    CHECK(!get_tag_path("", &path));
+    CHECK(!get_tag_path("PatientName.", &path));
+    CHECK(!get_tag_path(".PatientName", &path));
+    CHECK(!get_tag_path("(0008,1140)[2", &path));
+    CHECK(!get_tag_path("(0008,1140)[-1]", &path));
+    CHECK(!get_tag_path("(0008,1140)[1x]", &path));
+    CHECK(!get_tag_path("0008114", &path));
+    CHECK(!get_tag_path("0008114G", &path));
+}
+
+static void test_encoding(){
+    
+    static const unsigned char bytes[] = {0x00, 0x7F, 0xAB, 0xFF};
+    std::string s;
+    
+    bytes_to_hex(bytes, sizeof(bytes), s);
+    CHECK(s == "007fabff");
+    bytes_to_hex(bytes, 0, s);
+    CHECK(s.empty());
+    
+    /* RFC 4648 10 */
+    static const char *base64[][2] = {
+        {"", ""}, {"f", "Zg=="}, {"fo", "Zm8="}, {"foo", "Zm9v"},
+        {"foob", "Zm9vYg=="}, {"fooba", "Zm9vYmE="}, {"foobar", "Zm9vYmFy"}};
+    
+    for(size_t i = 0; i < sizeof(base64) / sizeof(base64[0]); ++i)
+    {
+        bytes_to_base64((const unsigned char *)base64[i][0], strlen(base64[i][0]), s);
+        CHECK(s == base64[i][1]);
+    }
+    
+    bytes_to_base64(bytes, sizeof(bytes), s);
+    CHECK(s == "AH+r/w==");
+    
+    CHECK(xxh64("", 0, 0) == 0xEF46DB3751D8E999ULL);
+    CHECK(xxh64("a", 1, 0) == 0xD24EC4F1A98C6E5BULL);
+    CHECK(xxh64("abc", 3, 0) == 0x44BC2CF5AD770999ULL);
+}
+
+#pragma mark -
+
+static void test_json_values(){
+    
+    std::string json;
+    
+    json_append_string(L"a\"b\\\n\t\x01\x00E9\x4E2D", json);
+    CHECK(json == "\"a\\\"b\\\\\\n\\t\\u0001\xC3\xA9\xE4\xB8\xAD\"");
+    
+    /* a surrogate pair where wchar_t is UTF-16, one code point elsewhere */
+    json.clear();
+    json_append_string(sizeof(wchar_t) == 2 ? std::wstring(L"\xD83D\xDE00") : std::wstring(1, (wchar_t)0x1F600), json);
+    CHECK(json == "\"\xF0\x9F\x98\x80\"");
+    
+    json.clear();
+    json_append_utf8("a\"\\\x01\xC3\xA9", json);
+    CHECK(json == "\"a\\\"\\\\\\u0001\xC3\xA9\"");
+    
+    json.clear();
+    json_append_number(512, json);
+    json += ',';
+    json_append_number(-2.5, json);
+    json += ',';
+    json_append_number(0.1, json);
+    json += ',';
+    json_append_number(std::nan(""), json);
+    json += ',';
+    json_append_number(HUGE_VAL, json);
+    CHECK(json == "512,-2.5,0.10000000000000001,null,null");
+    
+    json.clear();
+    json_append_person_name(L"Doe^John", json);
+    CHECK(json == "{\"Alphabetic\":\"Doe^John\"}");
+    
+    json.clear();
+    json_append_person_name(L"Doe^John=Yamada^Taro=", json);
+    CHECK(json == "{\"Alphabetic\":\"Doe^John\",\"Ideographic\":\"Yamada^Taro\"}");
+    
+    json.clear();
+    json_append_person_name(L"=Yamada=yamada", json);
+    CHECK(json == "{\"Ideographic\":\"Yamada\",\"Phonetic\":\"yamada\"}");
+    
+    json.clear();
+    json_append_person_name(L"", json);
+    CHECK(json == "{}");
+}
+
+static void test_get_json(){
+    
+    imebra::DataSet data;
+    data.setString(imebra::TagId(imebra::tagId_t::PatientName_0010_0010), "Doe^John=Yamada^Taro");
+    data.setString(imebra::TagId(imebra::tagId_t::StudyDescription_0008_1030), "say \"hi\"");
+    data.setUnsignedLong(imebra::TagId(imebra::tagId_t::Rows_0028_0010), 512);
+    data.setDouble(imebra::TagId(imebra::tagId_t::SliceThickness_0018_0050), 2.5);
+    
+    {
+        std::unique_ptr<imebra::WritingDataHandlerNumeric> handler(data.getWritingDataHandlerRaw(imebra::TagId(imebra::tagId_t::PixelData_7FE0_0010), 0, imebra::tagVR_t::OB));
+        handler->assign("\x01\x02", 2);
+    }
+    
+    imebra::DataSet item;
+    item.setString(imebra::TagId(imebra::tagId_t::ReferencedSOPInstanceUID_0008_1155), "1.2.34");
+    {
+        std::unique_ptr<imebra::WritingDataHandlerNumeric> handler(item.getWritingDataHandlerRaw(imebra::TagId(imebra::tagId_t::EncapsulatedDocument_0042_0011), 0, imebra::tagVR_t::OB));
+        handler->assign("%PDF", 4);
+    }
+    data.setSequenceItem(imebra::TagId(imebra::tagId_t::ReferencedImageSequence_0008_1140), 0, item);
+    data.setSequenceItem(imebra::TagId(imebra::tagId_t::ReferencedImageSequence_0008_1140), 1, item);
+    
+    std::string json;
+    get_json(&data, "http://host/bulk/", std::string(), json);
+    
+    CHECK((json.size() > 2) && (json[0] == '{') && (json[json.size() - 1] == '}'));
+    CHECK(json.find("\"00100010\":{\"vr\":\"PN\",\"Value\":[{\"Alphabetic\":\"Doe^John\",\"Ideographic\":\"Yamada^Taro\"}]}") != std::string::npos);
+    CHECK(json.find("\"00081030\":{\"vr\":\"LO\",\"Value\":[\"say \\\"hi\\\"\"]}") != std::string::npos);
+    CHECK(json.find("\"00280010\":{\"vr\":\"US\",\"Value\":[512]}") != std::string::npos);
+    CHECK(json.find("\"00180050\":{\"vr\":\"DS\",\"Value\":[2.5]}") != std::string::npos);
+    CHECK(json.find("\"7FE00010\":{\"vr\":\"OB\",\"BulkDataURI\":\"http://host/bulk/7FE00010\"}") != std::string::npos);
+    CHECK(json.find("\"00081140\":{\"vr\":\"SQ\",\"Value\":[{") != std::string::npos);
+    CHECK(json.find("\"00081155\":{\"vr\":\"UI\",\"Value\":[\"1.2.34\"]}") != std::string::npos);
+    CHECK(json.find("\"BulkDataURI\":\"http://host/bulk/00081140/0/00420011\"") != std::string::npos);
+    CHECK(json.find("\"BulkDataURI\":\"http://host/bulk/00081140/1/00420011\"") != std::string::npos);
+    
+    /* tags in ascending order */
+    CHECK(json.find("\"00081030\"") < json.find("\"00081140\""));
+    CHECK(json.find("\"00280010\"") < json.find("\"7FE00010\""));
+}
+
+#pragma mark -
+
+/* the least recently used frame goes first, whichever shard it is in */
+
+static void test_frame_cache(){
+    
+    size_t budget = frame_cache.budget;
+    frame_cache.budget = 3 * 64 * 64;
+    
+    static const char *keys[] = {"blob:a", "blob:b", "blob:c", "blob:d"};
+    
+    for(size_t i = 0; i < 4; ++i)
+    {
+        if(i == 3)
+        {
+            CHECK(frame_cache_get(keys[0], std::string(keys[0]) + "/0/s") != NULL);
+        }
+        
+        std::shared_ptr<imebra::Image> image(new imebra::Image(64, 64, imebra::bitDepth_t::depthU8, "MONOCHROME2", 7));
+        frame_cache_put(keys[i], std::string(keys[i]) + "/0/s", image);
+    }
+    
+    CHECK(frame_cache.bytes == 3 * 64 * 64);
+    CHECK(frame_cache_get(keys[0], std::string(keys[0]) + "/0/s") != NULL);
+    CHECK(frame_cache_get(keys[1], std::string(keys[1]) + "/0/s") == NULL);
+    CHECK(frame_cache_get(keys[2], std::string(keys[2]) + "/0/s") != NULL);
+    CHECK(frame_cache_get(keys[3], std::string(keys[3]) + "/0/s") != NULL);
+    
+    frame_cache_trim(0);
+    CHECK(frame_cache.bytes == 0);
+    
+    frame_cache.budget = budget;
+}
+
+#pragma mark -
+
+/* the work pool, the buffer pool, Imebra Open/Render/Close and Start/Poll/Collect job from several threads; configure with -DIMEBRA_SANITIZE=thread to have the races reported */
+
+#define STRESS_THREADS 8
+#define STRESS_ROUNDS 100
+
+/* calls from several threads share the same helper threads; each task runs once, and the threads outlive the calls */
+
+static void test_work_pool(){
+    
+    std::vector<std::thread> threads;
+    
+    for(size_t t = 0; t < STRESS_THREADS; ++t)
+    {
+        threads.push_back(std::thread([t]() {
+            
+            for(size_t i = 0; i < STRESS_ROUNDS; ++i)
+            {
+                std::vector<std::atomic<int> > done(16);
+                
+                work_pool_t pool;
+                work_pool_init(&pool, (unsigned int)(1 + (t + i) % 4));
+                
+                /* like run_batch: each task pushes more tasks on the queue of the worker running it */
+                for(size_t task = 0; task < 4; ++task)
+                {
+                    work_pool_push(&pool, task, [&pool, &done, task](size_t worker) {
+                        
+                        done[task]++;
+                        
+                        for(size_t more = 1; more < 4; ++more)
+                        {
+                            std::atomic<int> *count = &done[task + more * 4];
+                            work_pool_push(&pool, worker, [count](size_t) { (*count)++; });
+                        }
+                    });
+                }
+                
+                work_pool_run(&pool);
+                
+                bool once = true;
+                for(size_t j = 0; j < done.size(); ++j)
+                {
+                    once = once && (done[j] == 1);
+                }
+                CHECK(once);
+            }
+        }));
+    }
+    
+    for(size_t t = 0; t < threads.size(); ++t)
+    {
+        threads[t].join();
+    }
+    
+    size_t started = work_threads.count;
+    CHECK((started > 0) && (started <= STRESS_THREADS * 3));
+    
+    /* a later call takes the free threads instead of starting new ones */
+    work_pool_t pool;
+    work_pool_init(&pool, 4);
+    std::atomic<int> done(0);
+    for(size_t task = 0; task < 8; ++task)
+    {
+        work_pool_push(&pool, task, [&done](size_t) { done++; });
+    }
+    work_pool_run(&pool);
+    CHECK((done == 8) && (work_threads.count == started));
+    
+    work_threads_stop();
+    CHECK(work_threads.count == 0);
+}
+
+/* a thread reuses its own block; its blocks go to the shared tier when it exits; a flush reaches every thread */
+
+static void test_buffer_pool(){
+    
+    buffer_pool_flush();
+    
+    void *p = buffer_pool_acquire(100000);
+    buffer_pool_release(p, 100000);
+    std::uint64_t hits = buffer_pool.thread_hits;
+    CHECK(buffer_pool_acquire(100000) == p);
+    CHECK(buffer_pool.thread_hits == hits + 1);
+    buffer_pool_release(p, 100000);
+    
+    std::thread([]() {
+        
+        buffer_pool_release(buffer_pool_acquire(200000), 200000);
+    }).join();
+    
+    /* 200000 bytes are in the 224KB class; the shared tier's lock is a wait in the statistics and the trace */
+    CHECK(buffer_pool.shared_bytes == 224 * 1024);
+    hits = buffer_pool.shared_hits;
+    stage_statistics_values_t waits;
+    statistics_collect(false, stage_wait, false, &waits);
+    std::uint64_t calls = waits.calls;
+    p = buffer_pool_acquire(200000);
+    CHECK((buffer_pool.shared_hits == hits + 1) && (buffer_pool.shared_bytes == 0));
+    statistics_collect(false, stage_wait, false, &waits);
+    CHECK(waits.calls == calls + 1);
+    buffer_pool_release(p, 200000);
+    
+    /* a thread that keeps its blocks while another one flushes */
+    std::mutex mutex;
+    std::condition_variable wake;
+    int step = 0;
+    
+    std::thread keeper([&mutex, &wake, &step]() {
+        
+        buffer_pool_release(buffer_pool_acquire(300000), 300000);
+        
+        std::unique_lock<std::mutex> lock(mutex);
+        step = 1;
+        wake.notify_all();
+        wake.wait(lock, [&step] { return step == 2; });
+    });
+    
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        wake.wait(lock, [&step] { return step == 1; });
+    }
+    
+    CHECK(buffer_pool.thread_bytes > 0);
+    buffer_pool_flush();
+    CHECK((buffer_pool.thread_bytes == 0) && (buffer_pool.shared_bytes == 0));
+    
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        step = 2;
+        wake.notify_all();
+    }
+    keeper.join();
+    CHECK(buffer_pool.shared_bytes == 0);
+    
+    /* acquire, release and flush from several threads, for -DIMEBRA_SANITIZE=thread */
+    std::vector<std::thread> threads;
+    
+    for(size_t t = 0; t < STRESS_THREADS; ++t)
+    {
+        threads.push_back(std::thread([t]() {
+            
+            for(size_t i = 0; i < STRESS_ROUNDS * 10; ++i)
+            {
+                size_t size = 0x10000 + ((t + i) % 8) * 0x8000;
+                void *block = buffer_pool_acquire(size);
+                memset(block, 0, size);
+                buffer_pool_release(block, size);
+                
+                if(i % 100 == t)
+                {
+                    buffer_pool_flush();
+                }
+            }
+        }));
+    }
+    
+    for(size_t t = 0; t < threads.size(); ++t)
+    {
+        threads[t].join();
+    }
+    
+    buffer_pool_flush();
+    CHECK((buffer_pool.thread_bytes == 0) && (buffer_pool.shared_bytes == 0));
+}
+
+static void test_sessions(){
+    
+    static const char *keys[] = {"blob:a", "blob:b", "blob:c", "", "fail"};
+    const size_t keys_count = sizeof(keys) / sizeof(keys[0]);
+    
+    std::atomic<int> loads(0);
+    
+    std::function<bool(session_t *)> load = [&loads](session_t *session) -> bool {
+        
+        loads++;
+        std::this_thread::yield();
+        session->frames_count = 1;
+        
+        return session->key != "fail";
+    };
+    
+    /* the same input is one session, with a reference per open */
+    std::int32_t id = open_session(keys[0], 0, load);
+    CHECK((id != 0) && (open_session(keys[0], 0, load) == id) && (loads == 1));
+    close_session(id);
+    CHECK(get_session(id) != NULL);
+    close_session(id);
+    CHECK(get_session(id) == NULL);
+    
+    CHECK(open_session(keys[4], 0, load) == 0);
+    
+    std::vector<std::thread> threads;
+    
+    for(size_t t = 0; t < STRESS_THREADS; ++t)
+    {
+        threads.push_back(std::thread([t, &load, keys_count]() {
+            
+            for(size_t i = 0; i < STRESS_ROUNDS; ++i)
+            {
+                std::string key = keys[(t + i) % keys_count];
+                
+                std::int32_t id = open_session(key, 0, load);
+                
+                if(key == "fail")
+                {
+                    CHECK(id == 0);
+                    continue;
+                }
+                
+                std::shared_ptr<session_t> session = get_session(id);
+                CHECK((session) && (session->key == key) && (session->frames_count == 1));
+                
+                if((session) && (key.length()))
+                {
+                    /* what Imebra Render looks up for the frames of the session */
+                    CHECK(frame_cache_get(session->key, session->key + "/render") == NULL);
+                }
+                
+                close_session(id);
+            }
+        }));
+    }
+    
+    for(size_t t = 0; t < threads.size(); ++t)
+    {
+        threads[t].join();
+    }
+    
+    /* every session has been closed as often as it was opened */
+    int before = loads;
+    id = open_session(keys[1], 0, load);
+    CHECK((id != 0) && (loads == before + 1));
+    
+    close_sessions();
+    CHECK(get_session(id) == NULL);
+    
+    /* an idle session is released on time by the sweeper, without another call */
+    std::atomic<bool> released(false);
+    
+    std::function<bool(session_t *)> load_timed = [&released](session_t *session) -> bool {
+        
+        /* a LUT that only tells when the session lets it go */
+        session->windowing.luts.push_back(std::shared_ptr<imebra::LUT>((imebra::LUT *)NULL, [&released](imebra::LUT *) { released = true; }));
+        session->frames_count = 1;
+        
+        return true;
+    };
+    
+    id = open_session(keys[2], 1, load_timed);
+    CHECK(id != 0);
+    
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    CHECK(!released);
+    
+    for(size_t i = 0; (i < 30) && (!released); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    CHECK(released);
+    
+    close_sessions();
+}
+
+static void get_test_request(request_options_t *request){
+    
+    request->image_options.format = image_format_png;
+    request->image_options.jpeg_quality = 0;
+    request->image_options.png_level = 1;
+    request->image_options.wbmp_fg = -1;
+    request->image_options.webp_quality = -1;
+    request->image_options.bmp_compression = 0;
+    request->image_options.max_width = 0;
+    request->image_options.max_height = 0;
+    request->image_options.output = output_image;
+    request->image_options.rescale = false;
+    
+    request->export_tags = false;
+    request->use_tag_list = false;
+    request->json_output = json_none;
+    
+    request->frame_selection.list = false;
+    request->frame_selection.start = 0;
+    request->frame_selection.stride = 1;
+    request->frame_selection.count = -1;
+    
+    request->max_size_buffer_load = FILE_BUFFER_LOAD;
+    request->cache = false;
+    request->threads = 2;
+    request->profile = false;
+}
+
+/* 2 frames of 8x8 MONOCHROME2, 8 bits */
+
+static std::string fixture_image(){
+    
+    std::string s = fixture_meta(explicit_little);
+    put_element(s, 0x00280002, "US", std::string("\x01\x00", 2));
+    put_element(s, 0x00280004, "CS", "MONOCHROME2 ");
+    put_element(s, 0x00280008, "IS", "2 ");
+    put_element(s, 0x00280010, "US", std::string("\x08\x00", 2));
+    put_element(s, 0x00280011, "US", std::string("\x08\x00", 2));
+    put_element(s, 0x00280100, "US", std::string("\x08\x00", 2));
+    put_element(s, 0x00280101, "US", std::string("\x08\x00", 2));
+    put_element(s, 0x00280102, "US", std::string("\x07\x00", 2));
+    put_element(s, 0x00280103, "US", std::string("\x00\x00", 2));
+    
+    std::string pixels;
+    for(size_t i = 0; i < 2 * 8 * 8; ++i)
+    {
+        pixels += (char)(i * 2);
+    }
+    put_element(s, 0x7FE00010, "OB", pixels);
+    
+    return s;
+}
+
+static void test_jobs(){
+    
+    std::string image = fixture_image();
+    std::string missing("imebra_core_tests_missing.dcm");
+    
+    std::atomic<std::int32_t> first(0x7FFFFFFF), last(0);
+    std::atomic<int> started(0), collected(0);
+    
+    std::vector<std::thread> threads;
+    
+    for(size_t t = 0; t < STRESS_THREADS; ++t)
+    {
+        threads.push_back(std::thread([t, &image, &missing, &first, &last, &started, &collected]() {
+            
+            for(size_t i = 0; i < (STRESS_ROUNDS / 10); ++i)
+            {
+                std::shared_ptr<job_t> job(new job_t);
+                get_test_request(&job->request);
+                
+                for(size_t item = 0; item < 3; ++item)
+                {
+                    batch_item_t batch_item;
+                    batch_item.memory.reset(new imebra::ReadMemory(image.data(), image.size()));
+                    job->items.push_back(batch_item);
+                }
+                
+                batch_item_t batch_item;
+                batch_item.path = path_t(missing.begin(), missing.end());
+                job->items.push_back(batch_item);
+                
+                std::int32_t id = start_job(job);
+                started++;
+                
+                std::int32_t n = first;
+                while((id < n) && (!first.compare_exchange_weak(n, id)));
+                n = last;
+                while((id > n) && (!last.compare_exchange_weak(n, id)));
+                
+                /* Imebra Poll job and Imebra Cancel job */
+                std::shared_ptr<job_t> polled = get_job(id);
+                CHECK(polled == job);
+                if(polled)
+                {
+                    CHECK((polled->items.size() == 4) && (polled->progress.frames_done <= polled->progress.frames_total));
+                    if((t + i) % 3 == 0)
+                    {
+                        polled->progress.cancel = true;
+                    }
+                }
+                
+                /* a job started by another thread, if it is there; then this one, if it is still there */
+                std::shared_ptr<job_t> other = collect_job(id + 1);
+                if(other)
+                {
+                    collected++;
+                    CHECK((other->done) && (other->results.size() == 4));
+                }
+                
+                std::shared_ptr<job_t> collected_job = collect_job(id);
+                if(collected_job)
+                {
+                    collected++;
+                    CHECK((collected_job->done) && (collected_job->results.size() == 4));
+                    CHECK(collected_job->results[3].error.length());
+                    
+                    if(!collected_job->progress.cancel)
+                    {
+                        CHECK((collected_job->results[0].frames.size() == 2) && (collected_job->results[0].frames[1].decoded));
+                        CHECK(collected_job->progress.frames_done == 6);
+                    }
+                }
+            }
+        }));
+    }
+    
+    for(size_t t = 0; t < threads.size(); ++t)
+    {
+        threads[t].join();
+    }
+    
+    for(std::int32_t id = first; id <= last; ++id)
+    {
+        if(collect_job(id))
+        {
+            collected++;
+        }
+    }
+    
+    /* each job collected exactly once */
+    CHECK((started == STRESS_THREADS * (STRESS_ROUNDS / 10)) && (collected == started));
+    CHECK(get_job(last) == NULL);
+    
+    cancel_jobs();
+}
+
+#pragma mark -
+
+/* row 0 of the frame is row 0 of the picture, in gd and in the bottom-up BMP */
+
+static void test_row_order(){
+    
+    /* 2x3 BGRA, blue is 10 times the row */
+    bitmap_buffer_t bitmap(2 * 3 * 4, 0);
+    for(size_t y = 0; y < 3; ++y)
+    {
+        for(size_t x = 0; x < 2; ++x)
+        {
+            bitmap[(y * 2 + x) * 4] = (char)(y * 10);
+        }
+    }
+    
+    gdImagePtr gd = gd_create_from_bitmap(bitmap, 2, 3);
+    CHECK(gd != NULL);
+    if(gd)
+    {
+        CHECK(gdTrueColorGetBlue(gd->tpixels[0][0]) == 0);
+        CHECK(gdTrueColorGetBlue(gd->tpixels[2][1]) == 20);
+        gdImageDestroy(gd);
+    }
+    
+    encoded_image_t encoded;
+    encode_bmp(bitmap, 2, 3, &encoded);
+    CHECK(encoded.size == sizeof_bitmap_file_header + sizeof_bitmap_image_header + bitmap.size());
+    if(encoded.bytes)
+    {
+        const unsigned char *rows = (const unsigned char *)encoded.bytes.get() + sizeof_bitmap_file_header + sizeof_bitmap_image_header;
+        CHECK((rows[0] == 20) && (rows[8] == 10) && (rows[16] == 0));
+    }
+    
+    /* the fixture's samples grow with the row, so row 0 is the darkest; with threads:2 a work_threads helper may take a frame */
+    request_options_t request;
+    get_test_request(&request);
+    request.threads = 2;
+    
+    std::string image = fixture_image();
+    batch_item_t item;
+    item.memory.reset(new imebra::ReadMemory(image.data(), image.size()));
+    
+    dataset_result_t result;
+    CHECK(process_item(item, request, &result));
+    CHECK((result.frames.size() == 2) && (result.frames[0].image.bytes) && (result.frames[1].image.bytes));
+    
+    if((result.frames.size() == 2) && (result.frames[0].image.bytes))
+    {
+        gdImagePtr png = gdImageCreateFromPngPtr((int)result.frames[0].image.size, result.frames[0].image.bytes.get());
+        CHECK(png != NULL);
+        if(png)
+        {
+            CHECK((gdImageSX(png) == 8) && (gdImageSY(png) == 8));
+            CHECK(gdTrueColorGetRed(gdImageGetTrueColorPixel(png, 0, 0)) < gdTrueColorGetRed(gdImageGetTrueColorPixel(png, 0, 7)));
+            gdImageDestroy(png);
+        }
+    }
+}
+
+#pragma mark -
+
+int main(){
+    
+    test_find_pixel_data_offset();
+    test_find_pixel_data_offset_sequences();
+    test_find_pixel_data_offset_syntaxes();
+    test_get_instance_key();
+    test_read_element_prefix();
+    test_get_cache_key();
+    test_fragment_index();
+    test_tag_path();
+    test_encoding();
+    test_json_values();
+    test_get_json();
+    test_frame_cache();
+    test_work_pool();
+    test_buffer_pool();
+    test_sessions();
+    test_jobs();
+    test_row_order();
+    
+    printf("%d checks, %d failed\n", checks_count.load(), checks_failed.load());
+    
+    return checks_failed ? 1 : 0;
+}
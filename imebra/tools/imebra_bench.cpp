@@ -0,0 +1,410 @@
+/* --------------------------------------------------------------------------------
+ #
+ #	imebra_bench.cpp
+ #	runs the Get images pipeline over the imebra-corpus files, one pass per format
+ #	Project : Imebra
+ #
+ # --------------------------------------------------------------------------------*/
+
+#include "core/imebra_core.h"
+
+#include <cstdlib>
+#include <new>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+/* every operator new in the process; gd and the codecs that use malloc are not counted */
+
+static std::atomic<std::uint64_t> allocations(0);
+
+void *operator new(size_t size){
+    
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    
+    void *p = malloc(size ? size : 1);
+    
+    if(!p)
+        throw std::bad_alloc();
+    
+    return p;
+}
+
+void *operator new[](size_t size){
+    
+    return operator new(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t&) noexcept{
+    
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    
+    return malloc(size ? size : 1);
+}
+
+void *operator new[](size_t size, const std::nothrow_t& nothrow) noexcept{
+    
+    return operator new(size, nothrow);
+}
+
+void operator delete(void *p) noexcept{
+    
+    free(p);
+}
+
+void operator delete[](void *p) noexcept{
+    
+    free(p);
+}
+
+void operator delete(void *p, const std::nothrow_t&) noexcept{
+    
+    free(p);
+}
+
+void operator delete[](void *p, const std::nothrow_t&) noexcept{
+    
+    free(p);
+}
+
+/* bytes; the peak of the whole process so far, not of one pass */
+
+static std::uint64_t get_peak_rss(){
+    
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    
+    if(GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return counters.PeakWorkingSetSize;
+    
+    return 0;
+#else
+    struct rusage usage;
+    
+    if(getrusage(RUSAGE_SELF, &usage))
+        return 0;
+    
+#if defined(__APPLE__)
+    return usage.ru_maxrss;
+#else
+    return (std::uint64_t)usage.ru_maxrss * 1024;
+#endif
+#endif
+}
+
+typedef struct
+{
+    std::string name;
+    std::string path;
+    std::uint64_t size;
+}bench_file_t;
+
+typedef struct
+{
+    size_t frames;
+    double seconds;
+    std::uint64_t bytes_in;
+    std::uint64_t bytes_out;
+    std::uint64_t allocations;
+    size_t errors;
+}bench_counters_t;
+
+static const char *bench_formats[] = {".bmp", ".png", ".jpeg", ".gif", ".wbmp", ".webp", ".tiff", "raw"};
+
+static void get_bench_files(const std::string& corpus, std::vector<bench_file_t>& files){
+    
+    std::string manifest_path = corpus + "/corpus.txt";
+    FILE *manifest = fopen(manifest_path.c_str(), "r");
+    
+    if(!manifest)
+        return;
+    
+    char line[1024];
+    
+    while(fgets(line, sizeof(line), manifest))
+    {
+        bench_file_t file;
+        file.name = std::string(line, strcspn(line, "\t\r\n"));
+    
+        if(file.name.empty())
+            continue;
+    
+        file.path = corpus + "/" + file.name;
+    
+        struct stat st;
+        file.size = stat(file.path.c_str(), &st) ? 0 : (std::uint64_t)st.st_size;
+    
+        files.push_back(file);
+    }
+    
+    fclose(manifest);
+}
+
+static void set_image_format(const std::string& format, image_options_t *image_options){
+    
+    image_options->output = output_image;
+    image_options->format = image_format_bmp;
+    
+    if(format == "raw")
+        image_options->output = output_raw;
+    else if(format == ".png")
+        image_options->format = image_format_png;
+    else if(format == ".jpeg")
+        image_options->format = image_format_jpg;
+    else if(format == ".gif")
+        image_options->format = image_format_gif;
+    else if(format == ".wbmp")
+        image_options->format = image_format_wbmp;
+    else if(format == ".webp")
+        image_options->format = image_format_webp;
+    else if(format == ".tiff")
+        image_options->format = image_format_tiff;
+}
+
+static void run_file(const bench_file_t& file, const request_options_t& request, bench_counters_t *counters){
+    
+    batch_item_t item;
+#if defined(_WIN32)
+    item.path = std::wstring_convert<std::codecvt_utf8_utf16<wchar_t> >().from_bytes(file.path);
+#else
+    item.path = file.path;
+#endif
+    
+    std::uint64_t allocated = allocations.load(std::memory_order_relaxed);
+    stage_time_t start = std::chrono::steady_clock::now();
+    
+    {
+        dataset_result_t result;
+    
+        if((process_item(item, request, &result)) && ((result.data) || (result.cached)))
+        {
+            for(std::vector<render_frame_t>::const_iterator it = result.frames.begin(); it != result.frames.end(); ++it)
+            {
+                if(it->decoded)
+                {
+                    counters->frames++;
+                    counters->bytes_out += it->image.size + it->raw.size;
+                }else
+                {
+                    counters->errors++;
+                }
+            }
+        }else
+        {
+            counters->errors++;
+        }
+    }
+    
+    counters->seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    counters->allocations += allocations.load(std::memory_order_relaxed) - allocated;
+    counters->bytes_in += file.size;
+}
+
+static void json_append_counters(const bench_counters_t& counters, std::string& json){
+    
+    json += "\"frames\":";
+    json_append_number((double)counters.frames, json);
+    json += ",\"seconds\":";
+    json_append_number(counters.seconds, json);
+    json += ",\"framesPerSecond\":";
+    json_append_number(counters.seconds > 0 ? counters.frames / counters.seconds : 0, json);
+    json += ",\"megabytesPerSecond\":";
+    json_append_number(counters.seconds > 0 ? counters.bytes_in / counters.seconds / 1048576.0 : 0, json);
+    json += ",\"bytesIn\":";
+    json_append_number((double)counters.bytes_in, json);
+    json += ",\"bytesOut\":";
+    json_append_number((double)counters.bytes_out, json);
+    json += ",\"allocationsPerFrame\":";
+    json_append_number(counters.frames ? (double)counters.allocations / counters.frames : 0, json);
+    json += ",\"errors\":";
+    json_append_number((double)counters.errors, json);
+}
+
+int main(int argc, char *argv[]){
+    
+    request_options_t request;
+    
+    request.image_options.jpeg_quality = 0;
+    request.image_options.png_level = -1;
+    request.image_options.wbmp_fg = -1;
+    request.image_options.webp_quality = -1;
+    request.image_options.bmp_compression = 0;
+    request.image_options.max_width = 0;
+    request.image_options.max_height = 0;
+    request.image_options.rescale = false;
+    
+    request.export_tags = false;
+    request.use_tag_list = false;
+    request.json_output = json_none;
+    
+    request.frame_selection.list = false;
+    request.frame_selection.start = 0;
+    request.frame_selection.stride = 1;
+    request.frame_selection.count = -1;
+    
+    request.max_size_buffer_load = FILE_BUFFER_LOAD;
+    request.cache = false;/* every pass decodes */
+    request.threads = 1;
+    request.profile = false;
+    
+    std::string corpus;
+    std::string output;
+    std::vector<std::string> formats(bench_formats, bench_formats + sizeof(bench_formats) / sizeof(bench_formats[0]));
+    int iterations = 3;
+    
+    for(int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        const char *value = (i + 1) < argc ? argv[i + 1] : NULL;
+    
+        if(arg == "--cache")
+        {
+            request.cache = true;
+        }else if((arg == "--iterations") && (value))
+        {
+            iterations = std::max(1, atoi(argv[++i]));
+        }else if((arg == "--threads") && (value))
+        {
+            int n = atoi(argv[++i]);
+            request.threads = n > 0 ? n : std::thread::hardware_concurrency();
+        }else if((arg == "--max-size") && (value))
+        {
+            request.image_options.max_width = request.image_options.max_height = std::max(0, atoi(argv[++i]));
+        }else if((arg == "--formats") && (value))
+        {
+            formats.clear();
+            std::string list(argv[++i]);
+            for(size_t pos = 0; pos <= list.length(); )
+            {
+                size_t end = list.find(',', pos);
+                if(end == std::string::npos)
+                    end = list.length();
+                if(end > pos)
+                    formats.push_back(list.substr(pos, end - pos));
+                pos = end + 1;
+            }
+        }else if((arg == "--output") && (value))
+        {
+            output = argv[++i];
+        }else if(arg.compare(0, 2, "--") != 0)
+        {
+            corpus = arg;
+        }else
+        {
+            corpus.clear();
+            break;
+        }
+    }
+    
+    std::vector<bench_file_t> files;
+    
+    if(corpus.length())
+    {
+        get_bench_files(corpus, files);
+    }
+    
+    if(files.empty())
+    {
+        fprintf(stderr,
+                "usage: imebra-bench [options] corpus\n"
+                "  corpus               a directory written by imebra-corpus\n"
+                "  --formats a,b,...    default: .bmp,.png,.jpeg,.gif,.wbmp,.webp,.tiff,raw\n"
+                "  --iterations n       timed passes per file, after one warm-up pass\n"
+                "  --threads n          0=one per core\n"
+                "  --max-size n         maxWidth and maxHeight\n"
+                "  --cache              keep the frame cache between passes\n"
+                "  --output file        JSON results; default: stdout\n");
+        return 1;
+    }
+    
+    std::string json;
+    json += "{\"corpus\":";
+    json_append_utf8(corpus, json);
+    json += ",\"iterations\":";
+    json_append_number(iterations, json);
+    json += ",\"threads\":";
+    json_append_number(request.threads, json);
+    json += ",\"maxSize\":";
+    json_append_number(request.image_options.max_width, json);
+    json += ",\"cache\":";
+    json += request.cache ? "true" : "false";
+    json += ",\"formats\":[";
+    
+    for(size_t f = 0; f < formats.size(); ++f)
+    {
+        set_image_format(formats[f], &request.image_options);
+    
+        bench_counters_t total = {};
+        std::string json_files;
+    
+        for(size_t i = 0; i < files.size(); ++i)
+        {
+            bench_counters_t warm_up = {};
+            run_file(files[i], request, &warm_up);
+    
+            bench_counters_t counters = {};
+    
+            for(int n = 0; n < iterations; ++n)
+            {
+                run_file(files[i], request, &counters);
+            }
+    
+            total.frames += counters.frames;
+            total.seconds += counters.seconds;
+            total.bytes_in += counters.bytes_in;
+            total.bytes_out += counters.bytes_out;
+            total.allocations += counters.allocations;
+            total.errors += counters.errors;
+    
+            if(i)
+                json_files += ',';
+            json_files += "{\"file\":";
+            json_append_utf8(files[i].name, json_files);
+            json_files += ',';
+            json_append_counters(counters, json_files);
+            json_files += '}';
+        }
+    
+        if(f)
+            json += ',';
+        json += "{\"format\":";
+        json_append_utf8(formats[f], json);
+        json += ',';
+        json_append_counters(total, json);
+        json += ",\"peakRSS\":";
+        json_append_number((double)get_peak_rss(), json);
+        json += ",\"files\":[";
+        json += json_files;
+        json += "]}";
+    
+        fprintf(stderr, "%-6s %8.1f frames/s %8.1f MB/s\n",
+                formats[f].c_str(),
+                total.seconds > 0 ? total.frames / total.seconds : 0,
+                total.seconds > 0 ? total.bytes_in / total.seconds / 1048576.0 : 0);
+    }
+    
+    json += "]}\n";
+    
+    if(output.length())
+    {
+        FILE *f = fopen(output.c_str(), "wb");
+    
+        if(!f)
+        {
+            fprintf(stderr, "%s: failed to open\n", output.c_str());
+            return 1;
+        }
+    
+        fwrite(json.c_str(), 1, json.length(), f);
+        fclose(f);
+    }else
+    {
+        fwrite(json.c_str(), 1, json.length(), stdout);
+    }
+    
+    return 0;
+}
@@ -0,0 +1,230 @@
+/* --------------------------------------------------------------------------------
+ #
+ #	imebra_corpus.cpp
+ #	writes the benchmark corpus: the same synthetic images for every run
+ #	Project : Imebra
+ #
+ # --------------------------------------------------------------------------------*/
+
+#include "core/imebra_core.h"
+
+#include <cstdlib>
+
+typedef struct
+{
+    const char *name;
+    const char *transfer_syntax;
+    const char *color_space;
+    std::uint32_t bits;/* stored */
+    bool is_signed;
+    imebra::imageQuality_t quality;
+}corpus_entry_t;
+
+/* every transfer syntax with 8-bit; the wider depths where the codec takes them */
+
+static const corpus_entry_t corpus_entries[] = {
+    {"mono2_8_explicit",     imebra::uidExplicitVRLittleEndian_1_2_840_10008_1_2_1, "MONOCHROME2", 8, false, imebra::imageQuality_t::veryHigh},
+    {"mono2_12_explicit",    imebra::uidExplicitVRLittleEndian_1_2_840_10008_1_2_1, "MONOCHROME2", 12, false, imebra::imageQuality_t::veryHigh},
+    {"mono2_16_explicit",    imebra::uidExplicitVRLittleEndian_1_2_840_10008_1_2_1, "MONOCHROME2", 16, false, imebra::imageQuality_t::veryHigh},
+    {"mono2_s16_explicit",   imebra::uidExplicitVRLittleEndian_1_2_840_10008_1_2_1, "MONOCHROME2", 16, true, imebra::imageQuality_t::veryHigh},
+    {"mono1_16_explicit",    imebra::uidExplicitVRLittleEndian_1_2_840_10008_1_2_1, "MONOCHROME1", 16, false, imebra::imageQuality_t::veryHigh},
+    {"rgb_8_explicit",       imebra::uidExplicitVRLittleEndian_1_2_840_10008_1_2_1, "RGB", 8, false, imebra::imageQuality_t::veryHigh},
+    {"ybr_8_explicit",       imebra::uidExplicitVRLittleEndian_1_2_840_10008_1_2_1, "YBR_FULL", 8, false, imebra::imageQuality_t::veryHigh},
+    {"mono2_8_rle",          imebra::uidRLELossless_1_2_840_10008_1_2_5, "MONOCHROME2", 8, false, imebra::imageQuality_t::veryHigh},
+    {"mono2_12_rle",         imebra::uidRLELossless_1_2_840_10008_1_2_5, "MONOCHROME2", 12, false, imebra::imageQuality_t::veryHigh},
+    {"mono2_16_rle",         imebra::uidRLELossless_1_2_840_10008_1_2_5, "MONOCHROME2", 16, false, imebra::imageQuality_t::veryHigh},
+    {"mono1_8_rle",          imebra::uidRLELossless_1_2_840_10008_1_2_5, "MONOCHROME1", 8, false, imebra::imageQuality_t::veryHigh},
+    {"rgb_8_rle",            imebra::uidRLELossless_1_2_840_10008_1_2_5, "RGB", 8, false, imebra::imageQuality_t::veryHigh},
+    {"mono2_8_baseline",     imebra::uidJPEGBaselineProcess1_1_2_840_10008_1_2_4_50, "MONOCHROME2", 8, false, imebra::imageQuality_t::high},
+    {"ybr422_8_baseline",    imebra::uidJPEGBaselineProcess1_1_2_840_10008_1_2_4_50, "RGB", 8, false, imebra::imageQuality_t::medium},
+    {"mono2_8_lossless",     imebra::uidJPEGLosslessNonHierarchicalFirstOrderPredictionProcess14SelectionValue1_1_2_840_10008_1_2_4_70, "MONOCHROME2", 8, false, imebra::imageQuality_t::veryHigh},
+    {"mono2_12_lossless",    imebra::uidJPEGLosslessNonHierarchicalFirstOrderPredictionProcess14SelectionValue1_1_2_840_10008_1_2_4_70, "MONOCHROME2", 12, false, imebra::imageQuality_t::veryHigh},
+    {"mono2_16_lossless",    imebra::uidJPEGLosslessNonHierarchicalFirstOrderPredictionProcess14SelectionValue1_1_2_840_10008_1_2_4_70, "MONOCHROME2", 16, false, imebra::imageQuality_t::veryHigh},
+    {"rgb_8_lossless",       imebra::uidJPEGLosslessNonHierarchicalFirstOrderPredictionProcess14SelectionValue1_1_2_840_10008_1_2_4_70, "RGB", 8, false, imebra::imageQuality_t::veryHigh}
+};
+
+/* fixed seed: a given size and frame count always gives the same bytes */
+
+static std::uint32_t corpus_random(std::uint32_t *seed){
+    
+    *seed = *seed * 1664525U + 1013904223U;
+    
+    return *seed >> 8;
+}
+
+/* gradient, rings that move with the frame and some noise, so the codecs have real work */
+
+static double corpus_sample(std::uint32_t x, std::uint32_t y, std::uint32_t width, std::uint32_t height, size_t frame, std::uint32_t channel, std::uint32_t *seed){
+    
+    double dx = (double)x - width / 2.0;
+    double dy = (double)y - height / 2.0;
+    double r = std::sqrt(dx * dx + dy * dy) / (std::max(width, height) / 2.0);
+    
+    double gradient = (double)(x + y) / (width + height);
+    double rings = 0.5 + 0.5 * std::cos(r * 24.0 - frame * 0.5 + channel);
+    double noise = (corpus_random(seed) & 0xFF) / 255.0;
+    
+    return std::min(1.0, std::max(0.0, 0.45 * gradient + 0.45 * rings + 0.1 * noise));
+}
+
+static imebra::Image *create_image(const corpus_entry_t& entry, std::uint32_t width, std::uint32_t height, size_t frame){
+    
+    bool rgb = !imebra::ColorTransformsFactory::isMonochrome(entry.color_space);
+    
+    imebra::bitDepth_t depth = entry.bits <= 8
+    ? imebra::bitDepth_t::depthU8
+    : (entry.is_signed ? imebra::bitDepth_t::depthS16 : imebra::bitDepth_t::depthU16);
+    
+    /* the YBR images are converted from the RGB ones below */
+    std::unique_ptr<imebra::Image> image(new imebra::Image(width, height, depth, rgb ? "RGB" : entry.color_space, entry.bits - 1));
+    
+    {
+        std::unique_ptr<imebra::WritingDataHandlerNumeric> handler(image->getWritingDataHandler());
+    
+        std::uint32_t channels = rgb ? 3 : 1;
+        std::uint32_t seed = 0x1234567U + (std::uint32_t)frame;
+        double range = (double)((1U << entry.bits) - 1);
+        double offset = entry.is_signed ? (double)(1U << (entry.bits - 1)) : 0.0;
+    
+        for(std::uint32_t y = 0; y < height; ++y)
+        {
+            for(std::uint32_t x = 0; x < width; ++x)
+            {
+                for(std::uint32_t c = 0; c < channels; ++c)
+                {
+                    size_t i = ((size_t)y * width + x) * channels + c;
+                    double value = corpus_sample(x, y, width, height, frame, c, &seed) * range - offset;
+    
+                    if(entry.is_signed)
+                    {
+                        handler->setSignedLong(i, (std::int32_t)value);
+                    }else
+                    {
+                        handler->setUnsignedLong(i, (std::uint32_t)value);
+                    }
+                }
+            }
+        }
+    }
+    
+    if((rgb) && (std::string(entry.color_space) != "RGB"))
+    {
+        std::unique_ptr<imebra::Transform> transform(imebra::ColorTransformsFactory::getTransform("RGB", entry.color_space));
+        std::unique_ptr<imebra::Image> converted(transform->allocateOutputImage(*image, width, height));
+        transform->runTransform(*image, 0, 0, width, height, *converted, 0, 0);
+    
+        return converted.release();
+    }
+    
+    return image.release();
+}
+
+static void write_entry(const corpus_entry_t& entry, std::uint32_t width, std::uint32_t height, size_t frames, const std::string& path){
+    
+    imebra::DataSet data(entry.transfer_syntax);
+    
+    data.setString(imebra::TagId(imebra::tagId_t::SOPClassUID_0008_0016), frames > 1 ? "1.2.840.10008.5.1.4.1.1.7.3" : "1.2.840.10008.5.1.4.1.1.7");
+    data.setString(imebra::TagId(imebra::tagId_t::Modality_0008_0060), "OT");
+    
+    for(size_t i = 0; i < frames; ++i)
+    {
+        std::unique_ptr<imebra::Image> image(create_image(entry, width, height, i));
+        data.setImage(i, *image, entry.quality);
+    }
+    
+    if(imebra::ColorTransformsFactory::isMonochrome(entry.color_space))
+    {
+        /* the full range of the stored values; the signed set also has a modality transform */
+        double range = (double)(1U << entry.bits);
+    
+        if(entry.is_signed)
+        {
+            data.setDouble(imebra::TagId(imebra::tagId_t::RescaleSlope_0028_1053), 1.0);
+            data.setDouble(imebra::TagId(imebra::tagId_t::RescaleIntercept_0028_1052), -1024.0);
+            data.setDouble(imebra::TagId(imebra::tagId_t::WindowCenter_0028_1050), -1024.0);
+        }else
+        {
+            data.setDouble(imebra::TagId(imebra::tagId_t::WindowCenter_0028_1050), range / 2.0);
+        }
+    
+        data.setDouble(imebra::TagId(imebra::tagId_t::WindowWidth_0028_1051), range);
+    }
+    
+    imebra::CodecFactory::save(data, path, imebra::codecType_t::dicom);
+}
+
+int main(int argc, char *argv[]){
+    
+    std::string output;
+    std::uint32_t width = 512;
+    std::uint32_t height = 512;
+    size_t frames = 8;
+    
+    for(int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        const char *value = (i + 1) < argc ? argv[i + 1] : NULL;
+    
+        if((arg == "--size") && (value))
+        {
+            width = height = std::max(16, atoi(argv[++i]));
+        }else if((arg == "--frames") && (value))
+        {
+            frames = std::max(2, atoi(argv[++i]));/* the multi-frame objects */
+        }else if(arg.compare(0, 2, "--") != 0)
+        {
+            output = arg;
+        }else
+        {
+            output.clear();
+            break;
+        }
+    }
+    
+    if(output.empty())
+    {
+        fprintf(stderr, "usage: imebra-corpus [--size n] [--frames n] directory\n");
+        return 1;
+    }
+    
+    /* the manifest lists the files in a fixed order for imebra-bench */
+    std::string manifest_path = output + "/corpus.txt";
+    FILE *manifest = fopen(manifest_path.c_str(), "w");
+    
+    if(!manifest)
+    {
+        fprintf(stderr, "%s: failed to open\n", manifest_path.c_str());
+        return 1;
+    }
+    
+    int status = 0;
+    
+    for(size_t i = 0; i < sizeof(corpus_entries) / sizeof(corpus_entries[0]); ++i)
+    {
+        const corpus_entry_t& entry = corpus_entries[i];
+    
+        for(size_t multi = 0; multi < 2; ++multi)
+        {
+            size_t count = multi ? frames : 1;
+    
+            char name[64];
+            snprintf(name, sizeof(name), "%s_%zuf.dcm", entry.name, count);
+    
+            try
+            {
+                write_entry(entry, width, height, count, output + "/" + name);
+                fprintf(manifest, "%s\t%s\t%s\t%u\t%zu\n", name, entry.transfer_syntax, entry.color_space, entry.bits, count);
+                fprintf(stdout, "%s\n", name);
+            }
+            catch(std::exception& e)
+            {
+                fprintf(stderr, "%s: %s\n", name, e.what());
+                status = 1;
+            }
+        }
+    }
+    
+    fclose(manifest);
+    
+    return status;
+}
@@ -0,0 +1,325 @@
+/* --------------------------------------------------------------------------------
+ #
+ #	imebra_render.cpp
+ #	renders DICOM files with the plugin core, without 4D
+ #	Project : Imebra
+ #
+ # --------------------------------------------------------------------------------*/
+
+#include "core/imebra_core.h"
+
+#include <cstdlib>
+
+static void usage(){
+    
+    fprintf(stderr,
+            "usage: imebra-render [options] file...\n"
+            "  --format .bmp|.png|.jpeg|.gif|.wbmp|.webp|.tiff\n"
+            "  --quality n          jpeg and webp quality\n"
+            "  --level n            png compression level\n"
+            "  --max-width n        0=no limit\n"
+            "  --max-height n       0=no limit\n"
+            "  --frames a,b,...     default: every frame\n"
+            "  --start n --stride n --count n\n"
+            "  --threads n          0=one per core\n"
+            "  --raw                stored values instead of an image\n"
+            "  --rescale            raw values after the modality transform\n"
+            "  --filter name[=value] brightness, contrast, smooth or any filter without parameters\n"
+            "  --output dir         write each frame to dir\n"
+            "  --repeat n           render each file n times\n"
+            "  --no-cache           bypass the frame cache\n"
+            "  --profile            per-stage timings\n");
+}
+
+static image_format_t get_image_format(const std::string& format){
+    
+    if(format == ".png")
+        return image_format_png;
+    if((format == ".jpeg") || (format == ".jpg"))
+        return image_format_jpg;
+    if(format == ".gif")
+        return image_format_gif;
+    if(format == ".wbmp")
+        return image_format_wbmp;
+    if(format == ".webp")
+        return image_format_webp;
+    if((format == ".tiff") || (format == ".tif"))
+        return image_format_tiff;
+    
+    return image_format_bmp;
+}
+
+static void get_filter(const std::string& arg, filter_t *filter){
+    
+    memset(filter->matrix, 0, sizeof(filter->matrix));
+    
+    size_t pos = arg.find('=');
+    double value = pos == std::string::npos ? 0 : atof(arg.c_str() + pos + 1);
+    
+    filter->filter = arg.substr(0, pos);
+    filter->weight = value;
+    filter->brightness = value;
+    filter->contrast = value;
+}
+
+static std::string get_base_name(const std::string& path){
+    
+    size_t pos = path.find_last_of("/\\");
+    std::string name = pos == std::string::npos ? path : path.substr(pos + 1);
+    
+    pos = name.rfind('.');
+    
+    return pos == std::string::npos ? name : name.substr(0, pos);
+}
+
+static bool write_file(const std::string& path, const void *bytes, size_t size){
+    
+    FILE *f = fopen(path.c_str(), "wb");
+    
+    if(!f)
+        return false;
+    
+    bool written = fwrite(bytes, 1, size, f) == size;
+    fclose(f);
+    
+    return written;
+}
+
+/* filters are applied to the encoded frame, as Imebra Apply filters would */
+
+static void filter_frame(render_frame_t& frame, const image_options_t& image_options, const std::vector<filter_t>& filters){
+    
+    if((!frame.image.bytes) || (filters.empty()))
+        return;
+    
+    gdImagePtr gd = decode_image(image_options.format, frame.image.bytes.get(), (int)frame.image.size);
+    
+    if(!gd)
+        return;
+    
+    for(std::vector<filter_t>::const_iterator it = filters.begin(); it != filters.end(); ++it)
+    {
+        apply_filter(&gd, *it);
+    }
+    
+    encode_image(gd, image_options, &frame.image);
+    gdImageDestroy(gd);
+}
+
+static void print_profile(const profile_t& profile){
+    
+    for(int i = 0; i < stage_count; ++i)
+    {
+        if(!profile.calls[i])
+            continue;
+    
+        fprintf(stdout, "    %-10ls %6u calls %10.3f ms %12llu bytes\n",
+                stage_names[i],
+                profile.calls[i],
+                profile.ms[i],
+                (unsigned long long)profile.bytes[i]);
+    }
+}
+
+int main(int argc, char *argv[]){
+    
+    request_options_t request;
+    
+    request.image_options.format = image_format_bmp;
+    request.image_options.jpeg_quality = 0;
+    request.image_options.png_level = -1;
+    request.image_options.wbmp_fg = -1;
+    request.image_options.webp_quality = -1;
+    request.image_options.bmp_compression = 0;
+    request.image_options.max_width = 0;
+    request.image_options.max_height = 0;
+    request.image_options.output = output_image;
+    request.image_options.rescale = false;
+    
+    request.export_tags = false;
+    request.use_tag_list = false;
+    request.json_output = json_none;
+    
+    request.frame_selection.list = false;
+    request.frame_selection.start = 0;
+    request.frame_selection.stride = 1;
+    request.frame_selection.count = -1;
+    
+    request.max_size_buffer_load = FILE_BUFFER_LOAD;
+    request.cache = true;
+    request.threads = 1;
+    request.profile = false;
+    
+    std::vector<filter_t> filters;
+    std::vector<std::string> paths;
+    std::string output;
+    int repeat = 1;
+    
+    for(int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        const char *value = (i + 1) < argc ? argv[i + 1] : NULL;
+    
+        if(arg == "--raw")
+        {
+            request.image_options.output = output_raw;
+        }else if(arg == "--rescale")
+        {
+            request.image_options.rescale = true;
+        }else if(arg == "--no-cache")
+        {
+            request.cache = false;
+        }else if(arg == "--profile")
+        {
+            request.profile = true;
+        }else if((arg.compare(0, 2, "--") == 0) && (value))
+        {
+            ++i;
+    
+            if(arg == "--format")
+            {
+                request.image_options.format = get_image_format(value);
+            }else if(arg == "--quality")
+            {
+                request.image_options.jpeg_quality = atoi(value);
+                request.image_options.webp_quality = request.image_options.jpeg_quality;
+            }else if(arg == "--level")
+            {
+                request.image_options.png_level = atoi(value);
+            }else if(arg == "--max-width")
+            {
+                request.image_options.max_width = std::max(0, atoi(value));
+            }else if(arg == "--max-height")
+            {
+                request.image_options.max_height = std::max(0, atoi(value));
+            }else if(arg == "--frames")
+            {
+                request.frame_selection.list = true;
+                for(const char *p = value; *p; )
+                {
+                    char *end;
+                    request.frame_selection.frames.push_back(strtod(p, &end));
+                    p = *end ? end + 1 : end;
+                }
+            }else if(arg == "--start")
+            {
+                request.frame_selection.start = atoi(value);
+            }else if(arg == "--stride")
+            {
+                request.frame_selection.stride = atoi(value);
+            }else if(arg == "--count")
+            {
+                request.frame_selection.count = atoi(value);
+            }else if(arg == "--threads")
+            {
+                int n = atoi(value);
+                request.threads = n > 0 ? n : std::thread::hardware_concurrency();
+            }else if(arg == "--filter")
+            {
+                filter_t filter;
+                get_filter(value, &filter);
+                filters.push_back(filter);
+            }else if(arg == "--output")
+            {
+                output = value;
+            }else if(arg == "--repeat")
+            {
+                repeat = std::max(1, atoi(value));
+            }else
+            {
+                usage();
+                return 1;
+            }
+        }else if(arg.compare(0, 2, "--") == 0)
+        {
+            usage();
+            return 1;
+        }else
+        {
+            paths.push_back(arg);
+        }
+    }
+    
+    if(paths.empty())
+    {
+        usage();
+        return 1;
+    }
+    
+    int status = 0;
+    
+    for(std::vector<std::string>::const_iterator it = paths.begin(); it != paths.end(); ++it)
+    {
+        for(int r = 0; r < repeat; ++r)
+        {
+            batch_item_t item;
+#if defined(_WIN32)
+            item.path = std::wstring_convert<std::codecvt_utf8_utf16<wchar_t> >().from_bytes(*it);
+#else
+            item.path = *it;
+#endif
+            dataset_result_t result;
+    
+            if((!process_item(item, request, &result)) || ((!result.data) && (!result.cached)))
+            {
+                fprintf(stderr, "%s: %s\n", it->c_str(), result.error.length() ? result.error.c_str() : "failed to load");
+                status = 1;
+                break;
+            }
+    
+            size_t bytes = 0;
+    
+            for(std::vector<render_frame_t>::iterator frame = result.frames.begin(); frame != result.frames.end(); ++frame)
+            {
+                if(!frame->decoded)
+                    continue;
+    
+                filter_frame(*frame, request.image_options, filters);
+    
+                bytes += frame->image.size + frame->raw.size;
+    
+                if((output.length()) && (r == 0))
+                {
+                    char suffix[32];
+                    snprintf(suffix, sizeof(suffix), ".%zu", frame->frame);
+                    std::string path = output + "/" + get_base_name(*it) + suffix;
+    
+                    bool written = frame->raw.size
+                    ? write_file(path + ".raw", frame->raw.samples, frame->raw.size)
+                    : write_file(path + std::string(frame->image.format, frame->image.format + wcslen(frame->image.format)), frame->image.bytes.get(), frame->image.size);
+    
+                    if(!written)
+                    {
+                        fprintf(stderr, "%s: failed to write\n", path.c_str());
+                        status = 1;
+                    }
+                }
+            }
+    
+            double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - result.started).count();
+    
+            fprintf(stdout, "%s: %zu frames, %zu bytes, %.3f ms%s\n",
+                    it->c_str(),
+                    result.frames.size(),
+                    bytes,
+                    elapsed,
+                    result.cached ? " (cached)" : "");
+    
+            if(request.profile)
+            {
+                print_profile(result.profile);
+    
+                for(std::vector<render_frame_t>::const_iterator frame = result.frames.begin(); frame != result.frames.end(); ++frame)
+                {
+                    if(frame->profile)
+                    {
+                        fprintf(stdout, "  frame %zu\n", frame->frame);
+                        print_profile(*frame->profile);
+                    }
+                }
+            }
+        }
+    }
+    
+    return status;
+}
@@ -0,0 +1,282 @@
+/* --------------------------------------------------------------------------------
+ #
+ #	imebra_scale.cpp
+ #	runs the Get images pipeline from 1..N threads at once, as 4D preemptive processes would
+ #	Project : Imebra
+ #
+ # --------------------------------------------------------------------------------*/
+
+#include "core/imebra_core.h"
+
+#include <cstdlib>
+
+typedef struct
+{
+    size_t frames;
+    size_t errors;
+    std::uint64_t bytes;
+}scale_counters_t;
+
+static void get_scale_files(const std::string& corpus, std::vector<std::string>& files){
+    
+    std::string manifest_path = corpus + "/corpus.txt";
+    FILE *manifest = fopen(manifest_path.c_str(), "r");
+    
+    if(!manifest)
+    {
+        /* a single file */
+        files.push_back(corpus);
+        return;
+    }
+    
+    char line[1024];
+    
+    while(fgets(line, sizeof(line), manifest))
+    {
+        std::string name(line, strcspn(line, "\t\r\n"));
+    
+        if(name.length())
+            files.push_back(corpus + "/" + name);
+    }
+    
+    fclose(manifest);
+}
+
+/* one worker is one process running the command in a loop; each starts at a different file.
+ counts are kept on the stack and written once, so that the workers share no cache line */
+
+static void scale_worker(const std::vector<std::string>& files, const request_options_t& request, size_t offset, std::chrono::steady_clock::time_point deadline, std::atomic<bool> *go, scale_counters_t *counters){
+    
+    while(!go->load(std::memory_order_acquire))
+    {
+        std::this_thread::yield();
+    }
+    
+    scale_counters_t local = {0, 0, 0};
+    
+    for(size_t i = offset; std::chrono::steady_clock::now() < deadline; ++i)
+    {
+        batch_item_t item;
+#if defined(_WIN32)
+        item.path = std::wstring_convert<std::codecvt_utf8_utf16<wchar_t> >().from_bytes(files[i % files.size()]);
+#else
+        item.path = files[i % files.size()];
+#endif
+    
+        dataset_result_t result;
+    
+        if((process_item(item, request, &result)) && ((result.data) || (result.cached)))
+        {
+            for(std::vector<render_frame_t>::const_iterator it = result.frames.begin(); it != result.frames.end(); ++it)
+            {
+                if(it->decoded)
+                {
+                    local.frames++;
+                    local.bytes += it->image.size + it->raw.size;
+                }else
+                {
+                    local.errors++;
+                }
+            }
+        }else
+        {
+            local.errors++;
+        }
+    }
+    
+    *counters = local;
+}
+
+static scale_counters_t run_step(const std::vector<std::string>& files, const request_options_t& request, unsigned int threads, double seconds, double *elapsed){
+    
+    std::vector<scale_counters_t> counters(threads);
+    std::vector<std::thread> workers;
+    std::atomic<bool> go(false);
+    
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point deadline = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(seconds));
+    
+    for(unsigned int i = 0; i < threads; ++i)
+    {
+        workers.push_back(std::thread(scale_worker, std::cref(files), std::cref(request), (size_t)i * files.size() / threads, deadline, &go, &counters[i]));
+    }
+    
+    go.store(true, std::memory_order_release);
+    
+    for(std::vector<std::thread>::iterator it = workers.begin(); it != workers.end(); ++it)
+    {
+        it->join();
+    }
+    
+    /* the last item of each worker may run past the deadline */
+    *elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    
+    scale_counters_t total = {0, 0, 0};
+    
+    for(unsigned int i = 0; i < threads; ++i)
+    {
+        total.frames += counters[i].frames;
+        total.errors += counters[i].errors;
+        total.bytes += counters[i].bytes;
+    }
+    
+    return total;
+}
+
+int main(int argc, char *argv[]){
+    
+    request_options_t request;
+    
+    request.image_options.format = image_format_png;
+    request.image_options.jpeg_quality = 0;
+    request.image_options.png_level = 1;
+    request.image_options.wbmp_fg = -1;
+    request.image_options.webp_quality = -1;
+    request.image_options.bmp_compression = 0;
+    request.image_options.max_width = 0;
+    request.image_options.max_height = 0;
+    request.image_options.output = output_image;
+    request.image_options.rescale = false;
+    
+    request.export_tags = false;
+    request.use_tag_list = false;
+    request.json_output = json_none;
+    
+    request.frame_selection.list = false;
+    request.frame_selection.start = 0;
+    request.frame_selection.stride = 1;
+    request.frame_selection.count = -1;
+    
+    request.max_size_buffer_load = FILE_BUFFER_LOAD;
+    request.cache = false;
+    request.threads = 1;/* one thread per command, the processes run side by side */
+    request.profile = false;
+    
+    std::string corpus;
+    std::string output;
+    unsigned int max_threads = std::max(1U, std::thread::hardware_concurrency());
+    double seconds = 2.0;
+    
+    for(int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        const char *value = (i + 1) < argc ? argv[i + 1] : NULL;
+    
+        if(arg == "--cache")
+        {
+            request.cache = true;
+        }else if(arg == "--raw")
+        {
+            request.image_options.output = output_raw;
+        }else if((arg == "--threads") && (value))
+        {
+            max_threads = std::max(1, atoi(argv[++i]));
+        }else if((arg == "--seconds") && (value))
+        {
+            seconds = std::max(0.1, atof(argv[++i]));
+        }else if((arg == "--output") && (value))
+        {
+            output = argv[++i];
+        }else if(arg.compare(0, 2, "--") != 0)
+        {
+            corpus = arg;
+        }else
+        {
+            corpus.clear();
+            break;
+        }
+    }
+    
+    if(corpus.empty())
+    {
+        fprintf(stderr,
+                "usage: imebra-scale [options] corpus|file\n"
+                "  --threads n          the largest step; default: one per core\n"
+                "  --seconds n          duration of each step\n"
+                "  --raw                raw output instead of .png\n"
+                "  --cache              go through the frame cache\n"
+                "  --output file        JSON results; default: stdout\n");
+        return 1;
+    }
+    
+    std::vector<std::string> files;
+    get_scale_files(corpus, files);
+    
+    /* 1, 2, 4... and max_threads */
+    std::vector<unsigned int> steps;
+    
+    for(unsigned int n = 1; n < max_threads; n *= 2)
+    {
+        steps.push_back(n);
+    }
+    
+    steps.push_back(max_threads);
+    
+    /* warm-up: first use of the codecs, the allocator and the cache */
+    double elapsed;
+    run_step(files, request, 1, 0.1, &elapsed);
+    
+    std::string json;
+    json += "{\"corpus\":";
+    json_append_utf8(corpus, json);
+    json += ",\"seconds\":";
+    json_append_number(seconds, json);
+    json += ",\"cache\":";
+    json += request.cache ? "true" : "false";
+    json += ",\"steps\":[";
+    
+    double base = 0;
+    
+    for(size_t i = 0; i < steps.size(); ++i)
+    {
+        scale_counters_t total = run_step(files, request, steps[i], seconds, &elapsed);
+    
+        double rate = elapsed > 0 ? total.frames / elapsed : 0;
+    
+        if(i == 0)
+            base = rate;
+    
+        double speedup = base > 0 ? rate / base : 0;
+    
+        if(i)
+            json += ',';
+        json += "{\"threads\":";
+        json_append_number(steps[i], json);
+        json += ",\"frames\":";
+        json_append_number((double)total.frames, json);
+        json += ",\"framesPerSecond\":";
+        json_append_number(rate, json);
+        json += ",\"speedup\":";
+        json_append_number(speedup, json);
+        json += ",\"efficiency\":";
+        json_append_number(speedup / steps[i], json);
+        json += ",\"bytesOut\":";
+        json_append_number((double)total.bytes, json);
+        json += ",\"errors\":";
+        json_append_number((double)total.errors, json);
+        json += '}';
+    
+        fprintf(stderr, "%3u threads %8.1f frames/s %5.2fx %5.1f%%\n", steps[i], rate, speedup, 100.0 * speedup / steps[i]);
+    }
+    
+    json += "]}\n";
+    
+    if(output.length())
+    {
+        FILE *f = fopen(output.c_str(), "wb");
+    
+        if(!f)
+        {
+            fprintf(stderr, "%s: failed to open\n", output.c_str());
+            return 1;
+        }
+    
+        fwrite(json.c_str(), 1, json.length(), f);
+        fclose(f);
+    }else
+    {
+        fwrite(json.c_str(), 1, json.length(), stdout);
+    }
+    
+    return 0;
+}